@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IRONSIDE_SE_CONF_BATCH_H_
+#define IRONSIDE_SE_CONF_BATCH_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ironside/se/api.h>
+#include <ironside/se/glue.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup ironside_se_conf_batch PERIPHCONF/MPCCONF batches
+ * @ingroup ironside_se_ipc
+ * @brief Accumulate configuration entries and apply them with a single IronSide SE call.
+ *
+ * Entries added to a batch are kept sorted by register, and an entry for a register that is
+ * already in the batch replaces the previous one. The registers are therefore written in
+ * the order of their addresses, not in the order the entries were added.
+ *
+ * Entry storage must be aligned to, and have a size that is a multiple of,
+ * @ref IRONSIDE_SE_CACHE_DATA_UNIT_SIZE so that no bounce buffers are needed.
+ * @ref IRONSIDE_SE_PERIPHCONF_BATCH_STORAGE_DEFINE and
+ * @ref IRONSIDE_SE_MPCCONF_BATCH_STORAGE_DEFINE define such storage.
+ *
+ * Batch functions are not thread safe.
+ * @{
+ */
+
+/** Round @p _count up so that @p _count entries of @p _type fill whole cache data units. */
+#define IRONSIDE_SE_CONF_BATCH_CAPACITY(_type, _count)                                             \
+	(IRONSIDE_SE_CACHE_ALIGNED_SIZE((_count) * sizeof(_type)) / sizeof(_type))
+
+/** @brief Define storage for a PERIPHCONF batch.
+ *
+ * @param _name Name of the entry array. The capacity is available as <tt>ARRAY_SIZE(_name)</tt>.
+ * @param _count Minimum number of entries.
+ */
+#define IRONSIDE_SE_PERIPHCONF_BATCH_STORAGE_DEFINE(_name, _count)                                 \
+	struct periphconf_entry _name[IRONSIDE_SE_CONF_BATCH_CAPACITY(struct periphconf_entry,     \
+								      _count)]                     \
+		IRONSIDE_SE_CACHE_ALIGNED
+
+/** @brief Define storage for an MPCCONF batch.
+ *
+ * @param _name Name of the entry array. The capacity is available as <tt>ARRAY_SIZE(_name)</tt>.
+ * @param _count Minimum number of entries.
+ */
+#define IRONSIDE_SE_MPCCONF_BATCH_STORAGE_DEFINE(_name, _count)                                    \
+	struct mpcconf_entry _name[IRONSIDE_SE_CONF_BATCH_CAPACITY(struct mpcconf_entry, _count)]  \
+		IRONSIDE_SE_CACHE_ALIGNED
+
+/** Statistics of a batch. */
+struct ironside_se_conf_batch_stats {
+	/** Number of IronSide SE calls made. */
+	uint32_t calls;
+	/** Number of entries written. */
+	uint32_t written;
+	/** Number of entries dropped because they were replaced or matched the register value. */
+	uint32_t skipped;
+	/** Time spent in IronSide SE calls, in @ref IRONSIDE_SE_TIMESTAMP_GET units.
+	 *  Includes the data cache maintenance done for the calls.
+	 */
+	uint32_t time;
+};
+
+/** PERIPHCONF batch. */
+struct ironside_se_periphconf_batch {
+	/** Entries to be written, sorted by register pointer. */
+	struct periphconf_entry *entries;
+	/** Storage for the register values read back, or NULL. */
+	struct periphconf_entry *readback;
+	/** Capacity of @c entries and @c readback. */
+	size_t capacity;
+	/** Number of entries to be written. */
+	size_t count;
+	/** Batch statistics. */
+	struct ironside_se_conf_batch_stats stats;
+};
+
+/** MPCCONF batch. */
+struct ironside_se_mpcconf_batch {
+	/** Entries to be written, sorted by register pointer. */
+	struct mpcconf_entry *entries;
+	/** Storage for the register values read back, or NULL. */
+	struct mpcconf_entry *readback;
+	/** Capacity of @c entries and @c readback. */
+	size_t capacity;
+	/** Number of entries to be written. */
+	size_t count;
+	/** Batch statistics. */
+	struct ironside_se_conf_batch_stats stats;
+};
+
+/**
+ * @brief Initialize a PERIPHCONF batch.
+ *
+ * @param batch Batch to initialize.
+ * @param entries Storage for the entries.
+ * @param readback Storage for the read back values, or NULL if
+ *                 @ref ironside_se_periphconf_batch_readback is not used.
+ * @param capacity Number of entries in @p entries and @p readback.
+ *
+ * @retval 0 on success.
+ * @retval -IRONSIDE_SE_PERIPHCONF_ERROR_POINTER_UNALIGNED if the storage is not aligned.
+ */
+int ironside_se_periphconf_batch_init(struct ironside_se_periphconf_batch *batch,
+				      struct periphconf_entry *entries,
+				      struct periphconf_entry *readback, size_t capacity);
+
+/**
+ * @brief Add an entry to a PERIPHCONF batch.
+ *
+ * @param batch Batch.
+ * @param entry Entry to add. Replaces the entry for the same register if there is one.
+ *
+ * @retval true if the entry was added.
+ * @retval false if the batch is full.
+ */
+bool ironside_se_periphconf_batch_add(struct ironside_se_periphconf_batch *batch,
+				      const struct periphconf_entry *entry);
+
+/**
+ * @brief Drop the entries of a PERIPHCONF batch that would not change the register value.
+ *
+ * The current values of all registers in the batch are read with a single IronSide SE call.
+ *
+ * @param batch Batch.
+ * @returns Status of @ref ironside_se_periphconf_read.
+ */
+struct ironside_se_periphconf_status
+ironside_se_periphconf_batch_readback(struct ironside_se_periphconf_batch *batch);
+
+/**
+ * @brief Write the entries of a PERIPHCONF batch with a single IronSide SE call.
+ *
+ * Entries that were written are removed from the batch. On error the entry which caused
+ * the error is the first one left in the batch.
+ *
+ * @param batch Batch.
+ * @returns Status of @ref ironside_se_periphconf_write.
+ */
+struct ironside_se_periphconf_status
+ironside_se_periphconf_batch_submit(struct ironside_se_periphconf_batch *batch);
+
+/**
+ * @brief Initialize an MPCCONF batch.
+ *
+ * @param batch Batch to initialize.
+ * @param entries Storage for the entries.
+ * @param readback Storage for the read back values, or NULL if
+ *                 @ref ironside_se_mpcconf_batch_readback is not used.
+ * @param capacity Number of entries in @p entries and @p readback.
+ *
+ * @retval 0 on success.
+ * @retval -IRONSIDE_SE_MPCCONF_ERROR_POINTER_UNALIGNED if the storage is not aligned.
+ */
+int ironside_se_mpcconf_batch_init(struct ironside_se_mpcconf_batch *batch,
+				   struct mpcconf_entry *entries, struct mpcconf_entry *readback,
+				   size_t capacity);
+
+/**
+ * @brief Add an entry to an MPCCONF batch.
+ *
+ * Entries are identified by the REGPTR field of @c config0.
+ *
+ * @param batch Batch.
+ * @param entry Entry to add. Replaces the entry for the same register if there is one.
+ *
+ * @retval true if the entry was added.
+ * @retval false if the batch is full.
+ */
+bool ironside_se_mpcconf_batch_add(struct ironside_se_mpcconf_batch *batch,
+				   const struct mpcconf_entry *entry);
+
+/**
+ * @brief Drop the entries of an MPCCONF batch that would not change the configuration.
+ *
+ * The current configuration of all entries in the batch is read with a single IronSide SE call.
+ *
+ * @param batch Batch.
+ * @returns Status of @ref ironside_se_mpcconf_read.
+ */
+struct ironside_se_mpcconf_status
+ironside_se_mpcconf_batch_readback(struct ironside_se_mpcconf_batch *batch);
+
+/**
+ * @brief Write the entries of an MPCCONF batch with a single IronSide SE call.
+ *
+ * Entries that were written are removed from the batch. On error the entry which caused
+ * the error is the first one left in the batch.
+ *
+ * @param batch Batch.
+ * @returns Status of @ref ironside_se_mpcconf_write.
+ */
+struct ironside_se_mpcconf_status
+ironside_se_mpcconf_batch_submit(struct ironside_se_mpcconf_batch *batch);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* IRONSIDE_SE_CONF_BATCH_H_ */
@@ -11,6 +11,7 @@
 #endif
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <ironside/se/call.h>
 
@@ -27,6 +28,13 @@ extern "C" {
 #define IRONSIDE_SE_ALWAYS_INLINE __attribute__((always_inline)) inline
 #endif
 
+#ifndef IRONSIDE_SE_TIMESTAMP_GET
+/** Get the timestamp used to measure the time spent in IronSide SE calls.
+ *  The unit is defined by the integration. The default does not measure time.
+ */
+#define IRONSIDE_SE_TIMESTAMP_GET() 0
+#endif
+
 /**
  * @name Macros to set function attributes on IronSide SE API.
  * @{
@@ -83,6 +91,56 @@ void ironside_se_call_release(struct ironside_se_call_buf *buf);
 /** Data cache data unit size used for alignment requirements. */
 #define IRONSIDE_SE_CACHE_DATA_UNIT_SIZE (DCACHEDATA_DATAWIDTH * 4)
 
+/** Round @p _size up to a multiple of @ref IRONSIDE_SE_CACHE_DATA_UNIT_SIZE. */
+#define IRONSIDE_SE_CACHE_ALIGNED_SIZE(_size)                                                      \
+	((((_size) + IRONSIDE_SE_CACHE_DATA_UNIT_SIZE - 1) / IRONSIDE_SE_CACHE_DATA_UNIT_SIZE) *    \
+	 IRONSIDE_SE_CACHE_DATA_UNIT_SIZE)
+
+/** Attribute aligning a variable to @ref IRONSIDE_SE_CACHE_DATA_UNIT_SIZE. */
+#define IRONSIDE_SE_CACHE_ALIGNED __attribute__((aligned(IRONSIDE_SE_CACHE_DATA_UNIT_SIZE)))
+
+/** @brief Define a buffer that can be passed to IronSide SE without a bounce buffer.
+ *
+ * @param _name Name of the buffer.
+ * @param _size Minimum size of the buffer in bytes. The size is rounded up to
+ *              a multiple of @ref IRONSIDE_SE_CACHE_DATA_UNIT_SIZE.
+ */
+#define IRONSIDE_SE_BUF_DEFINE(_name, _size)                                                       \
+	uint8_t _name[IRONSIDE_SE_CACHE_ALIGNED_SIZE(_size)] IRONSIDE_SE_CACHE_ALIGNED
+
+#ifndef IRONSIDE_SE_BOUNCE_BUFFER_POOL_COUNT
+/** Number of bounce buffers in the pool used before falling back to
+ *  @ref ironside_se_bounce_buffer_heap_alloc. At most 32. Zero disables the pool.
+ */
+#define IRONSIDE_SE_BOUNCE_BUFFER_POOL_COUNT 0
+#endif
+
+#ifndef IRONSIDE_SE_BOUNCE_BUFFER_POOL_SIZE
+/** Size of each bounce buffer in the pool, rounded up to
+ *  a multiple of @ref IRONSIDE_SE_CACHE_DATA_UNIT_SIZE.
+ */
+#define IRONSIDE_SE_BOUNCE_BUFFER_POOL_SIZE 64
+#endif
+
+/** Bounce buffer usage counters. */
+struct ironside_se_bounce_buffer_stats {
+	/** Number of buffers that were aligned and used directly. */
+	uint32_t direct;
+	/** Number of bounce buffers taken from the pool. */
+	uint32_t pool;
+	/** Number of bounce buffers allocated with @ref ironside_se_bounce_buffer_heap_alloc. */
+	uint32_t heap;
+	/** Number of failed bounce buffer allocations. */
+	uint32_t failed;
+};
+
+/**
+ * @brief Get the bounce buffer usage counters.
+ *
+ * @param[out] stats Counters accumulated since boot.
+ */
+void ironside_se_bounce_buffer_stats_get(struct ironside_se_bounce_buffer_stats *stats);
+
 /**
  * @brief Allocate memory area for bounce buffer.
  *
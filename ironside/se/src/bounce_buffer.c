@@ -12,22 +12,94 @@
 
 #include <nrfx.h>
 
-static size_t size_round_up(size_t value, size_t alignment)
+#if IRONSIDE_SE_BOUNCE_BUFFER_POOL_COUNT > 32
+#error "IRONSIDE_SE_BOUNCE_BUFFER_POOL_COUNT must not exceed 32"
+#endif
+
+#define POOL_BUF_SIZE IRONSIDE_SE_CACHE_ALIGNED_SIZE(IRONSIDE_SE_BOUNCE_BUFFER_POOL_SIZE)
+
+static struct ironside_se_bounce_buffer_stats counters;
+
+static void stats_inc(uint32_t *counter)
+{
+	__atomic_fetch_add(counter, 1, __ATOMIC_RELAXED);
+}
+
+#if IRONSIDE_SE_BOUNCE_BUFFER_POOL_COUNT > 0
+
+static uint8_t pool[IRONSIDE_SE_BOUNCE_BUFFER_POOL_COUNT][POOL_BUF_SIZE] IRONSIDE_SE_CACHE_ALIGNED;
+
+/* Bit n is set when pool[n] is free. */
+static uint32_t pool_free = (uint32_t)(((uint64_t)1 << IRONSIDE_SE_BOUNCE_BUFFER_POOL_COUNT) - 1);
+
+static void *pool_alloc(void)
+{
+	uint32_t mask = __atomic_load_n(&pool_free, __ATOMIC_RELAXED);
+
+	while (mask != 0) {
+		const uint32_t idx = (uint32_t)__builtin_ctz(mask);
+
+		if (__atomic_compare_exchange_n(&pool_free, &mask, mask & ~(1UL << idx), false,
+						__ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+			return pool[idx];
+		}
+	}
+
+	return NULL;
+}
+
+static bool pool_free_try(void *buffer)
 {
-	return ((value + alignment - 1) / alignment) * alignment;
+	const uintptr_t offset = (uintptr_t)buffer - (uintptr_t)pool;
+
+	if ((uintptr_t)buffer < (uintptr_t)pool || offset >= sizeof(pool)) {
+		return false;
+	}
+
+	__atomic_fetch_or(&pool_free, 1UL << (offset / POOL_BUF_SIZE), __ATOMIC_RELEASE);
+
+	return true;
 }
 
+#else
+
+static void *pool_alloc(void)
+{
+	return NULL;
+}
+
+static bool pool_free_try(void *buffer)
+{
+	(void)buffer;
+
+	return false;
+}
+
+#endif /* IRONSIDE_SE_BOUNCE_BUFFER_POOL_COUNT > 0 */
+
 void *ironside_se_bounce_buffer_prepare(void *original_buffer, size_t size)
 {
 	if (!ironside_se_bounce_buffer_is_needed(original_buffer, size)) {
+		stats_inc(&counters.direct);
 		return original_buffer;
 	}
 
 	/* The allocator code is required to allocate a memory slab that is aligned with the
 	 * data unit size. To make things simpler for implementers we do the alignment here.
 	 */
-	const size_t aligned_size = size_round_up(size, IRONSIDE_SE_CACHE_DATA_UNIT_SIZE);
-	void *out_buffer = ironside_se_bounce_buffer_heap_alloc(aligned_size);
+	const size_t aligned_size = IRONSIDE_SE_CACHE_ALIGNED_SIZE(size);
+	void *out_buffer = NULL;
+
+	if (aligned_size <= POOL_BUF_SIZE) {
+		out_buffer = pool_alloc();
+	}
+
+	if (out_buffer != NULL) {
+		stats_inc(&counters.pool);
+	} else {
+		out_buffer = ironside_se_bounce_buffer_heap_alloc(aligned_size);
+		stats_inc(out_buffer != NULL ? &counters.heap : &counters.failed);
+	}
 
 	if (out_buffer != NULL) {
 		memcpy(out_buffer, original_buffer, size);
@@ -44,11 +116,22 @@ void ironside_se_bounce_buffer_release(void *original_buffer, void *out_buffer,
 
 	memcpy(original_buffer, out_buffer, size);
 
-	const size_t aligned_size = size_round_up(size, IRONSIDE_SE_CACHE_DATA_UNIT_SIZE);
+	const size_t aligned_size = IRONSIDE_SE_CACHE_ALIGNED_SIZE(size);
 
 	/* Clear buffer before returning it to not leak sensitive data */
 	memset(out_buffer, 0, aligned_size);
 
 	ironside_se_data_cache_writeback(out_buffer, size);
-	ironside_se_bounce_buffer_heap_free(out_buffer);
+
+	if (!pool_free_try(out_buffer)) {
+		ironside_se_bounce_buffer_heap_free(out_buffer);
+	}
+}
+
+void ironside_se_bounce_buffer_stats_get(struct ironside_se_bounce_buffer_stats *stats)
+{
+	stats->direct = __atomic_load_n(&counters.direct, __ATOMIC_RELAXED);
+	stats->pool = __atomic_load_n(&counters.pool, __ATOMIC_RELAXED);
+	stats->heap = __atomic_load_n(&counters.heap, __ATOMIC_RELAXED);
+	stats->failed = __atomic_load_n(&counters.failed, __ATOMIC_RELAXED);
 }
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <ironside/se/conf_batch.h>
+#include <ironside/se/internal/bounce_buffer.h>
+
+typedef uint32_t (*entry_key_get_t)(const void *entry);
+
+static uint32_t periphconf_key_get(const void *entry)
+{
+	return ((const struct periphconf_entry *)entry)->regptr;
+}
+
+static uint32_t mpcconf_key_get(const void *entry)
+{
+	return ((const struct mpcconf_entry *)entry)->config0 & MPCCONF_ENTRY_CONFIG0_REGPTR_Msk;
+}
+
+static bool entry_add(uint8_t *entries, size_t *count, size_t capacity, size_t size,
+		      entry_key_get_t key_get, const void *entry,
+		      struct ironside_se_conf_batch_stats *stats)
+{
+	const uint32_t key = key_get(entry);
+	size_t lo = 0;
+	size_t hi = *count;
+
+	while (lo < hi) {
+		const size_t mid = lo + (hi - lo) / 2;
+
+		if (key_get(&entries[mid * size]) < key) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	uint8_t *slot = &entries[lo * size];
+
+	if (lo < *count && key_get(slot) == key) {
+		/* The last write to a register wins. */
+		memcpy(slot, entry, size);
+		stats->skipped++;
+		return true;
+	}
+
+	if (*count == capacity) {
+		return false;
+	}
+
+	memmove(slot + size, slot, (*count - lo) * size);
+	memcpy(slot, entry, size);
+	(*count)++;
+
+	return true;
+}
+
+/* Copy the entries to the read back storage and pad the copy to whole cache data units by
+ * repeating the last entry, since buffer mode reads require an aligned size.
+ */
+static size_t readback_prepare(const uint8_t *entries, uint8_t *readback, size_t count,
+			       size_t capacity, size_t size)
+{
+	size_t padded = count;
+
+	memcpy(readback, entries, count * size);
+
+	while ((padded * size) % IRONSIDE_SE_CACHE_DATA_UNIT_SIZE != 0 && padded < capacity) {
+		memcpy(&readback[padded * size], &readback[(padded - 1) * size], size);
+		padded++;
+	}
+
+	return padded;
+}
+
+/* Drop the entries that match the values read back from the registers. */
+static void unchanged_drop(uint8_t *entries, const uint8_t *readback, size_t *count, size_t size,
+			   struct ironside_se_conf_batch_stats *stats)
+{
+	size_t kept = 0;
+
+	for (size_t i = 0; i < *count; i++) {
+		if (memcmp(&entries[i * size], &readback[i * size], size) == 0) {
+			stats->skipped++;
+			continue;
+		}
+		if (kept != i) {
+			memcpy(&entries[kept * size], &entries[i * size], size);
+		}
+		kept++;
+	}
+
+	*count = kept;
+}
+
+/* Remove the entries written by a (possibly partially) successful call. */
+static void written_drop(uint8_t *entries, size_t *count, size_t written, size_t size,
+			 struct ironside_se_conf_batch_stats *stats)
+{
+	if (written > *count) {
+		written = *count;
+	}
+
+	memmove(entries, &entries[written * size], (*count - written) * size);
+	*count -= written;
+	stats->written += written;
+}
+
+int ironside_se_periphconf_batch_init(struct ironside_se_periphconf_batch *batch,
+				      struct periphconf_entry *entries,
+				      struct periphconf_entry *readback, size_t capacity)
+{
+	const size_t size = sizeof(struct periphconf_entry) * capacity;
+
+	if (ironside_se_bounce_buffer_is_needed(entries, size) ||
+	    (readback != NULL && ironside_se_bounce_buffer_is_needed(readback, size))) {
+		return -IRONSIDE_SE_PERIPHCONF_ERROR_POINTER_UNALIGNED;
+	}
+
+	memset(batch, 0, sizeof(*batch));
+	batch->entries = entries;
+	batch->readback = readback;
+	batch->capacity = capacity;
+
+	return 0;
+}
+
+bool ironside_se_periphconf_batch_add(struct ironside_se_periphconf_batch *batch,
+				      const struct periphconf_entry *entry)
+{
+	return entry_add((uint8_t *)batch->entries, &batch->count, batch->capacity,
+			 sizeof(struct periphconf_entry), periphconf_key_get, entry, &batch->stats);
+}
+
+struct ironside_se_periphconf_status
+ironside_se_periphconf_batch_readback(struct ironside_se_periphconf_batch *batch)
+{
+	struct ironside_se_periphconf_status status = { 0 };
+	size_t count = batch->count;
+
+	if (count == 0) {
+		return status;
+	}
+
+	if (count > IRONSIDE_SE_PERIPHCONF_INLINE_READ_MAX_COUNT) {
+		count = readback_prepare((const uint8_t *)batch->entries, (uint8_t *)batch->readback,
+					 count, batch->capacity, sizeof(struct periphconf_entry));
+	} else {
+		memcpy(batch->readback, batch->entries, count * sizeof(struct periphconf_entry));
+	}
+
+	const uint32_t start = IRONSIDE_SE_TIMESTAMP_GET();
+
+	status = ironside_se_periphconf_read(batch->readback, count);
+
+	batch->stats.time += (uint32_t)(IRONSIDE_SE_TIMESTAMP_GET() - start);
+	batch->stats.calls++;
+
+	if (status.status == 0) {
+		unchanged_drop((uint8_t *)batch->entries, (const uint8_t *)batch->readback,
+			       &batch->count, sizeof(struct periphconf_entry), &batch->stats);
+	}
+
+	return status;
+}
+
+struct ironside_se_periphconf_status
+ironside_se_periphconf_batch_submit(struct ironside_se_periphconf_batch *batch)
+{
+	struct ironside_se_periphconf_status status = { 0 };
+
+	if (batch->count == 0) {
+		return status;
+	}
+
+	const uint32_t start = IRONSIDE_SE_TIMESTAMP_GET();
+
+	status = ironside_se_periphconf_write(batch->entries, batch->count);
+
+	batch->stats.time += (uint32_t)(IRONSIDE_SE_TIMESTAMP_GET() - start);
+	batch->stats.calls++;
+
+	if (status.status <= 0) {
+		written_drop((uint8_t *)batch->entries, &batch->count,
+			     status.status == 0 ? batch->count : status.index,
+			     sizeof(struct periphconf_entry), &batch->stats);
+	}
+
+	return status;
+}
+
+int ironside_se_mpcconf_batch_init(struct ironside_se_mpcconf_batch *batch,
+				   struct mpcconf_entry *entries, struct mpcconf_entry *readback,
+				   size_t capacity)
+{
+	const size_t size = sizeof(struct mpcconf_entry) * capacity;
+
+	if (ironside_se_bounce_buffer_is_needed(entries, size) ||
+	    (readback != NULL && ironside_se_bounce_buffer_is_needed(readback, size))) {
+		return -IRONSIDE_SE_MPCCONF_ERROR_POINTER_UNALIGNED;
+	}
+
+	memset(batch, 0, sizeof(*batch));
+	batch->entries = entries;
+	batch->readback = readback;
+	batch->capacity = capacity;
+
+	return 0;
+}
+
+bool ironside_se_mpcconf_batch_add(struct ironside_se_mpcconf_batch *batch,
+				   const struct mpcconf_entry *entry)
+{
+	return entry_add((uint8_t *)batch->entries, &batch->count, batch->capacity,
+			 sizeof(struct mpcconf_entry), mpcconf_key_get, entry, &batch->stats);
+}
+
+struct ironside_se_mpcconf_status
+ironside_se_mpcconf_batch_readback(struct ironside_se_mpcconf_batch *batch)
+{
+	struct ironside_se_mpcconf_status status = { 0 };
+	size_t count = batch->count;
+
+	if (count == 0) {
+		return status;
+	}
+
+	count = readback_prepare((const uint8_t *)batch->entries, (uint8_t *)batch->readback, count,
+				 batch->capacity, sizeof(struct mpcconf_entry));
+
+	const uint32_t start = IRONSIDE_SE_TIMESTAMP_GET();
+
+	status = ironside_se_mpcconf_read(batch->readback, count);
+
+	batch->stats.time += (uint32_t)(IRONSIDE_SE_TIMESTAMP_GET() - start);
+	batch->stats.calls++;
+
+	if (status.status == 0) {
+		unchanged_drop((uint8_t *)batch->entries, (const uint8_t *)batch->readback,
+			       &batch->count, sizeof(struct mpcconf_entry), &batch->stats);
+	}
+
+	return status;
+}
+
+struct ironside_se_mpcconf_status
+ironside_se_mpcconf_batch_submit(struct ironside_se_mpcconf_batch *batch)
+{
+	struct ironside_se_mpcconf_status status = { 0 };
+
+	if (batch->count == 0) {
+		return status;
+	}
+
+	const uint32_t start = IRONSIDE_SE_TIMESTAMP_GET();
+
+	status = ironside_se_mpcconf_write(batch->entries, batch->count);
+
+	batch->stats.time += (uint32_t)(IRONSIDE_SE_TIMESTAMP_GET() - start);
+	batch->stats.calls++;
+
+	if (status.status <= 0) {
+		written_drop((uint8_t *)batch->entries, &batch->count,
+			     status.status == 0 ? batch->count : status.index,
+			     sizeof(struct mpcconf_entry), &batch->stats);
+	}
+
+	return status;
+}
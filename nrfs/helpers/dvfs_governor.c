@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "dvfs_governor.h"
+#include "dvfs_oppoint.h"
+
+/* Weight of the previous latency estimate in 1/4 units. */
+#define LATENCY_FILTER_WEIGHT 3
+
+static uint32_t freq_get(enum dvfs_frequency_setting opp)
+{
+	return get_frequency_for_frequency_setting(opp);
+}
+
+/* Lowest oppoint which runs the load (in MHz) below the given percentage of its frequency. */
+static enum dvfs_frequency_setting load_oppoint_get(uint64_t load_mhz, uint8_t threshold)
+{
+	for (int opp = DVFS_FREQ_COUNT - 1; opp > DVFS_FREQ_HIGH; opp--) {
+		if (load_mhz * 100 <= (uint64_t)freq_get(opp) * threshold) {
+			return (enum dvfs_frequency_setting)opp;
+		}
+	}
+
+	return DVFS_FREQ_HIGH;
+}
+
+/* Lowest oppoint which completes the work before the deadline. */
+static enum dvfs_frequency_setting deadline_oppoint_get(struct dvfs_governor *p_gov,
+							uint32_t now_us)
+{
+	int32_t remaining = (int32_t)(p_gov->deadline_us - now_us);
+
+	for (int opp = DVFS_FREQ_COUNT - 1; opp > DVFS_FREQ_HIGH; opp--) {
+		int32_t available = remaining;
+
+		/* Work runs at the current frequency until the oppoint change completes. */
+		if (opp != p_gov->current) {
+			available -= (int32_t)p_gov->latency_us;
+		}
+
+		if ((available > 0) &&
+		    ((uint64_t)p_gov->deadline_cycles <= (uint64_t)freq_get(opp) * available)) {
+			return (enum dvfs_frequency_setting)opp;
+		}
+	}
+
+	return DVFS_FREQ_HIGH;
+}
+
+static enum dvfs_frequency_setting target_get(struct dvfs_governor *p_gov, uint32_t now_us)
+{
+	enum dvfs_frequency_setting target = p_gov->current;
+
+	if (p_gov->window_us) {
+		uint64_t cycles = p_gov->window_cycles + p_gov->pending_cycles;
+		uint64_t load_mhz = (cycles + p_gov->window_us - 1) / p_gov->window_us;
+		enum dvfs_frequency_setting up = load_oppoint_get(load_mhz,
+								  p_gov->config.up_threshold);
+		enum dvfs_frequency_setting down = load_oppoint_get(load_mhz,
+								    p_gov->config.down_threshold);
+
+		if (up < p_gov->current) {
+			p_gov->down_cnt = 0;
+			target = up;
+		} else if (down > p_gov->current) {
+			if (p_gov->down_cnt < p_gov->config.down_hold) {
+				p_gov->down_cnt++;
+			} else {
+				target = down;
+			}
+		} else {
+			p_gov->down_cnt = 0;
+		}
+	}
+
+	if (p_gov->deadline_active) {
+		if ((int32_t)(p_gov->deadline_us - now_us) <= 0) {
+			p_gov->deadline_active = false;
+		} else {
+			enum dvfs_frequency_setting deadline = deadline_oppoint_get(p_gov, now_us);
+
+			if (deadline < target) {
+				target = deadline;
+			}
+		}
+	}
+
+	return target;
+}
+
+static nrfs_err_t evaluate(struct dvfs_governor *p_gov, uint32_t now_us)
+{
+	enum dvfs_frequency_setting target = target_get(p_gov, now_us);
+	nrfs_err_t err;
+
+	if (p_gov->in_progress || (target == p_gov->current)) {
+		return NRFS_SUCCESS;
+	}
+
+	p_gov->requested   = target;
+	p_gov->in_progress = true;
+	p_gov->scaling	   = false;
+	p_gov->request_us  = now_us;
+
+	err = nrfs_dvfs_oppoint_request(target, p_gov);
+	if (err != NRFS_SUCCESS) {
+		p_gov->in_progress = false;
+	}
+
+	return err;
+}
+
+static void request_done(struct dvfs_governor *p_gov, uint32_t now_us)
+{
+	uint32_t latency = now_us - p_gov->request_us;
+
+	p_gov->current	   = p_gov->requested;
+	p_gov->in_progress = false;
+	p_gov->down_cnt	   = 0;
+	p_gov->latency_us  = (p_gov->latency_us * LATENCY_FILTER_WEIGHT + latency) /
+			    (LATENCY_FILTER_WEIGHT + 1);
+}
+
+void dvfs_governor_init(struct dvfs_governor *p_gov,
+			const struct dvfs_governor_config *p_config,
+			enum dvfs_frequency_setting current)
+{
+	memset(p_gov, 0, sizeof(*p_gov));
+	p_gov->config	  = *p_config;
+	p_gov->current	  = current;
+	p_gov->requested  = current;
+	p_gov->latency_us = DVFS_GOVERNOR_LATENCY_INIT_US;
+}
+
+nrfs_err_t dvfs_governor_sample_add(struct dvfs_governor *p_gov, uint32_t busy_us,
+				    uint32_t idle_us, uint32_t now_us)
+{
+	struct dvfs_governor_sample *p_sample = &p_gov->window[p_gov->window_idx];
+
+	p_gov->window_cycles -= p_sample->busy_cycles;
+	p_gov->window_us -= p_sample->period_us;
+
+	p_sample->busy_cycles = busy_us * freq_get(p_gov->current);
+	p_sample->period_us   = busy_us + idle_us;
+
+	p_gov->window_cycles += p_sample->busy_cycles;
+	p_gov->window_us += p_sample->period_us;
+	p_gov->window_idx = (p_gov->window_idx + 1) % DVFS_GOVERNOR_WINDOW_SIZE;
+
+	return evaluate(p_gov, now_us);
+}
+
+void dvfs_governor_pending_work_set(struct dvfs_governor *p_gov, uint32_t cycles)
+{
+	p_gov->pending_cycles = cycles;
+}
+
+nrfs_err_t dvfs_governor_deadline_hint(struct dvfs_governor *p_gov, uint32_t cycles,
+				       uint32_t deadline_us, uint32_t now_us)
+{
+	p_gov->deadline_cycles = cycles;
+	p_gov->deadline_us     = deadline_us;
+	p_gov->deadline_active = true;
+
+	return evaluate(p_gov, now_us);
+}
+
+nrfs_err_t dvfs_governor_evt_handle(struct dvfs_governor *p_gov, nrfs_dvfs_evt_t const *p_evt,
+				    uint32_t now_us)
+{
+	if (!p_gov->in_progress) {
+		return NRFS_SUCCESS;
+	}
+
+	switch (p_evt->type) {
+	case NRFS_DVFS_EVT_REJECT:
+		/* Request is retried on the next sample. */
+		p_gov->in_progress = false;
+		return NRFS_SUCCESS;
+
+	case NRFS_DVFS_EVT_OPPOINT_SCALING_PREPARE:
+		p_gov->scaling = true;
+		return NRFS_SUCCESS;
+
+	case NRFS_DVFS_EVT_OPPOINT_REQ_CONFIRMED:
+		if (p_gov->scaling) {
+			return NRFS_SUCCESS;
+		}
+		break;
+
+	case NRFS_DVFS_EVT_OPPOINT_SCALING_DONE:
+		break;
+
+	default:
+		return NRFS_SUCCESS;
+	}
+
+	request_done(p_gov, now_us);
+
+	/* Load or deadline might have changed while the request was in progress. */
+	return evaluate(p_gov, now_us);
+}
+
+enum dvfs_frequency_setting dvfs_governor_current_get(const struct dvfs_governor *p_gov)
+{
+	return p_gov->current;
+}
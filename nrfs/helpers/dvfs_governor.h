@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef DVFS_GOVERNOR_H
+#define DVFS_GOVERNOR_H
+
+#include <nrfs_common.h>
+#include <nrfs_dvfs.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Number of load samples in the sliding window. */
+#ifndef DVFS_GOVERNOR_WINDOW_SIZE
+#define DVFS_GOVERNOR_WINDOW_SIZE 8
+#endif
+
+/** @brief Initial estimate of the oppoint change latency in microseconds. */
+#ifndef DVFS_GOVERNOR_LATENCY_INIT_US
+#define DVFS_GOVERNOR_LATENCY_INIT_US 1000
+#endif
+
+/** @brief DVFS governor configuration. */
+struct dvfs_governor_config {
+	uint8_t up_threshold;	/**< Load in percent of the oppoint frequency above which
+				 *   the oppoint is not sufficient.
+				 */
+	uint8_t down_threshold; /**< Load in percent of the lower oppoint frequency below which
+				 *   the lower oppoint is sufficient.
+				 */
+	uint8_t down_hold;	/**< Number of consecutive samples that must allow the lower
+				 *   oppoint before it is requested.
+				 */
+};
+
+/** @brief Load sample. */
+struct dvfs_governor_sample {
+	uint32_t busy_cycles;
+	uint32_t period_us;
+};
+
+/** @brief DVFS governor instance. */
+struct dvfs_governor {
+	struct dvfs_governor_config config;
+	struct dvfs_governor_sample window[DVFS_GOVERNOR_WINDOW_SIZE];
+	uint8_t window_idx;
+	uint64_t window_cycles;
+	uint64_t window_us;
+	uint32_t pending_cycles;
+	uint32_t deadline_cycles;
+	uint32_t deadline_us;
+	bool deadline_active;
+	uint8_t down_cnt;
+	enum dvfs_frequency_setting current;
+	enum dvfs_frequency_setting requested;
+	bool in_progress;
+	bool scaling;
+	uint32_t request_us;
+	uint32_t latency_us;
+};
+
+/**
+ * @brief Initialize the DVFS governor.
+ *
+ * Governor decides on the oppoint based on the CPU load and requests it using
+ * @ref nrfs_dvfs_oppoint_request. Only one request is in progress at a time.
+ * All governor functions must be called from the same execution context.
+ *
+ * @param p_gov    pointer to the governor instance.
+ * @param p_config pointer to the configuration.
+ * @param current  oppoint in use.
+ */
+void dvfs_governor_init(struct dvfs_governor *p_gov,
+			const struct dvfs_governor_config *p_config,
+			enum dvfs_frequency_setting current);
+
+/**
+ * @brief Add a load sample and reevaluate the oppoint.
+ *
+ * @param p_gov   pointer to the governor instance.
+ * @param busy_us time in microseconds the CPU was not idle since the previous sample.
+ * @param idle_us time in microseconds the CPU was idle since the previous sample.
+ * @param now_us  current time in microseconds.
+ *
+ * @return NRFS_SUCCESS or the error returned by @ref nrfs_dvfs_oppoint_request.
+ */
+nrfs_err_t dvfs_governor_sample_add(struct dvfs_governor *p_gov, uint32_t busy_us,
+				    uint32_t idle_us, uint32_t now_us);
+
+/**
+ * @brief Set the hint about the work queued for execution.
+ *
+ * Pending work is added to the load of the last window until the next hint.
+ *
+ * @param p_gov  pointer to the governor instance.
+ * @param cycles number of CPU cycles (in MHz * us) needed to complete the pending work.
+ */
+void dvfs_governor_pending_work_set(struct dvfs_governor *p_gov, uint32_t cycles);
+
+/**
+ * @brief Announce the work that must be completed before the deadline.
+ *
+ * Governor requests the oppoint which completes @p cycles before @p deadline_us taking
+ * into account the measured oppoint change latency. The deadline hint is dropped after
+ * the deadline has passed.
+ *
+ * @param p_gov       pointer to the governor instance.
+ * @param cycles      number of CPU cycles (in MHz * us) needed to complete the work.
+ * @param deadline_us time in microseconds when the work must be completed.
+ * @param now_us      current time in microseconds.
+ *
+ * @return NRFS_SUCCESS or the error returned by @ref nrfs_dvfs_oppoint_request.
+ */
+nrfs_err_t dvfs_governor_deadline_hint(struct dvfs_governor *p_gov, uint32_t cycles,
+				       uint32_t deadline_us, uint32_t now_us);
+
+/**
+ * @brief Pass the DVFS service event to the governor.
+ *
+ * Must be called for the events of the requests made by the governor, that is the events
+ * with the governor instance as a context. Handling of
+ * @ref NRFS_DVFS_EVT_OPPOINT_SCALING_PREPARE (@ref nrfs_dvfs_ready_to_scale) remains the
+ * responsibility of the caller, and its latency is included in the latency measured
+ * by the governor.
+ *
+ * @param p_gov  pointer to the governor instance.
+ * @param p_evt  pointer to the event.
+ * @param now_us current time in microseconds.
+ *
+ * @return NRFS_SUCCESS or the error returned by @ref nrfs_dvfs_oppoint_request.
+ */
+nrfs_err_t dvfs_governor_evt_handle(struct dvfs_governor *p_gov, nrfs_dvfs_evt_t const *p_evt,
+				    uint32_t now_us);
+
+/**
+ * @brief Get the oppoint currently in use.
+ *
+ * @param p_gov pointer to the governor instance.
+ * @return enum dvfs_frequency_setting oppoint in use.
+ */
+enum dvfs_frequency_setting dvfs_governor_current_get(const struct dvfs_governor *p_gov);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DVFS_GOVERNOR_H */
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <nrfs_mram.h>
+#include <nrfs_gdpwr.h>
+#include <nrfs_dvfs.h>
+#include "nrfs_vote.h"
+
+static nrfs_vote_t *m_p_votes;
+
+void nrfs_vote_init(nrfs_vote_t *p_vote, nrfs_vote_apply_t apply, uint32_t param,
+		    void *p_context)
+{
+	for (uint8_t i = 0; i < NRFS_VOTE_LEVELS_MAX; i++) {
+		p_vote->votes[i] = 0;
+	}
+
+	p_vote->apply	  = apply;
+	p_vote->param	  = param;
+	p_vote->p_context = p_context;
+	p_vote->applied	  = 0;
+	p_vote->pending	  = false;
+	p_vote->p_next	  = m_p_votes;
+	m_p_votes	  = p_vote;
+}
+
+uint8_t nrfs_vote_level_get(nrfs_vote_t const *p_vote)
+{
+	for (uint8_t i = NRFS_VOTE_LEVELS_MAX - 1; i > 0; i--) {
+		if (__atomic_load_n(&p_vote->votes[i], __ATOMIC_ACQUIRE) != 0) {
+			return i;
+		}
+	}
+
+	return 0;
+}
+
+static void vote_changed(nrfs_vote_t *p_vote)
+{
+	/* Request a flush only once per burst of changes. */
+	if (!__atomic_exchange_n(&p_vote->pending, true, __ATOMIC_ACQ_REL)) {
+		nrfs_vote_flush_request();
+	}
+}
+
+void nrfs_vote_add(nrfs_vote_t *p_vote, uint8_t level)
+{
+	if (level >= NRFS_VOTE_LEVELS_MAX) {
+		return;
+	}
+
+	/* Aggregated level can change only when the first vote for a level is added. */
+	if (__atomic_fetch_add(&p_vote->votes[level], 1, __ATOMIC_ACQ_REL) == 0) {
+		vote_changed(p_vote);
+	}
+}
+
+nrfs_err_t nrfs_vote_remove(nrfs_vote_t *p_vote, uint8_t level)
+{
+	if (level >= NRFS_VOTE_LEVELS_MAX) {
+		return NRFS_ERR_INVALID_STATE;
+	}
+
+	uint16_t count = __atomic_load_n(&p_vote->votes[level], __ATOMIC_ACQUIRE);
+
+	/* Decrement only if there is a vote to remove, so that the count never wraps. */
+	do {
+		if (count == 0) {
+			return NRFS_ERR_INVALID_STATE;
+		}
+	} while (!__atomic_compare_exchange_n(&p_vote->votes[level], &count, count - 1, false,
+					      __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+
+	/* Aggregated level can change only when the last vote for a level is removed. */
+	if (count == 1) {
+		vote_changed(p_vote);
+	}
+
+	return NRFS_SUCCESS;
+}
+
+nrfs_err_t nrfs_vote_flush(void)
+{
+	nrfs_err_t ret = NRFS_SUCCESS;
+
+	for (nrfs_vote_t *p_vote = m_p_votes; p_vote != NULL; p_vote = p_vote->p_next) {
+		if (!__atomic_exchange_n(&p_vote->pending, false, __ATOMIC_ACQ_REL)) {
+			continue;
+		}
+
+		uint8_t level = nrfs_vote_level_get(p_vote);
+
+		if (level == p_vote->applied) {
+			/* Votes changed but returned to the applied level within the burst. */
+			continue;
+		}
+
+		nrfs_err_t err = p_vote->apply(p_vote, level);
+
+		if (err == NRFS_SUCCESS) {
+			p_vote->applied = level;
+		} else {
+			/* Keep the resource pending so that the request is repeated. */
+			__atomic_store_n(&p_vote->pending, true, __ATOMIC_RELEASE);
+			if (ret == NRFS_SUCCESS) {
+				ret = err;
+			}
+		}
+	}
+
+	if (ret != NRFS_SUCCESS) {
+		/* Pending resources do not request a flush on a vote change, so request it here. */
+		nrfs_vote_flush_request();
+	}
+
+	return ret;
+}
+
+nrfs_err_t nrfs_vote_mram_latency_apply(nrfs_vote_t const *p_vote, uint8_t level)
+{
+	return nrfs_mram_set_latency((level != 0) ? MRAM_LATENCY_NOT_ALLOWED :
+						    MRAM_LATENCY_ALLOWED,
+				     p_vote->p_context);
+}
+
+nrfs_err_t nrfs_vote_gdpwr_apply(nrfs_vote_t const *p_vote, uint8_t level)
+{
+	return nrfs_gdpwr_power_request((gdpwr_power_domain_t)p_vote->param,
+					(level != 0) ? GDPWR_POWER_REQUEST_SET :
+						       GDPWR_POWER_REQUEST_CLEAR,
+					p_vote->p_context);
+}
+
+nrfs_err_t nrfs_vote_dvfs_apply(nrfs_vote_t const *p_vote, uint8_t level)
+{
+	if (level >= DVFS_FREQ_COUNT) {
+		level = DVFS_FREQ_COUNT - 1;
+	}
+
+	return nrfs_dvfs_oppoint_request((enum dvfs_frequency_setting)(DVFS_FREQ_LOW - level),
+					 p_vote->p_context);
+}
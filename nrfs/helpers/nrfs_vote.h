@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef NRFS_VOTE_H
+#define NRFS_VOTE_H
+
+#include <nrfs_common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Maximum number of levels of a voted resource. */
+#define NRFS_VOTE_LEVELS_MAX 4
+
+typedef struct nrfs_vote nrfs_vote_t;
+
+/**
+ * @brief Function type for sending the aggregated level of the resource to the System Controller.
+ *
+ * @param[in] p_vote Voted resource.
+ * @param[in] level  Aggregated level to be applied.
+ *
+ * @retval NRFS_SUCCESS Request sent successfully.
+ * @retval other        Request not sent. It will be repeated on the next flush, which is
+ *                      requested with @ref nrfs_vote_flush_request.
+ */
+typedef nrfs_err_t (*nrfs_vote_apply_t)(nrfs_vote_t const *p_vote, uint8_t level);
+
+/**
+ * @brief Voted resource.
+ *
+ * Users vote for a level of the resource. Aggregated level is the highest level that has
+ * at least one vote, or 0 when there are no votes. Level 0 is the state of the resource
+ * assumed at initialization.
+ *
+ * @note Fields are internal and shall not be accessed directly.
+ */
+struct nrfs_vote {
+	nrfs_vote_apply_t apply;		/**< Function sending the aggregated level. */
+	uint32_t param;				/**< Parameter of the resource, for example power domain. */
+	void *p_context;			/**< Context passed to the service request. */
+	uint16_t votes[NRFS_VOTE_LEVELS_MAX];	/**< Number of votes for each level. */
+	uint8_t applied;			/**< Level applied at the System Controller. */
+	bool pending;				/**< Votes changed since the last flush. */
+	nrfs_vote_t *p_next;			/**< Next registered resource. */
+};
+
+/**
+ * @brief Function for requesting a flush of the changed votes.
+ *
+ * The function is called when the aggregated level of any resource changes and when
+ * a request fails in @ref nrfs_vote_flush. It must be implemented by the platform and
+ * shall schedule the @ref nrfs_vote_flush call in a deferred context, for example a work
+ * queue item. All vote changes made before the flush is executed are merged into a single
+ * request per resource.
+ */
+void nrfs_vote_flush_request(void);
+
+/**
+ * @brief Function for registering a voted resource.
+ *
+ * Function shall be called before any vote for the resource is added and
+ * not concurrently with @ref nrfs_vote_flush.
+ *
+ * @param[out] p_vote    Voted resource.
+ * @param[in]  apply     Function sending the aggregated level of the resource.
+ * @param[in]  param     Parameter of the resource passed to @p apply.
+ * @param[in]  p_context Opaque user data passed to the service request.
+ */
+void nrfs_vote_init(nrfs_vote_t *p_vote, nrfs_vote_apply_t apply, uint32_t param,
+		    void *p_context);
+
+/**
+ * @brief Function for adding a vote for the level of the resource.
+ *
+ * Function can be called from any context.
+ *
+ * @param[in] p_vote Voted resource.
+ * @param[in] level  Level. Must be lower than @ref NRFS_VOTE_LEVELS_MAX.
+ */
+void nrfs_vote_add(nrfs_vote_t *p_vote, uint8_t level);
+
+/**
+ * @brief Function for removing a vote for the level of the resource.
+ *
+ * Function can be called from any context.
+ *
+ * @param[in] p_vote Voted resource.
+ * @param[in] level  Level previously passed to @ref nrfs_vote_add.
+ *
+ * @retval NRFS_SUCCESS           The vote was removed.
+ * @retval NRFS_ERR_INVALID_STATE There is no vote for @p level to remove.
+ */
+nrfs_err_t nrfs_vote_remove(nrfs_vote_t *p_vote, uint8_t level);
+
+/**
+ * @brief Function for getting the aggregated level of the resource.
+ *
+ * @param[in] p_vote Voted resource.
+ *
+ * @return Highest level with at least one vote, or 0 when there are no votes.
+ */
+uint8_t nrfs_vote_level_get(nrfs_vote_t const *p_vote);
+
+/**
+ * @brief Function for sending requests for the resources which aggregated level changed.
+ *
+ * Request is sent only if the aggregated level differs from the level that was last
+ * applied. Function shall be called from a single context.
+ *
+ * @retval NRFS_SUCCESS All requests sent successfully.
+ * @retval other        Error of the first failed request. Another flush is requested
+ *                      with @ref nrfs_vote_flush_request and failed requests are repeated
+ *                      on it.
+ */
+nrfs_err_t nrfs_vote_flush(void);
+
+/**
+ * @brief Apply function for the MRAM latency.
+ *
+ * Level 0 corresponds to @ref MRAM_LATENCY_ALLOWED and level 1 to
+ * @ref MRAM_LATENCY_NOT_ALLOWED. @p param is not used.
+ */
+nrfs_err_t nrfs_vote_mram_latency_apply(nrfs_vote_t const *p_vote, uint8_t level);
+
+/**
+ * @brief Apply function for the global domain power request.
+ *
+ * Level 0 clears and level 1 sets the power request. @p param is the power domain
+ * (@ref gdpwr_power_domain_t).
+ */
+nrfs_err_t nrfs_vote_gdpwr_apply(nrfs_vote_t const *p_vote, uint8_t level);
+
+/**
+ * @brief Apply function for the DVFS operating point.
+ *
+ * Level 0 corresponds to @ref DVFS_FREQ_LOW, level 1 to @ref DVFS_FREQ_MEDLOW and level 2
+ * to @ref DVFS_FREQ_HIGH. @p param is not used.
+ */
+nrfs_err_t nrfs_vote_dvfs_apply(nrfs_vote_t const *p_vote, uint8_t level);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRFS_VOTE_H */
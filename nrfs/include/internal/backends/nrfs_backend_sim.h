@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef NRFS_BACKEND_SIM_H
+#define NRFS_BACKEND_SIM_H
+
+#include <nrfs_common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Simulated System Controller backend.
+ *
+ * Implementation of @ref nrfs_backend_send intended for running nrfs on a host. Requests are
+ * answered by a simulated System Controller after a configurable delay. Responses are
+ * passed to @ref nrfs_dispatcher_notify from @ref nrfs_backend_sim_tick in the order
+ * of their delivery time, which allows out-of-order responses when delays differ.
+ */
+
+/** @brief Maximum number of responses waiting for delivery. */
+#ifndef NRFS_BACKEND_SIM_QUEUE_SIZE
+#define NRFS_BACKEND_SIM_QUEUE_SIZE 16
+#endif
+
+/** @brief Maximum size of a message. */
+#ifndef NRFS_BACKEND_SIM_MSG_SIZE_MAX
+#define NRFS_BACKEND_SIM_MSG_SIZE_MAX 64
+#endif
+
+/**
+ * @brief Simulated System Controller request handler type.
+ *
+ * Handler is called for each request that expects a response. Response is initialized
+ * with the copy of the request so that the header and the context are already in place.
+ *
+ * @param[in,out] p_msg   Response. Handler may fill the service data or set the error flag
+ *                        in the header (@ref NRFS_HDR_FILTER_ERR_SET).
+ * @param[in,out] p_size  Size of the response.
+ * @param[in,out] p_delay Delay of the response. Initialized with the default delay.
+ *
+ * @retval true  Response shall be sent.
+ * @retval false Response shall be dropped.
+ */
+typedef bool (*nrfs_backend_sim_handler_t)(void *p_msg, size_t *p_size, uint32_t *p_delay);
+
+/**
+ * @brief Function for resetting the simulator.
+ *
+ * Pending responses are dropped, time is set to 0 and the configuration is restored to
+ * the default one: no delay, no rejections and no handler.
+ */
+void nrfs_backend_sim_reset(void);
+
+/**
+ * @brief Function for setting the default response delay.
+ *
+ * @param[in] delay Delay in the simulator time units.
+ */
+void nrfs_backend_sim_delay_set(uint32_t delay);
+
+/**
+ * @brief Function for setting the request handler.
+ *
+ * @param[in] handler Handler or NULL to send the default responses.
+ */
+void nrfs_backend_sim_handler_set(nrfs_backend_sim_handler_t handler);
+
+/**
+ * @brief Function for rejecting the next requests.
+ *
+ * Responses to the next @p count requests have the error flag set.
+ *
+ * @param[in] count Number of requests to be rejected.
+ */
+void nrfs_backend_sim_reject_next(uint32_t count);
+
+/**
+ * @brief Function for advancing the simulator time.
+ *
+ * All responses which delivery time has passed are delivered to the dispatcher.
+ *
+ * @param[in] elapsed Time elapsed since the previous call.
+ *
+ * @return Number of delivered responses.
+ */
+uint32_t nrfs_backend_sim_tick(uint32_t elapsed);
+
+/**
+ * @brief Function for getting the number of responses waiting for delivery.
+ *
+ * @return Number of pending responses.
+ */
+uint32_t nrfs_backend_sim_pending_get(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRFS_BACKEND_SIM_H */
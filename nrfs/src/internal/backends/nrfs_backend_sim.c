@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <internal/nrfs_backend.h>
+#include <internal/nrfs_dispatcher.h>
+#include <internal/nrfs_hdr.h>
+#include <internal/backends/nrfs_backend_sim.h>
+
+typedef struct {
+	uint8_t msg[NRFS_BACKEND_SIM_MSG_SIZE_MAX];
+	size_t size;
+	uint32_t time;
+	uint32_t seq;
+} nrfs_backend_sim_rsp_t;
+
+typedef struct {
+	nrfs_backend_sim_rsp_t queue[NRFS_BACKEND_SIM_QUEUE_SIZE];
+	uint32_t count;
+	uint32_t time;
+	uint32_t seq;
+	uint32_t delay;
+	uint32_t reject_cnt;
+	nrfs_backend_sim_handler_t handler;
+} nrfs_backend_sim_cb_t;
+static nrfs_backend_sim_cb_t m_cb;
+
+void nrfs_backend_sim_reset(void)
+{
+	memset(&m_cb, 0, sizeof(m_cb));
+}
+
+void nrfs_backend_sim_delay_set(uint32_t delay)
+{
+	m_cb.delay = delay;
+}
+
+void nrfs_backend_sim_handler_set(nrfs_backend_sim_handler_t handler)
+{
+	m_cb.handler = handler;
+}
+
+void nrfs_backend_sim_reject_next(uint32_t count)
+{
+	m_cb.reject_cnt = count;
+}
+
+uint32_t nrfs_backend_sim_pending_get(void)
+{
+	return m_cb.count;
+}
+
+nrfs_err_t nrfs_backend_send(void *message, size_t size)
+{
+	nrfs_hdr_t *p_hdr = (nrfs_hdr_t *)message;
+
+	if ((size > NRFS_BACKEND_SIM_MSG_SIZE_MAX) || (size < sizeof(nrfs_hdr_t))) {
+		return NRFS_ERR_IPC;
+	}
+
+	if (NRFS_HDR_NO_RSP_GET(p_hdr)) {
+		return NRFS_SUCCESS;
+	}
+
+	if (m_cb.count == NRFS_BACKEND_SIM_QUEUE_SIZE) {
+		return NRFS_ERR_IPC;
+	}
+
+	nrfs_backend_sim_rsp_t *p_rsp = &m_cb.queue[m_cb.count];
+	uint32_t delay = m_cb.delay;
+
+	memcpy(p_rsp->msg, message, size);
+	p_rsp->size = size;
+
+	if (m_cb.reject_cnt > 0) {
+		m_cb.reject_cnt--;
+		NRFS_HDR_FILTER_ERR_SET((nrfs_hdr_t *)p_rsp->msg);
+	}
+
+	if (m_cb.handler && !m_cb.handler(p_rsp->msg, &p_rsp->size, &delay)) {
+		return NRFS_SUCCESS;
+	}
+
+	p_rsp->time = m_cb.time + delay;
+	p_rsp->seq  = m_cb.seq++;
+	m_cb.count++;
+
+	return NRFS_SUCCESS;
+}
+
+/* Find the response to be delivered first: the earliest one, in the order of sending. */
+static int32_t next_rsp_get(void)
+{
+	int32_t idx = -1;
+
+	for (uint32_t i = 0; i < m_cb.count; i++) {
+		nrfs_backend_sim_rsp_t *p_rsp = &m_cb.queue[i];
+
+		if ((int32_t)(p_rsp->time - m_cb.time) > 0) {
+			continue;
+		}
+
+		if ((idx < 0) || ((int32_t)(p_rsp->time - m_cb.queue[idx].time) < 0) ||
+		    ((p_rsp->time == m_cb.queue[idx].time) &&
+		     ((int32_t)(p_rsp->seq - m_cb.queue[idx].seq) < 0))) {
+			idx = (int32_t)i;
+		}
+	}
+
+	return idx;
+}
+
+uint32_t nrfs_backend_sim_tick(uint32_t elapsed)
+{
+	nrfs_backend_sim_rsp_t rsp;
+	uint32_t delivered = 0;
+	int32_t idx;
+
+	m_cb.time += elapsed;
+
+	while ((idx = next_rsp_get()) >= 0) {
+		/* Remove the response from the queue before the notification, since
+		 * the service handler may send another request.
+		 */
+		rsp = m_cb.queue[idx];
+		m_cb.queue[idx] = m_cb.queue[--m_cb.count];
+
+		nrfs_dispatcher_notify(rsp.msg, rsp.size);
+		delivered++;
+	}
+
+	return delivered;
+}
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef NRFS_CONFIG_H
+#define NRFS_CONFIG_H
+
+/* All services are enabled in the host build. */
+#define NRFS_TEMP_SERVICE_ENABLED
+#define NRFS_MRAM_SERVICE_ENABLED
+#define NRFS_RESET_SERVICE_ENABLED
+#define NRFS_VBUS_DETECTOR_SERVICE_ENABLED
+#define NRFS_PMIC_SERVICE_ENABLED
+#define NRFS_DVFS_SERVICE_ENABLED
+#define NRFS_DIAG_SERVICE_ENABLED
+#define NRFS_CLOCK_SERVICE_ENABLED
+#define NRFS_GDPWR_SERVICE_ENABLED
+#define NRFS_GDFS_SERVICE_ENABLED
+#define NRFS_SWEXT_SERVICE_ENABLED
+#define NRFS_AUDIOPLL_SERVICE_ENABLED
+#define NRFS_GSWDT_SERVICE_ENABLED
+
+#define NRFS_UNIT_TESTS_ENABLED
+
+#endif /* NRFS_CONFIG_H */
@@ -0,0 +1,515 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host test of nrfs running on the simulated System Controller backend.
+ *
+ * Every service is driven through a request/response round trip, a rejected request and
+ * a dropped response. Out-of-order delivery is checked with per-request delays and voting
+ * with a burst of votes. Finally, request throughput and the time of delivering a response
+ * (simulator queue, dispatcher and service handler) are measured for each service.
+ * The DVFS governor helper is simulated with synthetic load traces at the end.
+ *
+ * Build and run from the nrfs directory:
+ *
+ *	cc -O2 -Itests/host -Iinclude -Iinclude/services -Ihelpers \
+ *	   tests/host/nrfs_*.c src/internal/nrfs_dispatcher.c \
+ *	   src/internal/backends/nrfs_backend_sim.c src/services/nrfs_*.c \
+ *	   helpers/dvfs_*.c helpers/nrfs_vote.c \
+ *	   -o nrfs_host_test && ./nrfs_host_test
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <internal/backends/nrfs_backend_sim.h>
+#include <nrfs_audiopll.h>
+#include <nrfs_clock.h>
+#include <nrfs_diag.h>
+#include <nrfs_dvfs.h>
+#include <nrfs_gdfs.h>
+#include <nrfs_gdpwr.h>
+#include <nrfs_gswdt.h>
+#include <nrfs_mram.h>
+#include <nrfs_pmic.h>
+#include <nrfs_reset.h>
+#include <nrfs_swext.h>
+#include <nrfs_temp.h>
+#include <nrfs_usb.h>
+#include <nrfs_vote.h>
+#include "nrfs_host_test.h"
+
+#define DELAY		   10
+#define BENCH_REQUESTS 100000
+#define CTX_MAX		   16
+
+/* Contexts are passed as small integers since the request holds only 32 bits of them. */
+#define CTX(n) ((void *)(uintptr_t)(n))
+
+uint32_t nrfs_host_test_failures;
+
+static struct {
+	uint32_t count;
+	uint8_t type;
+	uintptr_t ctx[CTX_MAX];
+} m_evt;
+
+static void evt_record(void const *p_evt, void *p_context)
+{
+	/* All event structures start with a single byte event type. */
+	m_evt.type = *(uint8_t const *)p_evt;
+	if (m_evt.count < CTX_MAX) {
+		m_evt.ctx[m_evt.count] = (uintptr_t)p_context;
+	}
+	m_evt.count++;
+}
+
+static void evt_clear(void)
+{
+	memset(&m_evt, 0, sizeof(m_evt));
+}
+
+#define EVT_HANDLER(_name, _evt_type)                                                         \
+	static void _name##_handler(_evt_type const *p_evt, void *p_context)                  \
+	{                                                                                      \
+		evt_record(p_evt, p_context);                                                  \
+	}
+
+EVT_HANDLER(temp, nrfs_temp_evt_t)
+EVT_HANDLER(mram, nrfs_mram_latency_evt_t)
+EVT_HANDLER(usb, nrfs_usb_evt_t)
+EVT_HANDLER(pmic, void)
+EVT_HANDLER(dvfs, nrfs_dvfs_evt_t)
+EVT_HANDLER(diag, nrfs_diag_evt_t)
+EVT_HANDLER(clock, nrfs_clock_evt_t)
+EVT_HANDLER(gdpwr, nrfs_gdpwr_evt_t)
+EVT_HANDLER(gdfs, nrfs_gdfs_evt_t)
+EVT_HANDLER(swext, nrfs_swext_evt_t)
+EVT_HANDLER(audiopll, nrfs_audiopll_evt_t)
+EVT_HANDLER(gswdt, nrfs_gswdt_evt_t)
+
+static void reset_handler(nrfs_reset_evt_t const *p_evt)
+{
+	evt_record(p_evt, NULL);
+}
+
+static nrfs_err_t temp_init(void)
+{
+	return nrfs_temp_init(temp_handler);
+}
+
+static nrfs_err_t temp_request(void *p_context)
+{
+	return nrfs_temp_measure_request(p_context);
+}
+
+static nrfs_err_t mram_init(void)
+{
+	return nrfs_mram_init(mram_handler);
+}
+
+static nrfs_err_t mram_request(void *p_context)
+{
+	return nrfs_mram_set_latency(MRAM_LATENCY_NOT_ALLOWED, p_context);
+}
+
+static nrfs_err_t reset_init(void)
+{
+	return nrfs_reset_init(reset_handler);
+}
+
+static nrfs_err_t reset_request(void *p_context)
+{
+	(void)p_context;
+	return nrfs_request_reset();
+}
+
+static nrfs_err_t usb_init(void)
+{
+	return nrfs_usb_init(usb_handler);
+}
+
+static nrfs_err_t usb_request(void *p_context)
+{
+	return nrfs_usb_enable_request(p_context);
+}
+
+static nrfs_err_t pmic_init(void)
+{
+	return nrfs_pmic_init(pmic_handler);
+}
+
+static nrfs_err_t pmic_request(void *p_context)
+{
+	return nrfs_pmic_rffe_on(p_context);
+}
+
+static nrfs_err_t dvfs_init(void)
+{
+	return nrfs_dvfs_init(dvfs_handler);
+}
+
+static nrfs_err_t dvfs_request(void *p_context)
+{
+	return nrfs_dvfs_oppoint_request(DVFS_FREQ_MEDLOW, p_context);
+}
+
+static nrfs_err_t diag_init(void)
+{
+	return nrfs_diag_init(diag_handler);
+}
+
+static nrfs_err_t diag_request(void *p_context)
+{
+	return nrfs_diag_reg_read(0x52000000UL, p_context);
+}
+
+static nrfs_err_t clock_init(void)
+{
+	return nrfs_clock_init(clock_handler);
+}
+
+static nrfs_err_t clock_request(void *p_context)
+{
+	return nrfs_clock_lfclk_src_set(NRFS_CLOCK_SRC_LFCLK_DEFAULT, p_context);
+}
+
+static nrfs_err_t gdpwr_init(void)
+{
+	return nrfs_gdpwr_init(gdpwr_handler);
+}
+
+static nrfs_err_t gdpwr_request(void *p_context)
+{
+	return nrfs_gdpwr_power_request(GDPWR_GD_FAST_ACTIVE_0, GDPWR_POWER_REQUEST_SET, p_context);
+}
+
+static nrfs_err_t gdfs_init(void)
+{
+	return nrfs_gdfs_init(gdfs_handler);
+}
+
+static nrfs_err_t gdfs_request(void *p_context)
+{
+	return nrfs_gdfs_request_freq(GDFS_FREQ_MEDLOW, p_context);
+}
+
+static nrfs_err_t swext_init(void)
+{
+	return nrfs_swext_init(swext_handler);
+}
+
+static nrfs_err_t swext_request(void *p_context)
+{
+	return nrfs_swext_power_up(10, p_context);
+}
+
+/* Event type of the service depends on the status in the response. */
+static bool swext_respond(void *p_msg, size_t *p_size, uint32_t *p_delay)
+{
+	nrfs_swext_rsp_t *p_rsp = (nrfs_swext_rsp_t *)p_msg;
+
+	(void)p_delay;
+	p_rsp->status = SWEXT_OUTPUT_ENABLED;
+	*p_size = sizeof(*p_rsp);
+	return true;
+}
+
+static nrfs_err_t audiopll_init(void)
+{
+	return nrfs_audiopll_init(audiopll_handler);
+}
+
+static nrfs_err_t audiopll_request(void *p_context)
+{
+	return nrfs_audiopll_enable_request(p_context);
+}
+
+static nrfs_err_t gswdt_init(void)
+{
+	return nrfs_gswdt_init(gswdt_handler);
+}
+
+static nrfs_err_t gswdt_request(void *p_context)
+{
+	return nrfs_gswdt_timeout_rsp_set(1000, p_context, true);
+}
+
+typedef struct {
+	const char *name;
+	nrfs_err_t (*init)(void);
+	void (*uninit)(void);
+	nrfs_err_t (*request)(void *p_context);
+	nrfs_backend_sim_handler_t respond; /* Fills the response if the echoed request is not enough. */
+	uint8_t reject_type;
+	bool has_ctx;
+} service_t;
+
+#define SERVICE(_name, _respond, _reject_type, _has_ctx)                                     \
+	{                                                                                      \
+		.name = #_name, .init = _name##_init, .uninit = nrfs_##_name##_uninit,          \
+		.request = _name##_request, .respond = _respond, .reject_type = _reject_type,   \
+		.has_ctx = _has_ctx,                                                           \
+	}
+
+static const service_t services[] = {
+	SERVICE(temp, NULL, NRFS_TEMP_EVT_REJECT, true),
+	SERVICE(mram, NULL, NRFS_MRAM_LATENCY_REQ_REJECTED, true),
+	SERVICE(reset, NULL, NRFS_RESET_EVT_REJECT, false),
+	SERVICE(usb, NULL, NRFS_USB_EVT_REJECT, true),
+	SERVICE(pmic, NULL, NRFS_PMIC_EVT_REJECT, true),
+	SERVICE(dvfs, NULL, NRFS_DVFS_EVT_REJECT, true),
+	SERVICE(diag, NULL, NRFS_DIAG_EVT_REJECT, true),
+	SERVICE(clock, NULL, NRFS_CLOCK_EVT_REJECT, true),
+	SERVICE(gdpwr, NULL, NRFS_GDPWR_REQ_REJECTED, true),
+	SERVICE(gdfs, NULL, NRFS_GDFS_EVT_REJECT, true),
+	SERVICE(swext, swext_respond, NRFS_SWEXT_EVT_REJECTED, true),
+	SERVICE(audiopll, NULL, NRFS_AUDIOPLL_EVT_REJECT, true),
+	SERVICE(gswdt, NULL, NRFS_GSWDT_EVT_REJECT, true),
+};
+
+static uint32_t m_flush_requests;
+
+void nrfs_vote_flush_request(void)
+{
+	m_flush_requests++;
+}
+
+static void test_vote(void)
+{
+	nrfs_vote_t vote;
+
+	nrfs_backend_sim_reset();
+	evt_clear();
+	m_flush_requests = 0;
+
+	nrfs_vote_init(&vote, nrfs_vote_mram_latency_apply, 0, CTX(9));
+
+	/* A burst of votes results in a single flush request and a single service request. */
+	nrfs_vote_add(&vote, 1);
+	nrfs_vote_add(&vote, 1);
+	nrfs_vote_add(&vote, 2);
+	CHECK(m_flush_requests == 1);
+	CHECK(nrfs_vote_level_get(&vote) == 2);
+	CHECK(nrfs_vote_flush() == NRFS_SUCCESS);
+	CHECK(nrfs_backend_sim_tick(0) == 1);
+	CHECK((m_evt.count == 1) && (m_evt.ctx[0] == 9));
+
+	/* Votes returning to the applied level within a burst are not sent. */
+	CHECK(nrfs_vote_remove(&vote, 2) == NRFS_SUCCESS);
+	nrfs_vote_add(&vote, 2);
+	CHECK(nrfs_vote_flush() == NRFS_SUCCESS);
+	CHECK(nrfs_backend_sim_pending_get() == 0);
+
+	/* Failed request is repeated on the next flush. */
+	CHECK(nrfs_vote_remove(&vote, 2) == NRFS_SUCCESS);
+	CHECK(nrfs_vote_remove(&vote, 1) == NRFS_SUCCESS);
+	CHECK(nrfs_vote_remove(&vote, 1) == NRFS_SUCCESS);
+	for (uint32_t i = 0; i < NRFS_BACKEND_SIM_QUEUE_SIZE; i++) {
+		(void)mram_request(CTX(0));
+	}
+	m_flush_requests = 0;
+	CHECK(nrfs_vote_flush() == NRFS_ERR_IPC);
+	CHECK(m_flush_requests == 1);
+	CHECK(nrfs_backend_sim_tick(0) == NRFS_BACKEND_SIM_QUEUE_SIZE);
+	CHECK(nrfs_vote_flush() == NRFS_SUCCESS);
+	CHECK(nrfs_backend_sim_pending_get() == 1);
+	CHECK(nrfs_vote_level_get(&vote) == 0);
+
+	/* Unbalanced remove is refused and does not wrap the vote count. */
+	m_flush_requests = 0;
+	CHECK(nrfs_vote_remove(&vote, 1) == NRFS_ERR_INVALID_STATE);
+	CHECK(nrfs_vote_remove(&vote, NRFS_VOTE_LEVELS_MAX) == NRFS_ERR_INVALID_STATE);
+	CHECK(nrfs_vote_level_get(&vote) == 0);
+	CHECK(m_flush_requests == 0);
+}
+
+static void test_round_trip(const service_t *p_srv)
+{
+	nrfs_backend_sim_reset();
+	nrfs_backend_sim_handler_set(p_srv->respond);
+	nrfs_backend_sim_delay_set(DELAY);
+	evt_clear();
+
+	CHECK(p_srv->request(CTX(7)) == NRFS_SUCCESS);
+	CHECK(nrfs_backend_sim_pending_get() == 1);
+
+	/* Response is not delivered before its delay passes. */
+	CHECK(nrfs_backend_sim_tick(DELAY - 1) == 0);
+	CHECK(m_evt.count == 0);
+
+	CHECK(nrfs_backend_sim_tick(1) == 1);
+	CHECK(m_evt.count == 1);
+	CHECK(m_evt.type != p_srv->reject_type);
+	CHECK(!p_srv->has_ctx || (m_evt.ctx[0] == 7));
+}
+
+static void test_reject(const service_t *p_srv)
+{
+	nrfs_backend_sim_reset();
+	nrfs_backend_sim_handler_set(p_srv->respond);
+	nrfs_backend_sim_reject_next(1);
+	evt_clear();
+
+	CHECK(p_srv->request(CTX(1)) == NRFS_SUCCESS);
+	CHECK(p_srv->request(CTX(2)) == NRFS_SUCCESS);
+	CHECK(nrfs_backend_sim_tick(0) == 2);
+	CHECK(m_evt.count == 2);
+	/* Only the first request is rejected. */
+	CHECK(m_evt.type != p_srv->reject_type);
+
+	evt_clear();
+	nrfs_backend_sim_reject_next(1);
+	CHECK(p_srv->request(CTX(3)) == NRFS_SUCCESS);
+	CHECK(nrfs_backend_sim_tick(0) == 1);
+	CHECK((m_evt.count == 1) && (m_evt.type == p_srv->reject_type));
+}
+
+static bool drop_handler(void *p_msg, size_t *p_size, uint32_t *p_delay)
+{
+	(void)p_msg;
+	(void)p_size;
+	(void)p_delay;
+	return false;
+}
+
+static void test_drop(const service_t *p_srv)
+{
+	nrfs_backend_sim_reset();
+	nrfs_backend_sim_handler_set(drop_handler);
+	evt_clear();
+
+	CHECK(p_srv->request(CTX(1)) == NRFS_SUCCESS);
+	CHECK(nrfs_backend_sim_pending_get() == 0);
+	CHECK(nrfs_backend_sim_tick(DELAY) == 0);
+	CHECK(m_evt.count == 0);
+}
+
+static uint32_t m_next_delay;
+
+/* Every request is answered faster than the previous one. */
+static bool decreasing_delay_handler(void *p_msg, size_t *p_size, uint32_t *p_delay)
+{
+	(void)p_msg;
+	(void)p_size;
+	*p_delay = m_next_delay;
+	m_next_delay -= DELAY;
+	return true;
+}
+
+static void test_out_of_order(void)
+{
+	const service_t *p_srv = &services[0];
+
+	nrfs_backend_sim_reset();
+	nrfs_backend_sim_handler_set(decreasing_delay_handler);
+	m_next_delay = 4 * DELAY;
+	evt_clear();
+
+	for (uintptr_t i = 1; i <= 4; i++) {
+		CHECK(p_srv->request(CTX(i)) == NRFS_SUCCESS);
+	}
+
+	/* One response is delivered per delay step, the last request first. */
+	for (uint32_t i = 1; i <= 4; i++) {
+		CHECK(nrfs_backend_sim_tick(DELAY) == 1);
+		CHECK(m_evt.ctx[i - 1] == 5 - i);
+	}
+
+	/* Responses with the same delivery time keep the order of sending. */
+	nrfs_backend_sim_reset();
+	nrfs_backend_sim_delay_set(DELAY);
+	evt_clear();
+	for (uintptr_t i = 1; i <= 4; i++) {
+		CHECK(p_srv->request(CTX(i)) == NRFS_SUCCESS);
+	}
+	CHECK(nrfs_backend_sim_tick(2 * DELAY) == 4);
+	for (uint32_t i = 0; i < 4; i++) {
+		CHECK(m_evt.ctx[i] == i + 1);
+	}
+
+	/* Queue overflow is reported as an IPC error. */
+	nrfs_backend_sim_reset();
+	for (uint32_t i = 0; i < NRFS_BACKEND_SIM_QUEUE_SIZE; i++) {
+		CHECK(p_srv->request(CTX(i)) == NRFS_SUCCESS);
+	}
+	CHECK(p_srv->request(CTX(0)) == NRFS_ERR_IPC);
+}
+
+static uint64_t time_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void bench(const service_t *p_srv)
+{
+	uint64_t send_ns = 0;
+	uint64_t notify_ns = 0;
+	uint32_t sent = 0;
+
+	nrfs_backend_sim_reset();
+	nrfs_backend_sim_handler_set(p_srv->respond);
+	evt_clear();
+
+	while (sent < BENCH_REQUESTS) {
+		uint64_t t0 = time_ns();
+
+		for (uint32_t i = 0; i < NRFS_BACKEND_SIM_QUEUE_SIZE; i++) {
+			(void)p_srv->request(CTX(i));
+		}
+
+		uint64_t t1 = time_ns();
+		uint32_t delivered = nrfs_backend_sim_tick(0);
+
+		notify_ns += time_ns() - t1;
+		send_ns += t1 - t0;
+
+		CHECK(delivered == NRFS_BACKEND_SIM_QUEUE_SIZE);
+		if (delivered == 0) {
+			return;
+		}
+		sent += delivered;
+	}
+
+	CHECK(m_evt.count == sent);
+	printf("  %-8s %10.0f req/s %8.1f ns/request %8.1f ns/response\n", p_srv->name,
+	       (double)sent * 1e9 / (double)(send_ns + notify_ns), (double)send_ns / sent,
+	       (double)notify_ns / sent);
+}
+
+int main(void)
+{
+	for (size_t i = 0; i < NRFS_ARRAY_SIZE(services); i++) {
+		const service_t *p_srv = &services[i];
+
+		CHECK(p_srv->init() == NRFS_SUCCESS);
+		test_round_trip(p_srv);
+		test_reject(p_srv);
+		test_drop(p_srv);
+	}
+
+	test_out_of_order();
+	test_vote();
+
+	printf("Request throughput and response delivery time:\n");
+	for (size_t i = 0; i < NRFS_ARRAY_SIZE(services); i++) {
+		bench(&services[i]);
+	}
+
+	nrfs_host_test_governor();
+
+	for (size_t i = 0; i < NRFS_ARRAY_SIZE(services); i++) {
+		services[i].uninit();
+	}
+
+	printf("%s: %u failure(s)\n", nrfs_host_test_failures ? "FAILED" : "PASSED",
+	       nrfs_host_test_failures);
+	return nrfs_host_test_failures ? 1 : 0;
+}
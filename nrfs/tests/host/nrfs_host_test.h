@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef NRFS_HOST_TEST_H
+#define NRFS_HOST_TEST_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+/** @brief Number of failed checks. */
+extern uint32_t nrfs_host_test_failures;
+
+/** @brief Macro for checking a condition. Failure is reported and counted. */
+#define CHECK(cond)                                                                            \
+	do {                                                                                   \
+		if (!(cond)) {                                                                 \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);       \
+			nrfs_host_test_failures++;                                             \
+		}                                                                              \
+	} while (0)
+
+/** @brief Function for running the DVFS governor simulation. */
+void nrfs_host_test_governor(void);
+
+#endif /* NRFS_HOST_TEST_H */
@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Simulation of the DVFS governor with synthetic load traces.
+ *
+ * CPU runs the work demanded by the trace at the frequency of the current oppoint and
+ * the unfinished work is carried over as a backlog. The simulated System Controller answers
+ * an oppoint request which raises the frequency with the scaling preparation, which is
+ * followed by the scaling done event after the voltage change. Other requests are confirmed
+ * directly. Time unit of the simulator is a microsecond.
+ *
+ * Energy is the dynamic energy of the executed cycles, which is the number of cycles times
+ * the square of the oppoint voltage, per nanofarad of the switched capacitance. Leakage and
+ * the idle CPU are not modeled. Work added with a deadline is a miss if the backlog queued
+ * before it and the work itself are not done when the deadline passes.
+ */
+
+#include <internal/backends/nrfs_backend_sim.h>
+#include <internal/requests/nrfs_dvfs_reqs.h>
+#include <nrfs_dvfs.h>
+#include <dvfs_governor.h>
+#include <dvfs_oppoint.h>
+#include "nrfs_host_test.h"
+
+#define SAMPLE_US	 1000
+#define SLICE_US	 50
+#define CONFIRM_US	 100
+#define SCALING_US	 200
+
+static struct dvfs_governor m_gov;
+static uint32_t m_now;
+static uint64_t m_backlog;
+static enum dvfs_frequency_setting m_sc_opp;
+static uint64_t m_done;
+static uint64_t m_deadline_done;
+static uint32_t m_deadline_us;
+static bool m_deadline_pending;
+
+typedef struct {
+	uint32_t changes;
+	uint64_t mhz_us;
+	uint64_t backlog_max;
+	uint32_t periods;
+	double energy_nj;
+	uint32_t deadlines;
+	uint32_t deadline_misses;
+} stats_t;
+
+static uint32_t freq_get(enum dvfs_frequency_setting opp)
+{
+	return get_frequency_for_frequency_setting(opp);
+}
+
+static bool sc_respond(void *p_msg, size_t *p_size, uint32_t *p_delay)
+{
+	nrfs_dvfs_rsp_t *p_rsp = (nrfs_dvfs_rsp_t *)p_msg;
+
+	if (p_rsp->hdr.req == NRFS_DVFS_REQ_OPPOINT) {
+		enum dvfs_frequency_setting target =
+			((nrfs_dvfs_opp_req_t *)p_msg)->data.target_freq;
+
+		/* Lower setting is a higher frequency which needs a higher voltage. */
+		p_rsp->data.scaling_prepare = (target < m_sc_opp);
+		p_rsp->data.freq = target;
+		m_sc_opp = target;
+		*p_delay = CONFIRM_US;
+	} else if (p_rsp->hdr.req == NRFS_DVFS_REQ_READY_TO_SCALE) {
+		p_rsp->data.scaling_prepare = false;
+		p_rsp->data.freq = m_sc_opp;
+		*p_delay = SCALING_US;
+	}
+
+	*p_size = sizeof(*p_rsp);
+	return true;
+}
+
+static void dvfs_handler(nrfs_dvfs_evt_t const *p_evt, void *p_context)
+{
+	/* Context is the governor, but it does not fit the 32-bit context on a 64-bit host. */
+	(void)p_context;
+
+	if (p_evt->type == NRFS_DVFS_EVT_OPPOINT_SCALING_PREPARE) {
+		CHECK(nrfs_dvfs_ready_to_scale(NULL) == NRFS_SUCCESS);
+	}
+
+	CHECK(dvfs_governor_evt_handle(&m_gov, p_evt, m_now) == NRFS_SUCCESS);
+}
+
+static void sim_start(enum dvfs_frequency_setting opp)
+{
+	static const struct dvfs_governor_config config = {
+		.up_threshold = 80,
+		.down_threshold = 50,
+		.down_hold = 3,
+	};
+
+	nrfs_backend_sim_reset();
+	nrfs_backend_sim_handler_set(sc_respond);
+	dvfs_governor_init(&m_gov, &config, opp);
+	m_sc_opp = opp;
+	m_now = 0;
+	m_backlog = 0;
+	m_done = 0;
+	m_deadline_pending = false;
+}
+
+/* Add work which has to be done within deadline_us, optionally announced to the governor. */
+static void deadline_add(uint32_t cycles, uint32_t deadline_us, bool hint)
+{
+	if (hint) {
+		CHECK(dvfs_governor_deadline_hint(&m_gov, cycles, m_now + deadline_us, m_now) ==
+		      NRFS_SUCCESS);
+	}
+
+	m_backlog += cycles;
+	m_deadline_done = m_done + m_backlog;
+	m_deadline_us = m_now + deadline_us;
+	m_deadline_pending = true;
+}
+
+static void deadline_check(stats_t *p_stats)
+{
+	if (!m_deadline_pending) {
+		return;
+	}
+
+	if (m_done >= m_deadline_done) {
+		m_deadline_pending = false;
+		p_stats->deadlines++;
+	} else if (m_now >= m_deadline_us) {
+		m_deadline_pending = false;
+		p_stats->deadlines++;
+		p_stats->deadline_misses++;
+	}
+}
+
+/* Run one sample period with the given demand in MHz. */
+static void period_run(uint32_t demand_mhz, stats_t *p_stats)
+{
+	enum dvfs_frequency_setting opp = dvfs_governor_current_get(&m_gov);
+	uint32_t busy_us = 0;
+
+	for (uint32_t t = 0; t < SAMPLE_US; t += SLICE_US) {
+		enum dvfs_frequency_setting cur = dvfs_governor_current_get(&m_gov);
+		uint32_t freq = freq_get(cur);
+		double volt = get_dvfs_oppoint_data(cur)->opp_mv / 1000.0;
+		uint64_t done;
+
+		m_backlog += (uint64_t)demand_mhz * SLICE_US;
+		done = (m_backlog < (uint64_t)freq * SLICE_US) ? m_backlog : (uint64_t)freq * SLICE_US;
+		m_backlog -= done;
+		m_done += done;
+		p_stats->energy_nj += (double)done * volt * volt;
+		busy_us += (uint32_t)((done + freq - 1) / freq);
+		p_stats->mhz_us += (uint64_t)freq * SLICE_US;
+		if (m_backlog > p_stats->backlog_max) {
+			p_stats->backlog_max = m_backlog;
+		}
+
+		m_now += SLICE_US;
+		deadline_check(p_stats);
+		(void)nrfs_backend_sim_tick(SLICE_US);
+	}
+
+	if (busy_us > SAMPLE_US) {
+		busy_us = SAMPLE_US;
+	}
+	CHECK(dvfs_governor_sample_add(&m_gov, busy_us, SAMPLE_US - busy_us, m_now) ==
+	      NRFS_SUCCESS);
+
+	if (dvfs_governor_current_get(&m_gov) != opp) {
+		p_stats->changes++;
+	}
+	p_stats->periods++;
+}
+
+static void stats_print(const char *p_name, const stats_t *p_stats)
+{
+	printf("  %-10s %3u changes %6.1f MHz mean %8.1f us max backlog at 320 MHz "
+	       "%8.1f uJ/nF %u/%u deadlines missed\n",
+	       p_name, p_stats->changes,
+	       (double)p_stats->mhz_us / ((double)p_stats->periods * SAMPLE_US),
+	       (double)p_stats->backlog_max / freq_get(DVFS_FREQ_HIGH), p_stats->energy_nj / 1000.0,
+	       p_stats->deadline_misses, p_stats->deadlines);
+}
+
+/* Load steps up and back down. Each step causes exactly one oppoint change. */
+static void trace_step(void)
+{
+	stats_t stats = { 0 };
+	uint32_t reaction = 0;
+
+	sim_start(DVFS_FREQ_LOW);
+
+	for (uint32_t i = 0; i < 20; i++) {
+		period_run(20, &stats);
+	}
+	CHECK(dvfs_governor_current_get(&m_gov) == DVFS_FREQ_LOW);
+
+	while ((dvfs_governor_current_get(&m_gov) != DVFS_FREQ_MEDLOW) && (reaction < 20)) {
+		period_run(80, &stats);
+		reaction++;
+	}
+	CHECK(reaction <= DVFS_GOVERNOR_WINDOW_SIZE);
+	for (uint32_t i = 0; i < 20; i++) {
+		period_run(80, &stats);
+	}
+	CHECK(dvfs_governor_current_get(&m_gov) == DVFS_FREQ_MEDLOW);
+
+	for (uint32_t i = 0; i < 20; i++) {
+		period_run(20, &stats);
+	}
+	CHECK(dvfs_governor_current_get(&m_gov) == DVFS_FREQ_LOW);
+	CHECK(stats.changes == 2);
+
+	/* Latency estimate moves from the initial value towards the simulated latency. */
+	CHECK(m_gov.latency_us < DVFS_GOVERNOR_LATENCY_INIT_US);
+	CHECK(m_gov.latency_us >= CONFIRM_US);
+	stats_print("step", &stats);
+}
+
+/* Short bursts do not make the governor follow every change of the load. */
+static void trace_bursts(void)
+{
+	stats_t stats = { 0 };
+
+	sim_start(DVFS_FREQ_LOW);
+
+	for (uint32_t i = 0; i < 200; i++) {
+		period_run(((i / 2) % 2) ? 100 : 10, &stats);
+	}
+
+	CHECK(stats.changes <= 4);
+	stats_print("bursts", &stats);
+}
+
+/* Low load followed by work with a deadline, with or without the deadline hint. */
+static void deadline_run(bool hint, stats_t *p_stats)
+{
+	const uint32_t work_us = 1500;
+	const uint32_t deadline_us = 2000;
+
+	sim_start(DVFS_FREQ_LOW);
+
+	for (uint32_t i = 0; i < 10; i++) {
+		period_run(10, p_stats);
+	}
+
+	/* Work takes 1.5 ms at the highest frequency, so only the highest oppoint meets it. */
+	deadline_add(work_us * freq_get(DVFS_FREQ_HIGH), deadline_us, hint);
+
+	period_run(0, p_stats);
+	period_run(0, p_stats);
+}
+
+/* Work announced with a deadline completes in time although the load is low. */
+static void trace_deadline(void)
+{
+	stats_t stats = { 0 };
+	stats_t unhinted = { 0 };
+
+	deadline_run(true, &stats);
+	CHECK(m_backlog == 0);
+	CHECK(dvfs_governor_current_get(&m_gov) == DVFS_FREQ_HIGH);
+	CHECK(stats.deadlines == 1);
+	CHECK(stats.deadline_misses == 0);
+
+	/* Governor goes back to the lowest oppoint after the deadline. */
+	for (uint32_t i = 0; i < 20; i++) {
+		period_run(10, &stats);
+	}
+	CHECK(dvfs_governor_current_get(&m_gov) == DVFS_FREQ_LOW);
+	stats_print("deadline", &stats);
+
+	/* Without the hint the governor follows the load only after the deadline has passed. */
+	deadline_run(false, &unhinted);
+	for (uint32_t i = 0; i < 20; i++) {
+		period_run(10, &unhinted);
+	}
+	CHECK(unhinted.deadlines == 1);
+	CHECK(unhinted.deadline_misses == 1);
+	stats_print("unhinted", &unhinted);
+}
+
+/* Rejected request is repeated with the next sample. */
+static void trace_reject(void)
+{
+	stats_t stats = { 0 };
+
+	sim_start(DVFS_FREQ_LOW);
+	nrfs_backend_sim_reject_next(1);
+
+	for (uint32_t i = 0; i < 20; i++) {
+		period_run(200, &stats);
+	}
+
+	CHECK(dvfs_governor_current_get(&m_gov) == DVFS_FREQ_HIGH);
+	stats_print("reject", &stats);
+}
+
+void nrfs_host_test_governor(void)
+{
+	nrfs_dvfs_uninit();
+	CHECK(nrfs_dvfs_init(dvfs_handler) == NRFS_SUCCESS);
+
+	printf("DVFS governor:\n");
+	trace_step();
+	trace_bursts();
+	trace_deadline();
+	trace_reject();
+}
@@ -0,0 +1,16 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Host replacement of the Zephyr header included by the services. */
+
+#ifndef ZEPHYR_SYS_UTIL_MACRO_H
+#define ZEPHYR_SYS_UTIL_MACRO_H
+
+#ifndef BIT
+#define BIT(n) (1UL << (n))
+#endif
+
+#endif /* ZEPHYR_SYS_UTIL_MACRO_H */
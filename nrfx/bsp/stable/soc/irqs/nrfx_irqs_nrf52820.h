@@ -100,8 +100,10 @@ extern "C" {
 #define nrfx_rng_irq_handler        RNG_IRQHandler
 
 // ECB_IRQn
+#define nrfx_ecb_irq_handler        ECB_IRQHandler
 
 // CCM_AAR_IRQn
+#define nrfx_aar_irq_handler        CCM_AAR_IRQHandler
 
 // WDT_IRQn
 #define nrfx_wdt_irq_handler        WDT_IRQHandler
@@ -58,8 +58,10 @@ extern "C" {
 #define nrfx_timer_0_irq_handler    TIMER0_IRQHandler
 
 // ECB_IRQn
+#define nrfx_ecb_irq_handler        ECB_IRQHandler
 
 // AAR_CCM_IRQn
+#define nrfx_aar_irq_handler        AAR_CCM_IRQHandler
 
 // TEMP_IRQn
 #define nrfx_temp_irq_handler       TEMP_IRQHandler
@@ -53,10 +53,13 @@ extern "C" {
 // MPC00_IRQHandler
 
 // AAR00_CCM00_IRQHandler
+#define nrfx_aar_irq_handler            AAR00_CCM00_IRQHandler
 
 // ECB00_IRQHandler
+#define nrfx_ecb_irq_handler            ECB00_IRQHandler
 
 // CRACEN_IRQ
+#define nrfx_cracen_irq_handler         CRACEN_IRQHandler
 
 // SERIAL00_IRQ
 #if NRFX_CHECK(NRFX_PRS_ENABLED) && NRFX_CHECK(NRFX_PRS_BOX_0_ENABLED)
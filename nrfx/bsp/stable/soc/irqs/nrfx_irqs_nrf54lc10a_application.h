@@ -53,8 +53,10 @@ extern "C" {
 // MPC00_IRQHandler
 
 // AAR00_CCM00_IRQHandler
+#define nrfx_aar_irq_handler            AAR00_CCM00_IRQHandler
 
 // ECB00_IRQHandler
+#define nrfx_ecb_irq_handler            ECB00_IRQHandler
 
 // VPR00_IRQHandler
 
@@ -72,6 +74,7 @@ extern "C" {
 #define nrfx_egu_00_irq_handler         EGU00_IRQHandler
 
 // CRACEN_IRQHandler
+#define nrfx_cracen_irq_handler         CRACEN_IRQHandler
 
 // VREGRLDO_IRQHandler
 
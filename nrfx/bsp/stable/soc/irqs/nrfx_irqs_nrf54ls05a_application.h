@@ -53,8 +53,10 @@ extern "C" {
 // MPC00_IRQHandler
 
 // AAR00_CCM00_IRQHandler
+#define nrfx_aar_irq_handler            AAR00_CCM00_IRQHandler
 
 // ECB00_IRQHandler
+#define nrfx_ecb_irq_handler            ECB00_IRQHandler
 
 // RRAMC_IRQHandler
 #define nrfx_rramc_irq_handler          RRAMC_IRQHandler
@@ -1271,6 +1271,27 @@
 #define NRFX_USBD_CONFIG_DMASCHEDULER_ISO_BOOST 1
 #endif
 
+/**
+ * @brief NRFX_USBD_CONFIG_DMASCHEDULER_MODE - Order of the DMA transfers of endpoints with the same priority
+ *
+ * Integer value.
+ * Supported values:
+ * - Prioritized = 0
+ * - RoundRobin  = 1
+ */
+#ifndef NRFX_USBD_CONFIG_DMASCHEDULER_MODE
+#define NRFX_USBD_CONFIG_DMASCHEDULER_MODE 0
+#endif
+
+/**
+ * @brief NRFX_USBD_CONFIG_DMA_STATS_ENABLED - Collect the DMA wait time statistics of endpoints
+ *
+ * Boolean. Accepted values: 0 and 1.
+ */
+#ifndef NRFX_USBD_CONFIG_DMA_STATS_ENABLED
+#define NRFX_USBD_CONFIG_DMA_STATS_ENABLED 0
+#endif
+
 /**
  * @brief NRFX_USBD_CONFIG_ISO_IN_ZLP - Respond to an IN token on ISO IN endpoint with ZLP when no data is ready.
  *
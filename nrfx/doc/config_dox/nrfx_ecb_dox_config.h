@@ -0,0 +1,53 @@
+/**
+ *
+ * @defgroup nrfx_ecb_config ECB peripheral driver configuration
+ * @{
+ * @ingroup nrfx_ecb
+ */
+
+/** @brief Enable ECB driver
+ *
+ *  Set to 1 to activate.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_ECB_ENABLED
+
+/** @brief Interrupt priority
+ *
+ *  Following options are available:
+ * - 0 - 0 (highest)
+ * - 1 - 1
+ * - 2 - 2
+ * - 3 - 3
+ * - 4 - 4
+ * - 5 - 5
+ * - 6 - 6
+ * - 7 - 7
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_ECB_DEFAULT_CONFIG_IRQ_PRIORITY
+
+/** @brief Enables logging in the module.
+ *
+ *  Set to 1 to activate.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_ECB_CONFIG_LOG_ENABLED
+
+/** @brief Default Severity level
+ *
+ *  Following options are available:
+ * - 0 - Off
+ * - 1 - Error
+ * - 2 - Warning
+ * - 3 - Info
+ * - 4 - Debug
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_ECB_CONFIG_LOG_LEVEL
+
+/** @} */
@@ -43,6 +43,33 @@
  */
 #define NRFX_USBD_CONFIG_DMASCHEDULER_ISO_BOOST
 
+/** @brief Order of the DMA transfers of endpoints with the same priority
+ *
+ * In the prioritized mode, endpoint with the lowest number is served first. In the round robin
+ * mode, endpoints are served in turns so that heavy traffic on one endpoint does not starve
+ * the other ones. Isochronous endpoints (see @ref NRFX_USBD_CONFIG_DMASCHEDULER_ISO_BOOST) and
+ * endpoints marked with @ref nrfx_usbd_ep_dma_priority_set are served before the other ones
+ * regardless of the mode.
+ *
+ *  Following options are available:
+ *  - 0 - Prioritized
+ *  - 1 - Round robin
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_USBD_CONFIG_DMASCHEDULER_MODE
+
+/** @brief Collect the DMA wait time statistics of endpoints
+ *
+ * If set, time between the endpoint becoming ready for the DMA transfer and the start
+ * of the transfer is measured for each endpoint (see @ref nrfx_usbd_ep_dma_stats_get).
+ *
+ *  Set to 1 to activate.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_USBD_CONFIG_DMA_STATS_ENABLED
+
 /** @brief Respond to an IN token on ISO IN endpoint with ZLP when no data is ready
  *
  * If set, ISO IN endpoint will respond to an IN token with ZLP when no data is ready to be sent.
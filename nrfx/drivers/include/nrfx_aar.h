@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#ifndef NRFX_AAR_H__
+#define NRFX_AAR_H__
+
+#include <nrfx.h>
+#include <hal/nrf_aar.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_aar AAR driver
+ * @{
+ * @ingroup nrf_aar
+ * @brief   Accelerated Address Resolver (AAR) peripheral driver.
+ */
+
+/** @brief Size of the Identity Resolving Key (IRK) in bytes. */
+#define NRFX_AAR_IRK_SIZE 16
+
+/** @brief Size of the resolvable private address in bytes. */
+#define NRFX_AAR_ADDR_SIZE 6
+
+/** @brief Result value of an address that was not resolved by any of the IRKs. */
+#define NRFX_AAR_NOT_RESOLVED (-1)
+
+#if NRF_AAR_HAS_IN_PTR || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Macro for getting the number of job list elements needed for an IRK table.
+ *
+ * @param[in] irk_count Number of IRKs in the table.
+ */
+#define NRFX_AAR_JOB_LIST_SIZE(irk_count) ((irk_count) + 3)
+#endif
+
+/**
+ * @brief Structure for the entry of the resolution cache.
+ *
+ * The cache is an array of entries provided by the user, holding the results of the most
+ * recently resolved addresses. Both successful and unsuccessful resolutions are cached.
+ * The least recently used entry is replaced when the cache is full.
+ */
+typedef struct
+{
+    /** @cond Driver internal data. */
+    uint8_t  addr[NRFX_AAR_ADDR_SIZE];
+    int16_t  irk_idx;
+    uint32_t stamp;
+    /** @endcond */
+} nrfx_aar_cache_entry_t;
+
+/** @brief Structure for the AAR driver configuration. */
+typedef struct
+{
+    nrfx_aar_cache_entry_t * p_cache;            ///< Pointer to the resolution cache. Can be NULL.
+    uint8_t                  cache_size;         ///< Number of entries in @p p_cache.
+    uint8_t                  interrupt_priority; ///< Interrupt priority.
+} nrfx_aar_config_t;
+
+/**
+ * @brief AAR driver default configuration.
+ *
+ * This configuration sets up AAR with the following options:
+ * - no resolution cache
+ * - default interrupt priority
+ */
+#define NRFX_AAR_DEFAULT_CONFIG                                 \
+{                                                               \
+    .p_cache            = NULL,                                 \
+    .cache_size         = 0,                                    \
+    .interrupt_priority = NRFX_AAR_DEFAULT_CONFIG_IRQ_PRIORITY, \
+}
+
+/** @brief Structure for the table of Identity Resolving Keys. */
+typedef struct
+{
+    uint8_t const *  p_irks;    /**< Pointer to the IRKs, 16 bytes each, placed back to back
+                                 *   in the Data RAM region, in the byte order expected by
+                                 *   the AES core (most significant byte first). */
+    uint16_t         irk_count; ///< Number of IRKs in @p p_irks.
+#if NRF_AAR_HAS_IN_PTR || defined(__NRFX_DOXYGEN__)
+    nrf_vdma_job_t * p_jobs;    /**< Pointer to the memory for the job list, of
+                                 *   @ref NRFX_AAR_JOB_LIST_SIZE elements, placed in
+                                 *   the Data RAM region. */
+#endif
+} nrfx_aar_irk_table_t;
+
+/** @brief AAR batch. */
+typedef struct nrfx_aar_batch_s nrfx_aar_batch_t;
+
+/**
+ * @brief AAR batch completion handler type.
+ *
+ * @param[in] p_batch   Pointer to the completed batch.
+ * @param[in] result    0 if all addresses were processed, -ECANCELED if the resolution was
+ *                      aborted due to an error.
+ * @param[in] p_context Context passed to @ref nrfx_aar_batch_resolve.
+ */
+typedef void (* nrfx_aar_batch_handler_t)(nrfx_aar_batch_t * p_batch,
+                                          int                result,
+                                          void *             p_context);
+
+/** @brief Structure for the batch of addresses to resolve. */
+struct nrfx_aar_batch_s
+{
+    uint8_t const *          p_addrs;   /**< Pointer to the addresses, 6 bytes each in on-air
+                                         *   byte order, placed in the Data RAM region. */
+    size_t                   count;     ///< Number of addresses in @p p_addrs.
+    int16_t *                p_results; /**< Pointer to the array of @p count results, filled
+                                         *   with the index of the matching IRK or
+                                         *   @ref NRFX_AAR_NOT_RESOLVED. */
+    /** @cond Driver internal data. */
+    nrfx_aar_batch_handler_t handler;
+    void *                   p_context;
+    /** @endcond */
+};
+
+/**
+ * @brief Function for initializing the AAR driver.
+ *
+ * @param[in] p_config Pointer to the structure with the initial configuration.
+ *
+ * @retval 0         Initialization was successful.
+ * @retval -EALREADY The driver is already initialized.
+ */
+int nrfx_aar_init(nrfx_aar_config_t const * p_config);
+
+/**
+ * @brief Function for uninitializing the AAR driver.
+ *
+ * The resolution in progress is aborted without calling the batch handler.
+ */
+void nrfx_aar_uninit(void);
+
+/**
+ * @brief Function for checking if the AAR driver is initialized.
+ *
+ * @retval true  Driver is already initialized.
+ * @retval false Driver is not initialized.
+ */
+bool nrfx_aar_init_check(void);
+
+/**
+ * @brief Function for setting the table of IRKs used for resolution.
+ *
+ * The resolution cache is flushed. On devices with EasyVDMA job lists, the job list
+ * describing the IRKs is built once here and reused for every address.
+ *
+ * @note The table, including the IRKs and the job list memory, must remain valid
+ *       as long as it is used by the driver.
+ *
+ * @param[in] p_table Pointer to the IRK table.
+ *
+ * @retval 0       The table was set.
+ * @retval -EBUSY  A batch is being resolved.
+ * @retval -EINVAL The table is invalid.
+ */
+int nrfx_aar_irk_table_set(nrfx_aar_irk_table_t const * p_table);
+
+/**
+ * @brief Function for resolving a batch of addresses.
+ *
+ * Each address is first looked up in the resolution cache. Addresses that are not found
+ * there are resolved with one hardware run against the whole IRK table. On devices
+ * without EasyVDMA job lists, the table is processed in windows of up to 16 IRKs.
+ * The handler is called from @ref nrfx_aar_irq_handler when all addresses are processed.
+ *
+ * @note The batch structure, the addresses and the results must remain valid until
+ *       the handler is called.
+ *
+ * @param[in] p_batch   Pointer to the batch.
+ * @param[in] handler   Batch completion handler. Must not be NULL.
+ * @param[in] p_context Context passed to @p handler.
+ *
+ * @retval 0       The resolution was started.
+ * @retval -EBUSY  Another batch is being resolved.
+ * @retval -EINVAL The batch is empty or no IRK table is set.
+ */
+int nrfx_aar_batch_resolve(nrfx_aar_batch_t *       p_batch,
+                           nrfx_aar_batch_handler_t handler,
+                           void *                   p_context);
+
+/**
+ * @brief Function for flushing the resolution cache.
+ */
+void nrfx_aar_cache_flush(void);
+
+/**
+ * @brief Function for resolving an address in software.
+ *
+ * The function computes the Bluetooth random address hash function ah() with a software
+ * AES implementation, without using the AAR peripheral and without the driver being
+ * initialized. It can be used when the peripheral is not available, for example because
+ * it is used by the radio.
+ *
+ * @param[in] p_table Pointer to the IRK table.
+ * @param[in] p_addr  Pointer to the 6-byte address, in on-air byte order.
+ *
+ * @return Index of the matching IRK or @ref NRFX_AAR_NOT_RESOLVED.
+ */
+int16_t nrfx_aar_sw_resolve(nrfx_aar_irk_table_t const * p_table, uint8_t const * p_addr);
+
+/** @} */
+
+
+void nrfx_aar_irq_handler(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_AAR_H__
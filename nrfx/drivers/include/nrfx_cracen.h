@@ -36,6 +36,9 @@
 
 #include <nrfx.h>
 #include <hal/nrf_cracen.h>
+#if NRF_CRACEN_HAS_CRYPTOMASTER
+#include <helpers/nrf_cracen_cm_dma.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -48,6 +51,98 @@ extern "C" {
  * @brief   Cryptographic accelerator engine (CRACEN) peripheral driver
  */
 
+#if NRF_CRACEN_HAS_CRYPTOMASTER || defined(__NRFX_DOXYGEN__)
+/** @brief Maximum number of scatter-gather segments in a single CryptoMaster job data list. */
+#define NRFX_CRACEN_CM_SG_MAX 4
+
+/** @brief Size of the SHA-256 digest in bytes. */
+#define NRFX_CRACEN_SHA256_DIGEST_SIZE 32
+
+/** @brief Size of the SHA-256 block in bytes. */
+#define NRFX_CRACEN_SHA256_BLOCK_SIZE  64
+
+/** @brief CryptoMaster operations. */
+typedef enum
+{
+    NRFX_CRACEN_CM_OP_AES_ECB, ///< AES in ECB mode.
+    NRFX_CRACEN_CM_OP_AES_CTR, ///< AES in CTR mode.
+    NRFX_CRACEN_CM_OP_AES_CCM, ///< AES in CCM mode.
+    NRFX_CRACEN_CM_OP_AES_GCM, ///< AES in GCM mode.
+    NRFX_CRACEN_CM_OP_SHA256,  ///< SHA-256 hash.
+} nrfx_cracen_cm_op_t;
+
+/** @brief Scatter-gather data segment. */
+typedef struct
+{
+    uint8_t * p_data; ///< Pointer to the data segment.
+    size_t    length; ///< Length of the data segment in bytes.
+} nrfx_cracen_cm_sg_t;
+
+/** @brief CryptoMaster job. */
+typedef struct nrfx_cracen_cm_job_s nrfx_cracen_cm_job_t;
+
+/**
+ * @brief CryptoMaster job completion handler type.
+ *
+ * @param[in] p_job     Pointer to the completed job.
+ * @param[in] p_context Context passed to @ref nrfx_cracen_cm_job_start.
+ */
+typedef void (* nrfx_cracen_cm_handler_t)(nrfx_cracen_cm_job_t * p_job, void * p_context);
+
+/**
+ * @brief Structure for the CryptoMaster job.
+ *
+ * The input data described by @p p_in is processed in a single hardware job, regardless
+ * of the number of segments. For AES operations, the output is written to the segments
+ * described by @p p_out, whose total length must be equal to the total input length.
+ * The data and key buffers must be accessible by the CryptoMaster DMA.
+ */
+struct nrfx_cracen_cm_job_s
+{
+    nrfx_cracen_cm_op_t         op;        ///< Operation.
+    bool                        decrypt;   ///< True for decryption, false for encryption. Ignored for SHA-256.
+    uint8_t const *             p_key;     ///< AES key. Ignored for SHA-256.
+    size_t                      key_size;  ///< AES key size in bytes, 16, 24 or 32.
+    uint8_t const *             p_iv;      ///< Initial counter block (CTR), nonce (CCM) or IV (GCM).
+    size_t                      iv_size;   ///< Size of @p p_iv, 16 (CTR), 7 to 13 (CCM) or 12 (GCM).
+    nrfx_cracen_cm_sg_t const * p_aad;     ///< Additional authenticated data segments (CCM and GCM).
+    uint8_t                     aad_count; ///< Number of AAD segments.
+    nrfx_cracen_cm_sg_t const * p_in;      ///< Input data segments.
+    uint8_t                     in_count;  ///< Number of input data segments.
+    nrfx_cracen_cm_sg_t const * p_out;     ///< Output data segments. Ignored for SHA-256.
+    uint8_t                     out_count; ///< Number of output data segments.
+    uint8_t *                   p_tag;     ///< Authentication tag (CCM and GCM) or digest (SHA-256).
+                                           /**< On encryption, the computed tag is written here.
+                                            *   On decryption, this is the expected tag. */
+    size_t                      tag_size;  ///< Size of @p p_tag, 4 to 16 (CCM and GCM) or
+                                           ///< @ref NRFX_CRACEN_SHA256_DIGEST_SIZE (SHA-256).
+    int                         result;    ///< Result of the job, valid when the job is completed.
+                                           /**< 0 on success, -EBADMSG if the tag did not match
+                                            *   on decryption or -ECANCELED on a bus error. */
+    /** @cond Driver internal data. */
+    nrfx_cracen_cm_handler_t    handler;
+    void *                      p_context;
+    uint32_t                    config;
+    uint8_t                     iv_block[16];
+    uint8_t                     extra[NRFX_CRACEN_SHA256_BLOCK_SIZE + 8];
+    uint8_t                     tag[16];
+    nrf_cracen_cm_dma_desc_t    fetch[2 * NRFX_CRACEN_CM_SG_MAX + 6];
+    nrf_cracen_cm_dma_desc_t    push[NRFX_CRACEN_CM_SG_MAX + 1];
+    /** @endcond */
+};
+
+/** @brief Structure for the streaming SHA-256 context. */
+typedef struct
+{
+    /** @cond Driver internal data. */
+    uint8_t  state[NRFX_CRACEN_SHA256_DIGEST_SIZE];
+    uint8_t  block[NRFX_CRACEN_SHA256_BLOCK_SIZE];
+    size_t   block_len;
+    uint64_t length;
+    /** @endcond */
+} nrfx_cracen_sha256_ctx_t;
+#endif // NRF_CRACEN_HAS_CRYPTOMASTER || defined(__NRFX_DOXYGEN__)
+
 /**
  * @brief Function for initializing the CRACEN driver and peripheral.
  *
@@ -98,7 +193,13 @@ NRFX_STATIC_INLINE void nrfx_cracen_ctr_drbg_uninit(void);
  * @note This function assumes exclusive access to the CRACEN TRNG and CryptoMaster, and may
  *       not be used while any other component is using those peripherals.
  *
- * @param[out] p_buf Buffer into which to copy @p size generated bytes.
+ * @note If a CryptoMaster job started with @ref nrfx_cracen_cm_job_start is in progress,
+ *       the function waits for it to complete. It must therefore not be called from
+ *       an interrupt that blocks the CRACEN interrupt while such a job is in progress.
+ *
+ * @param[out] p_buf Buffer into which to copy @p size generated bytes. If it is accessible
+ *                   by the CryptoMaster DMA, the bytes are generated in place. Otherwise,
+ *                   they are staged through a buffer of the driver.
  * @param[in]  size  Number of bytes to copy.
  *
  * @retval 0          Success.
@@ -106,6 +207,144 @@ NRFX_STATIC_INLINE void nrfx_cracen_ctr_drbg_uninit(void);
  * @retval -ECANCELED Unexpected error.
  */
 int nrfx_cracen_ctr_drbg_random_get(uint8_t * p_buf, size_t size);
+
+/**
+ * @brief Function for requesting an asynchronous reseed of the CTR_DRBG.
+ *
+ * The TRNG is started and its FIFO is then polled, without blocking, each time random data
+ * is generated. Once enough entropy is collected, it is mixed into the CTR_DRBG state at
+ * the end of the next generate request, which then resets the reseed counter.
+ */
+void nrfx_cracen_ctr_drbg_reseed_request(void);
+
+/**
+ * @brief Function for initializing the pool of pre-generated random data.
+ *
+ * The pool is a ring buffer refilled in the background by CryptoMaster jobs generating
+ * all of its free space at once whenever its level drops below @p threshold. Random data
+ * can then be taken from the pool with @ref nrfx_cracen_ctr_drbg_pool_get without waiting
+ * for the hardware.
+ *
+ * @note The pool is refilled from @ref nrfx_cracen_irq_handler, which must be connected.
+ *
+ * @param[in] p_buffer  Pointer to the pool memory.
+ * @param[in] size      Size of the pool in bytes, at least 16.
+ * @param[in] threshold Pool level in bytes below which a refill is started.
+ *
+ * @retval 0         The pool was initialized and its first refill was started.
+ * @retval -EINVAL   Invalid parameters.
+ * @retval -EALREADY The pool was already initialized.
+ */
+int nrfx_cracen_ctr_drbg_pool_init(uint8_t * p_buffer, size_t size, size_t threshold);
+
+/**
+ * @brief Function for uninitializing the pool of pre-generated random data.
+ *
+ * The remaining random data in the pool is cleared.
+ */
+void nrfx_cracen_ctr_drbg_pool_uninit(void);
+
+/**
+ * @brief Function for taking random data from the pool.
+ *
+ * The data handed out is cleared from the pool. The function can be used in interrupt
+ * context.
+ *
+ * @param[out] p_buf Buffer into which to copy @p size random bytes.
+ * @param[in]  size  Number of bytes to copy.
+ *
+ * @retval 0       Success.
+ * @retval -EINVAL Invalid inputs.
+ * @retval -EAGAIN Not enough random data in the pool. Nothing was copied.
+ */
+int nrfx_cracen_ctr_drbg_pool_get(uint8_t * p_buf, size_t size);
+
+/**
+ * @brief Function for getting the number of random bytes available in the pool.
+ *
+ * @return Number of bytes that can be taken from the pool.
+ */
+size_t nrfx_cracen_ctr_drbg_pool_level_get(void);
+
+/**
+ * @brief Function for starting a CryptoMaster job.
+ *
+ * The whole job, including the key, the IV and all data segments, is described by a chain
+ * of DMA descriptors and processed by the CryptoMaster in one go.
+ *
+ * If @p handler is NULL, the function is blocking and returns the result of the job.
+ * Otherwise, the function returns right after the job is started and the handler is called
+ * from @ref nrfx_cracen_irq_handler when it is completed. The job structure must remain
+ * valid until then.
+ *
+ * For CCM and GCM, the tag is computed by the hardware. On decryption, it is compared
+ * by the driver with the expected one provided in the job.
+ *
+ * @param[in] p_job     Pointer to the job.
+ * @param[in] handler   Job completion handler. Can be NULL.
+ * @param[in] p_context Context passed to @p handler.
+ *
+ * @retval 0          The job was started or, in blocking mode, completed successfully.
+ * @retval -EBUSY     Another CryptoMaster job is in progress.
+ * @retval -EINVAL    The job is invalid.
+ * @retval -EBADMSG   Blocking mode only. The tag did not match on decryption.
+ * @retval -ECANCELED Blocking mode only. A bus error occurred.
+ */
+int nrfx_cracen_cm_job_start(nrfx_cracen_cm_job_t *   p_job,
+                             nrfx_cracen_cm_handler_t handler,
+                             void *                   p_context);
+
+/**
+ * @brief Function for checking if a CryptoMaster job is in progress.
+ *
+ * @retval true  A job is in progress.
+ * @retval false No job is in progress.
+ */
+bool nrfx_cracen_cm_busy_check(void);
+
+/**
+ * @brief Function for initializing the streaming SHA-256 context.
+ *
+ * @param[out] p_ctx Pointer to the context.
+ */
+void nrfx_cracen_sha256_init(nrfx_cracen_sha256_ctx_t * p_ctx);
+
+/**
+ * @brief Function for hashing the next part of the message.
+ *
+ * Data is buffered in the context until a full block is collected. All complete blocks,
+ * including the buffered one, are processed in a single blocking CryptoMaster job.
+ *
+ * @param[in,out] p_ctx  Pointer to the context.
+ * @param[in]     p_data Pointer to the data. Must be accessible by the CryptoMaster DMA.
+ * @param[in]     size   Size of the data in bytes.
+ *
+ * @retval 0          Success.
+ * @retval -EBUSY     A CryptoMaster job is in progress.
+ * @retval -ECANCELED A bus error occurred.
+ */
+int nrfx_cracen_sha256_update(nrfx_cracen_sha256_ctx_t * p_ctx,
+                              uint8_t const *            p_data,
+                              size_t                     size);
+
+/**
+ * @brief Function for finishing the hash computation.
+ *
+ * @param[in,out] p_ctx    Pointer to the context.
+ * @param[out]    p_digest Buffer for the digest of @ref NRFX_CRACEN_SHA256_DIGEST_SIZE bytes.
+ *
+ * @retval 0          Success.
+ * @retval -EBUSY     A CryptoMaster job is in progress.
+ * @retval -ECANCELED A bus error occurred.
+ */
+int nrfx_cracen_sha256_finish(nrfx_cracen_sha256_ctx_t * p_ctx, uint8_t * p_digest);
+
+/**
+ * @brief CRACEN driver interrupt handler.
+ *
+ * Required only for CryptoMaster jobs started with a completion handler.
+ */
+void nrfx_cracen_irq_handler(void);
 #endif // NRF_CRACEN_HAS_CRYPTOMASTER
 
 /**
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#ifndef NRFX_ECB_H__
+#define NRFX_ECB_H__
+
+#include <nrfx.h>
+#include <hal/nrf_ecb.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_ecb ECB driver
+ * @{
+ * @ingroup nrf_ecb
+ * @brief   AES Electronic Codebook mode encryption (ECB) peripheral driver.
+ */
+
+/** @brief Size of the AES block and of the AES key in bytes. */
+#define NRFX_ECB_BLOCK_SIZE 16
+
+/**
+ * @brief Number of consecutive ERROR events after which the block is not restarted
+ *        and the job is completed with an error.
+ */
+#define NRFX_ECB_ERROR_RETRY_MAX 8
+
+/** @brief Structure for the ECB driver configuration. */
+typedef struct
+{
+    uint8_t interrupt_priority; ///< Interrupt priority.
+} nrfx_ecb_config_t;
+
+/**
+ * @brief ECB driver default configuration.
+ *
+ * This configuration sets up ECB with the following options:
+ * - default interrupt priority
+ */
+#define NRFX_ECB_DEFAULT_CONFIG                                 \
+{                                                               \
+    .interrupt_priority = NRFX_ECB_DEFAULT_CONFIG_IRQ_PRIORITY, \
+}
+
+/** @brief Structure for a single block encryption. */
+typedef struct
+{
+    uint8_t const * p_key;        ///< Pointer to the 128-bit key, in big endian byte order.
+    uint8_t const * p_cleartext;  ///< Pointer to the block to be encrypted.
+    uint8_t *       p_ciphertext; ///< Pointer to the buffer for the encrypted block.
+} nrfx_ecb_block_t;
+
+/** @brief ECB job. */
+typedef struct nrfx_ecb_job_s nrfx_ecb_job_t;
+
+/**
+ * @brief ECB job completion handler type.
+ *
+ * @param[in] p_job     Pointer to the completed job.
+ * @param[in] result    0 if all blocks were encrypted, -EIO if the encryption of a block
+ *                      was aborted by the peripheral @ref NRFX_ECB_ERROR_RETRY_MAX times
+ *                      in a row, -ECANCELED if the job was dropped by @ref nrfx_ecb_uninit.
+ *                      On error, the ciphertext buffers are valid only for the blocks
+ *                      preceding the failed one.
+ * @param[in] p_context Context passed to @ref nrfx_ecb_job_submit.
+ */
+typedef void (* nrfx_ecb_job_handler_t)(nrfx_ecb_job_t * p_job,
+                                        int              result,
+                                        void *           p_context);
+
+/**
+ * @brief Structure for the ECB job.
+ *
+ * A job is a list of independent block encryptions, each of them possibly with a different
+ * key, completed with a single call to the job handler.
+ */
+struct nrfx_ecb_job_s
+{
+    nrfx_ecb_block_t const * p_blocks; ///< Pointer to the array of blocks to encrypt.
+    size_t                   count;    ///< Number of blocks in @p p_blocks.
+    /** @cond Driver internal data. */
+    nrfx_ecb_job_handler_t   handler;
+    void *                   p_context;
+    nrfx_ecb_job_t *         p_next;
+    /** @endcond */
+};
+
+/**
+ * @brief Function for initializing the ECB driver.
+ *
+ * @param[in] p_config Pointer to the structure with the initial configuration.
+ *
+ * @retval 0         Initialization was successful.
+ * @retval -EALREADY The driver is already initialized.
+ */
+int nrfx_ecb_init(nrfx_ecb_config_t const * p_config);
+
+/**
+ * @brief Function for uninitializing the ECB driver.
+ *
+ * The encryption in progress is aborted and the handlers of the job in progress and of
+ * the queued jobs are called in order with -ECANCELED, after the driver is uninitialized.
+ * The handlers must not submit new jobs.
+ */
+void nrfx_ecb_uninit(void);
+
+/**
+ * @brief Function for checking if the ECB driver is initialized.
+ *
+ * @retval true  Driver is already initialized.
+ * @retval false Driver is not initialized.
+ */
+bool nrfx_ecb_init_check(void);
+
+/**
+ * @brief Function for submitting a job to the ECB driver queue.
+ *
+ * The job is started immediately if the queue is empty. Otherwise it is started by the
+ * interrupt handler as soon as the jobs submitted before are completed. The blocks of the job
+ * are encrypted in order, and the key is reloaded into the peripheral only when it differs
+ * from the key of the previous block. If the peripheral aborts the encryption of a block,
+ * the block is restarted up to @ref NRFX_ECB_ERROR_RETRY_MAX times before the job is
+ * completed with an error.
+ *
+ * @note On devices with EasyVDMA job lists, the blocks are transferred directly from and to
+ *       the buffers given in the job, which must therefore be placed in the Data RAM region.
+ *
+ * @note The job structure and the blocks must remain valid until the job handler is called.
+ *
+ * @param[in] p_job     Pointer to the job.
+ * @param[in] handler   Job completion handler. Must not be NULL.
+ * @param[in] p_context Context passed to @p handler.
+ *
+ * @retval 0       The job was queued.
+ * @retval -EINVAL The job contains no blocks.
+ */
+int nrfx_ecb_job_submit(nrfx_ecb_job_t *       p_job,
+                        nrfx_ecb_job_handler_t handler,
+                        void *                 p_context);
+
+/**
+ * @brief Function for checking if the ECB driver is processing jobs.
+ *
+ * @retval true  A job is in progress.
+ * @retval false The job queue is empty.
+ */
+bool nrfx_ecb_busy_check(void);
+
+/** @} */
+
+
+void nrfx_ecb_irq_handler(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_ECB_H__
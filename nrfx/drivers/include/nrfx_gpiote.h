@@ -102,6 +102,9 @@ typedef struct
     uint16_t                     ch_pin[GPIOTE_CH_NUM];
 #if !defined(NRF_GPIO_LATCH_PRESENT)
     uint32_t                     port_pins[GPIO_COUNT];
+    uint32_t                     level_pins[GPIO_COUNT];
+    nrfx_atomic_t                sense_high[GPIO_COUNT];
+    nrfx_atomic_t                sense_low[GPIO_COUNT];
 #endif
     nrfx_drv_state_t             state;
     uint8_t                      drv_inst_idx;
@@ -346,9 +349,9 @@ int nrfx_gpiote_pin_uninit(nrfx_gpiote_t * p_instance, nrfx_gpiote_pin_t pin);
  * @param[in] pin        Absolute pin number.
  * @param[in] int_enable True to enable the interrupt. Must be true when sensing is used.
  */
-void nrfx_gpiote_trigger_enable(nrfx_gpiote_t const * p_instance,
-                                nrfx_gpiote_pin_t     pin,
-                                bool                  int_enable);
+void nrfx_gpiote_trigger_enable(nrfx_gpiote_t *   p_instance,
+                                nrfx_gpiote_pin_t pin,
+                                bool              int_enable);
 
 /**
  * @brief Function for disabling trigger for the given pin.
@@ -356,7 +359,7 @@ void nrfx_gpiote_trigger_enable(nrfx_gpiote_t const * p_instance,
  * @param[in] p_instance Pointer to the driver instance structure.
  * @param[in] pin        Absolute pin number.
  */
-void nrfx_gpiote_trigger_disable(nrfx_gpiote_t const * p_instance, nrfx_gpiote_pin_t pin);
+void nrfx_gpiote_trigger_disable(nrfx_gpiote_t * p_instance, nrfx_gpiote_pin_t pin);
 
 /**
  * @brief Set global callback called for each event.
@@ -166,6 +166,19 @@ typedef nrfy_i2s_xfer_desc_t nrfx_i2s_buffers_t;
     /**< The I2S peripheral has been stopped and all buffers that were passed
      *   to the driver have been released. */
 
+#define NRFX_I2S_STATUS_BUFFER_RELEASED     (1UL << 2)
+    /**< Ring mode only. The peripheral has finished processing the buffers
+     *   passed to the data handler and they are now owned by the application.
+     *   They are to be given back to the driver with a call to
+     *   @ref nrfx_i2s_ring_buffer_return once processed. */
+
+/** @brief Structure for I2S ring mode statistics. */
+typedef struct
+{
+    uint32_t underrun_count; ///< Number of times TX data was repeated because no buffer was queued.
+    uint32_t overrun_count;  ///< Number of times RX data was overwritten because no buffer was queued.
+} nrfx_i2s_ring_stats_t;
+
 /**
  * @brief I2S driver data handler type.
  *
@@ -210,6 +223,7 @@ typedef nrfy_i2s_xfer_desc_t nrfx_i2s_buffers_t;
  *                    It can be 0 or a combination of the following flags:
  *                    - @ref NRFX_I2S_STATUS_NEXT_BUFFERS_NEEDED
  *                    - @ref NRFX_I2S_STATUS_TRANSFER_STOPPED
+ *                    - @ref NRFX_I2S_STATUS_BUFFER_RELEASED
  */
 typedef void (* nrfx_i2s_data_handler_t)(nrfx_i2s_buffers_t const * p_released,
                                          uint32_t                   status);
@@ -231,6 +245,13 @@ typedef struct
 
     nrfx_i2s_buffers_t  next_buffers;
     nrfx_i2s_buffers_t  current_buffers;
+
+    nrfx_i2s_buffers_t const * p_ring;
+    uint8_t                    ring_size;
+    uint8_t                    ring_idx;
+    uint8_t                    ring_queued;
+    uint8_t                    ring_held;
+    nrfx_i2s_ring_stats_t      ring_stats;
 } nrfx_i2s_control_block_t;
 /** @endcond */
 
@@ -334,6 +355,8 @@ int nrfx_i2s_start(nrfx_i2s_t *               p_instance,
  * @retval 0            If the operation was successful.
  * @retval -EINPROGRESS If the buffers were already supplied or
  *                      the peripheral is currently being stopped.
+ * @retval -EPERM       The transfer is running in ring mode, in which the driver
+ *                      supplies the buffers by itself.
  * @retval -EACCES      The provided buffers are not placed in the Data RAM region.
  *
  * @sa nrfx_i2s_data_handler_t
@@ -341,6 +364,78 @@ int nrfx_i2s_start(nrfx_i2s_t *               p_instance,
 int nrfx_i2s_next_buffers_set(nrfx_i2s_t *               p_instance,
                               nrfx_i2s_buffers_t const * p_buffers);
 
+/**
+ * @brief Function for starting the continuous I2S transfer in ring mode.
+ *
+ * In ring mode, the driver is given all buffers up front and supplies them
+ * to the peripheral by itself, in the order in which they are placed in the array.
+ * Buffers are passed to the data handler with @ref NRFX_I2S_STATUS_BUFFER_RELEASED
+ * when the peripheral is done with them and must be given back in the same order
+ * with @ref nrfx_i2s_ring_buffer_return. The application thus does not need to
+ * react to every buffer period, as long as at least one buffer is queued in the driver.
+ * When no buffer is queued, the peripheral reuses the current buffers and
+ * the appropriate counter in @ref nrfx_i2s_ring_stats_t is incremented.
+ *
+ * All ring entries must use the same directions (RX, TX or both) and the same
+ * buffer size. For TX, the buffers are expected to be filled before the call.
+ * The array itself must remain valid until the transfer is stopped.
+ *
+ * @note When the transfer is stopped, buffers held by the peripheral are released
+ *       as described in @ref nrfx_i2s_data_handler_t. From this point, all ring
+ *       buffers are owned by the application again.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_ring     Pointer to the array of buffers forming the ring.
+ * @param[in] count      Number of entries in the ring. Must be at least 2.
+ * @param[in] flags      Transfer options (0 for default settings).
+ *                       Currently, no additional flags are available.
+ *
+ * @retval 0            The operation was successful.
+ * @retval -EINPROGRESS Transfer was already started or the driver has not been initialized.
+ * @retval -EINVAL      The ring is too short or its entries are not consistent.
+ * @retval -EACCES      The provided buffers are not placed in the Data RAM region.
+ */
+int nrfx_i2s_ring_start(nrfx_i2s_t *               p_instance,
+                        nrfx_i2s_buffers_t const * p_ring,
+                        uint8_t                    count,
+                        uint8_t                    flags);
+
+/**
+ * @brief Function for giving the oldest released ring buffer back to the driver.
+ *
+ * The buffer is queued for processing again. When the driver has already run
+ * out of buffers, it is supplied to the peripheral immediately.
+ * This function can be called from the data handler.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ *
+ * @retval 0       The buffer was queued.
+ * @retval -EPERM  The transfer is not running in ring mode.
+ * @retval -EINVAL No buffer is currently owned by the application.
+ */
+int nrfx_i2s_ring_buffer_return(nrfx_i2s_t * p_instance);
+
+/**
+ * @brief Function for getting the ring fill level.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ *
+ * @return Number of buffers queued in the driver that the peripheral has not
+ *         started processing yet, including the buffers already scheduled as next.
+ */
+uint8_t nrfx_i2s_ring_fill_level_get(nrfx_i2s_t const * p_instance);
+
+/**
+ * @brief Function for getting the ring mode statistics.
+ *
+ * Counters are cleared when the transfer is started with @ref nrfx_i2s_ring_start.
+ *
+ * @param[in]  p_instance Pointer to the driver instance structure.
+ * @param[out] p_stats    Pointer to the structure to be filled with statistics.
+ */
+void nrfx_i2s_ring_stats_get(nrfx_i2s_t const *      p_instance,
+                             nrfx_i2s_ring_stats_t * p_stats);
+
 /**
  * @brief Function for stopping the I2S transfer.
  *
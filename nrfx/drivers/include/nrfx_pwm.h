@@ -169,12 +169,58 @@ typedef enum
     NRFX_PWM_EVENT_END_SEQ1, /**< End of sequence 1 reached. Its data can be
                                 safely modified now. */
     NRFX_PWM_EVENT_STOPPED,  ///< The PWM peripheral has been stopped.
+    NRFX_PWM_EVENT_STREAM_UNDERRUN, /**< No streaming block was ready in time and the idle
+                                         sequence was played, or a sequence was played
+                                         again because the interrupt was handled too late. */
 } nrfx_pwm_event_type_t;
 
 /** @brief PWM event handler type for user-defined callback function. */
 typedef void (* nrfx_pwm_event_handler_t)(nrfx_pwm_event_type_t event_type, void * p_context);
 
+/**
+ * @brief PWM streaming producer type.
+ *
+ * Called from the PWM interrupt to fill a free block of the streaming ring.
+ *
+ * @param[out] p_values  Block to be filled.
+ * @param[in]  length    Number of 16-bit values in the block.
+ * @param[in]  p_context Context passed in @ref nrfx_pwm_stream_config_t.
+ *
+ * @retval true  The block has been filled.
+ * @retval false No data available at the moment. The producer is called again
+ *               on the next sequence end.
+ */
+typedef bool (* nrfx_pwm_stream_producer_t)(uint16_t * p_values, uint16_t length, void * p_context);
+
+/** @brief PWM streaming configuration structure. */
+typedef struct
+{
+    uint16_t *                 p_buffer;     ///< Ring buffer of @p block_count blocks of @p block_length values.
+                                             /**< Must be in RAM and cannot be allocated on the stack. */
+    uint16_t                   block_length; ///< Number of 16-bit values in a block.
+                                             /**< At most the sequence length limit of the peripheral,
+                                              *   which is 32767 values on nRF52. */
+    uint8_t                    block_count;  ///< Number of blocks in the ring buffer (2 to 32).
+    uint32_t                   repeats;      ///< Number of times each duty cycle value is repeated, as in @ref nrf_pwm_sequence_t.
+    nrf_pwm_sequence_t const * p_idle;       ///< Sequence played when no block is ready.
+    nrfx_pwm_stream_producer_t producer;     ///< Producer filling the blocks.
+    void *                     p_context;    ///< Context passed to the producer.
+} nrfx_pwm_stream_config_t;
+
 /** @cond Driver internal data */
+typedef struct
+{
+    nrfx_pwm_stream_config_t config;
+    uint32_t                 ready_mask;
+    uint32_t                 busy_mask;
+    uint32_t                 underruns;
+    uint8_t                  fill_idx;
+    uint8_t                  play_idx;
+    int8_t                   seq_block[2];
+    uint8_t                  next_end;
+    bool                     active;
+} nrfx_pwm_stream_cb_t;
+
 typedef struct
 {
 #if NRF_ERRATA_STATIC_CHECK(52, 109)
@@ -186,6 +232,7 @@ typedef struct
     nrfx_drv_state_t volatile state;
     uint32_t                  flags;
     bool                      skip_gpio_cfg;
+    nrfx_pwm_stream_cb_t      stream;
 } nrfx_pwm_control_block_t;
 /** @endcond */
 
@@ -320,6 +367,42 @@ uint32_t nrfx_pwm_complex_playback(nrfx_pwm_t *               p_instance,
                                    uint16_t                   playback_count,
                                    uint32_t                   flags);
 
+/**
+ * @brief Function for starting a streaming playback.
+ *
+ * Sequences 0 and 1 are played alternately in an endless loop. Each time the last
+ * value of a sequence is loaded, the block it played is returned to the ring,
+ * free blocks are filled by the producer, and the next ready block is set up
+ * as that sequence, to be played after the other sequence. The interrupt must be
+ * handled within the playback time of a single block for the playback to be
+ * glitch-free. More blocks in the ring give the producer more time to provide data.
+ *
+ * When no block is ready, the idle sequence is played instead and
+ * @ref NRFX_PWM_EVENT_STREAM_UNDERRUN is reported. The playback continues until
+ * @ref nrfx_pwm_stop is called.
+ *
+ * @note The driver must be initialized with an event handler.
+ * @note Requires the LOOPSDONE-SEQSTART shortcut (@ref NRF_PWM_HAS_SHORT_LOOPSDONE_SEQSTART).
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_config   Pointer to the structure with the streaming configuration.
+ *
+ * @retval 0       The playback has been started.
+ * @retval -EBUSY  The driver is during playback.
+ * @retval -EINVAL The configuration is invalid, for example a block or the idle sequence
+ *                 is longer than a sequence of the peripheral can be.
+ */
+int nrfx_pwm_stream_start(nrfx_pwm_t * p_instance, nrfx_pwm_stream_config_t const * p_config);
+
+/**
+ * @brief Function for getting the number of underruns since the streaming playback started.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ *
+ * @return Number of underruns.
+ */
+uint32_t nrfx_pwm_stream_underruns_get(nrfx_pwm_t const * p_instance);
+
 /**
  * @brief Function for advancing the active sequence.
  *
@@ -184,6 +184,71 @@ typedef struct
 /** @brief QSPI driver event handler type. */
 typedef void (*nrfx_qspi_handler_t)(nrfx_qspi_evt_t event, void * p_context);
 
+/** @brief QSPI request queue request types. */
+typedef enum
+{
+    NRFX_QSPI_REQ_READ,  ///< Read data from the memory.
+    NRFX_QSPI_REQ_WRITE, ///< Write data to the memory.
+    NRFX_QSPI_REQ_ERASE, ///< Erase memory block.
+} nrfx_qspi_req_type_t;
+
+/** @brief QSPI request queue request. */
+typedef struct nrfx_qspi_req_s nrfx_qspi_req_t;
+
+/** @brief Structure for the QSPI request queue request. */
+struct nrfx_qspi_req_s
+{
+    nrfx_qspi_req_type_t type;      ///< Request type.
+    void *               p_buffer;  ///< Pointer to the data buffer. Ignored for erase requests.
+    size_t               size;      ///< Data size in bytes. Ignored for erase requests.
+    uint32_t             addr;      ///< Start address in the memory.
+    nrf_qspi_erase_len_t erase_len; ///< Erase length. Used only for erase requests.
+    int                  result;    ///< Result of the request, valid when the request is completed.
+                                    ///< 0 on success, -ETIMEDOUT if the operation was ended with
+                                    ///< @ref nrfx_qspi_timeout_signal, -ECANCELED if the driver
+                                    ///< was uninitialized, or an error code returned when
+                                    ///< the operation was started.
+    /** @cond Driver internal data. */
+    nrfx_qspi_req_t *    p_next;
+    size_t               offset;
+    /** @endcond */
+};
+
+/**
+ * @brief QSPI request queue completion handler type.
+ *
+ * @param[in] p_req     Pointer to the completed request.
+ * @param[in] p_context Context passed to @ref nrfx_qspi_queue_init.
+ */
+typedef void (*nrfx_qspi_req_handler_t)(nrfx_qspi_req_t * p_req, void * p_context);
+
+/** @brief QSPI request queue configuration structure. */
+typedef struct
+{
+    uint32_t page_size;   ///< Program page size of the memory device. Writes are split at page boundaries.
+    void *   p_page_buf;  ///< Buffer of @p page_size bytes used for coalescing adjacent writes. Can be NULL.
+    void *   p_cache;     ///< Buffer used for read-ahead of sequential reads. Can be NULL.
+    size_t   cache_size;  ///< Size of the read-ahead buffer in bytes.
+    bool     prefetch;    ///< Fill the read-ahead buffer with data following the last read when the queue is idle.
+} nrfx_qspi_queue_config_t;
+
+/**
+ * @brief QSPI request queue default configuration.
+ *
+ * This configuration sets up the request queue with the following options:
+ * - 256-byte program page
+ * - no write coalescing
+ * - no read-ahead
+ */
+#define NRFX_QSPI_QUEUE_DEFAULT_CONFIG \
+{                                      \
+    .page_size  = 256,                 \
+    .p_page_buf = NULL,                \
+    .p_cache    = NULL,                \
+    .cache_size = 0,                   \
+    .prefetch   = false,               \
+}
+
 /**
  * @brief Function for initializing the QSPI driver instance.
  *
@@ -237,6 +302,10 @@ int nrfx_qspi_reconfigure(nrfx_qspi_config_t const * p_config);
 /**
  * @brief Function for uninitializing the QSPI driver instance.
  *
+ * If the request queue mode is enabled, it is disabled and the handler passed to
+ * @ref nrfx_qspi_queue_init is called for each pending request with the result set to
+ * -ECANCELED. Requests must not be submitted from the handler at this point.
+ *
  * @note If a custom instruction long transfer is ongoing when the function is called,
  *       the transfer will be interrupted.
  */
@@ -296,7 +365,8 @@ bool nrfx_qspi_init_check(void);
  * @param[in]  src_address      Address in memory to read from.
  *
  * @retval 0          The operation was successful (blocking mode) or commissioned (handler mode).
- * @retval -EBUSY     The driver currently handles another operation.
+ * @retval -EBUSY     The driver currently handles another operation,
+ *                    or the request queue mode is enabled.
  * @retval -ETIMEDOUT The external memory is busy, or there are connection issues.
  * @retval -EACCES    The provided buffer is not placed in the Data RAM region
  *                    or its address is not aligned to a 32-bit word.
@@ -331,7 +401,8 @@ int nrfx_qspi_read(void *   p_rx_buffer,
  * @param[in] dst_address      Address in memory to write to.
  *
  * @retval 0          The operation was successful (blocking mode) or commissioned (handler mode).
- * @retval -EBUSY     The driver currently handles other operation.
+ * @retval -EBUSY     The driver currently handles other operation,
+ *                    or the request queue mode is enabled.
  * @retval -ETIMEDOUT The external memory is busy, or there are connection issues.
  * @retval -EACCES    The provided buffer is not placed in the Data RAM region
  *                    or its address is not aligned to a 32-bit word.
@@ -363,7 +434,8 @@ int nrfx_qspi_write(void const * p_tx_buffer,
  *                          field is ommited.
  *
  * @retval 0          The operation was successful (blocking mode) or commissioned (handler mode).
- * @retval -EBUSY     The driver currently handles another operation.
+ * @retval -EBUSY     The driver currently handles another operation,
+ *                    or the request queue mode is enabled.
  * @retval -ETIMEDOUT The external memory is busy, or there are connection issues.
  * @retval -EACCES    The provided start address is not aligned to a 32-bit word.
  * @retval -EPERM     The operation could trigger nRF5340 anomaly 159 due to the current
@@ -378,7 +450,8 @@ int nrfx_qspi_erase(nrf_qspi_erase_len_t length,
  * @note Refer to the note for @ref nrfx_qspi_read.
  *
  * @retval 0          The operation was successful (blocking mode) or commissioned (handler mode).
- * @retval -EBUSY     The driver currently is handling another operation.
+ * @retval -EBUSY     The driver currently is handling another operation,
+ *                    or the request queue mode is enabled.
  * @retval -ETIMEDOUT The external memory is busy, or there are connection issues.
  * @retval -EPERM     The operation could trigger nRF5340 anomaly 159 due to the current
  *                    configuration of clocks. Refer to the errata document for more information.
@@ -550,6 +623,79 @@ int nrfx_qspi_xip_encrypt(nrf_qspi_encryption_t const * p_config);
 int nrfx_qspi_dma_encrypt(nrf_qspi_encryption_t const * p_config);
 #endif
 
+/**
+ * @brief Function for enabling the request queue mode of the QSPI driver.
+ *
+ * In the request queue mode, any number of read, write, and erase requests can be submitted
+ * with @ref nrfx_qspi_queue_submit. The requests are executed in order, one after another,
+ * directly from the driver interrupt handler, so there are no gaps between operations
+ * caused by the application latency. Additionally:
+ * - Writes are split at the @ref nrfx_qspi_queue_config_t.page_size boundaries, so a request
+ *   can be of any size.
+ * - If @ref nrfx_qspi_queue_config_t.p_page_buf is provided, adjacent write requests that
+ *   fall into the same page are gathered and programmed with a single operation.
+ * - If @ref nrfx_qspi_queue_config_t.p_cache is provided, reads not larger than the cache are
+ *   served through it. Sequential reads are then served from RAM without accessing the memory
+ *   device, and the cache can be refilled in the background when the queue becomes idle.
+ *   Buffers of such reads do not need to be word-aligned or placed in the Data RAM region.
+ *
+ * While the request queue mode is enabled, the event handler passed to @ref nrfx_qspi_init
+ * is not called. Completion of each request is signaled with @p handler. Read, write, and
+ * erase operations cannot be started outside of the queue.
+ *
+ * @note The driver must be initialized in non-blocking mode.
+ * @note Start addresses and sizes of write requests, as well as @p page_size, must be
+ *       multiples of 4 bytes.
+ *
+ * @param[in] p_config  Pointer to the structure with the request queue configuration.
+ *                      Buffers it refers to must remain valid until @ref nrfx_qspi_queue_uninit.
+ * @param[in] handler   Request completion handler. Cannot be NULL.
+ * @param[in] p_context Context passed to @p handler.
+ *
+ * @retval 0        The request queue mode has been enabled.
+ * @retval -EBUSY   The driver currently handles another operation.
+ * @retval -EACCES  The provided buffers are not placed in the Data RAM region
+ *                  or are not aligned to a 32-bit word.
+ * @retval -EINVAL  The configuration is invalid.
+ */
+int nrfx_qspi_queue_init(nrfx_qspi_queue_config_t const * p_config,
+                         nrfx_qspi_req_handler_t          handler,
+                         void *                           p_context);
+
+/**
+ * @brief Function for submitting a request to the QSPI request queue.
+ *
+ * The request structure is owned by the driver until @ref nrfx_qspi_req_handler_t is called
+ * for it. Requests are processed in the QSPI interrupt context, so the handler is never called
+ * from within this function, even if the request can be served from the read-ahead buffer.
+ * If no request is in progress, the QSPI interrupt is pended to start the processing.
+ *
+ * @param[in] p_req Pointer to the request.
+ *
+ * @retval 0        The request has been queued.
+ * @retval -EPERM   The request queue mode is not enabled.
+ * @retval -EACCES  The provided buffer is not placed in the Data RAM region
+ *                  or its address is not aligned to a 32-bit word.
+ * @retval -EINVAL  The request parameters are invalid.
+ */
+int nrfx_qspi_queue_submit(nrfx_qspi_req_t * p_req);
+
+/**
+ * @brief Function for checking whether there are any pending requests in the QSPI request queue.
+ *
+ * @retval true  At least one request is pending.
+ * @retval false All requests have been completed.
+ */
+bool nrfx_qspi_queue_pending_check(void);
+
+/**
+ * @brief Function for disabling the request queue mode of the QSPI driver.
+ *
+ * @retval 0      The request queue mode has been disabled.
+ * @retval -EBUSY There are still pending requests.
+ */
+int nrfx_qspi_queue_uninit(void);
+
 /** @} */
 
 
@@ -194,6 +194,20 @@ typedef struct
  */
 #define NRFX_TDM_STATUS_TRANSFER_STOPPED    (1UL << 1)
 
+/** @brief TDM status flag indicating, in ring mode only, that the peripheral has finished
+ *  processing the buffers passed to the data handler and they are now owned by
+ *  the application. They are to be given back to the driver with a call to
+ *  @ref nrfx_tdm_ring_buffer_return once processed.
+ */
+#define NRFX_TDM_STATUS_BUFFER_RELEASED     (1UL << 2)
+
+/** @brief Structure for TDM ring mode statistics. */
+typedef struct
+{
+    uint32_t underrun_count; ///< Number of times TX data was repeated because no buffer was queued.
+    uint32_t overrun_count;  ///< Number of times RX data was overwritten because no buffer was queued.
+} nrfx_tdm_ring_stats_t;
+
 /**
  * @brief TDM driver data handler type.
  *
@@ -238,6 +252,7 @@ typedef struct
  *                    It can be 0 or a combination of the following flags:
  *                    - @ref NRFX_TDM_STATUS_NEXT_BUFFERS_NEEDED
  *                    - @ref NRFX_TDM_STATUS_TRANSFER_STOPPED
+ *                    - @ref NRFX_TDM_STATUS_BUFFER_RELEASED
  */
 typedef void (* nrfx_tdm_data_handler_t)(nrfx_tdm_buffers_t const * p_released,
                                          uint32_t                   status);
@@ -256,6 +271,13 @@ typedef struct
     bool                    tx_ready;
     bool                    buffers_needed;
     bool                    buffers_reused;
+
+    nrfx_tdm_buffers_t const * p_ring;
+    uint8_t                    ring_size;
+    uint8_t                    ring_idx;
+    uint8_t                    ring_queued;
+    uint8_t                    ring_held;
+    nrfx_tdm_ring_stats_t      ring_stats;
 } nrfx_tdm_control_block_t;
 /** @endcond */
 
@@ -372,6 +394,8 @@ int nrfx_tdm_start(nrfx_tdm_t *               p_instance,
  * @retval 0            If the operation was successful.
  * @retval -EINPROGRESS If the buffers were already supplied or
  *                      the peripheral is currently being stopped.
+ * @retval -EPERM       The transfer is running in ring mode, in which the driver
+ *                      supplies the buffers by itself.
  * @retval -EINVAL      Required buffers were not provided or the provided
  *                      transfer length is too short.
  * @retval -EACCES      The provided buffers are not placed in the Data RAM region.
@@ -379,6 +403,75 @@ int nrfx_tdm_start(nrfx_tdm_t *               p_instance,
 int nrfx_tdm_next_buffers_set(nrfx_tdm_t *               p_instance,
                               nrfx_tdm_buffers_t const * p_buffers);
 
+/**
+ * @brief Function for starting the continuous TDM transfer in ring mode.
+ *
+ * In ring mode, the driver is given all buffers up front and supplies them
+ * to the peripheral by itself, in the order in which they are placed in the array.
+ * Buffers are passed to the data handler with @ref NRFX_TDM_STATUS_BUFFER_RELEASED
+ * when the peripheral is done with them and must be given back in the same order
+ * with @ref nrfx_tdm_ring_buffer_return. The application thus does not need to
+ * react to every buffer period, as long as at least one buffer is queued in the driver.
+ * When no buffer is queued, the peripheral reuses the current buffers and
+ * the appropriate counter in @ref nrfx_tdm_ring_stats_t is incremented.
+ *
+ * All ring entries must use the same directions (RX, TX or both) and the same buffer sizes
+ * as the first one. When both directions are used, the RX and TX buffer sizes must be equal,
+ * because the buffers of both directions are supplied together.
+ * For TX, the buffers are expected to be filled before the call.
+ * The array itself must remain valid until the transfer is stopped.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_ring     Pointer to the array of buffers forming the ring.
+ * @param[in] count      Number of entries in the ring. Must be at least 2.
+ *
+ * @retval 0            The operation was successful.
+ * @retval -EINPROGRESS The driver has not been initialized.
+ * @retval -EALREADY    Transfer has already been already started.
+ * @retval -EINVAL      The ring is too short, its entries are not consistent
+ *                      or the provided transfer length is too short.
+ * @retval -EACCES      The provided buffers are not placed in the Data RAM region.
+ */
+int nrfx_tdm_ring_start(nrfx_tdm_t *               p_instance,
+                        nrfx_tdm_buffers_t const * p_ring,
+                        uint8_t                    count);
+
+/**
+ * @brief Function for giving the oldest released ring buffer back to the driver.
+ *
+ * The buffer is queued for processing again. When the driver has already run
+ * out of buffers, it is supplied to the peripheral immediately.
+ * This function can be called from the data handler.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ *
+ * @retval 0       The buffer was queued.
+ * @retval -EPERM  The transfer is not running in ring mode.
+ * @retval -EINVAL No buffer is currently owned by the application.
+ */
+int nrfx_tdm_ring_buffer_return(nrfx_tdm_t * p_instance);
+
+/**
+ * @brief Function for getting the ring fill level.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ *
+ * @return Number of buffers queued in the driver that the peripheral has not
+ *         started processing yet, including the buffers already scheduled as next.
+ */
+uint8_t nrfx_tdm_ring_fill_level_get(nrfx_tdm_t const * p_instance);
+
+/**
+ * @brief Function for getting the ring mode statistics.
+ *
+ * Counters are cleared when the transfer is started with @ref nrfx_tdm_ring_start.
+ *
+ * @param[in]  p_instance Pointer to the driver instance structure.
+ * @param[out] p_stats    Pointer to the structure to be filled with statistics.
+ */
+void nrfx_tdm_ring_stats_get(nrfx_tdm_t const *      p_instance,
+                             nrfx_tdm_ring_stats_t * p_stats);
+
 /**
  * @brief Function for stopping the TDM transfer.
  *
@@ -84,6 +84,7 @@ typedef struct
 {
     nrfx_twim_event_type_t type;      ///< Event type.
     nrfx_twim_xfer_desc_t  xfer_desc; ///< Transfer details.
+    size_t                 cmd_idx;   ///< Index of the entry of @ref nrfx_twim_cmd_list_xfer.
 } nrfx_twim_event_t;
 
 /** @brief TWIM driver event handler type. */
@@ -110,6 +111,10 @@ typedef struct
 #if NRF_ERRATA_STATIC_CHECK(52, 109)
     nrf_twim_frequency_t      bus_frequency;
 #endif
+    nrfx_twim_xfer_desc_t const * p_cmd_list;
+    size_t                        cmd_count;
+    size_t                        cmd_idx;
+    uint32_t                      cmd_flags;
 } nrfx_twim_control_block_t;
 /** @endcond */
 
@@ -373,6 +378,51 @@ int nrfx_twim_xfer(nrfx_twim_t *                 p_instance,
                    nrfx_twim_xfer_desc_t const * p_xfer_desc,
                    uint32_t                      flags);
 
+/**
+ * @brief Function for performing a list of TWIM transfers as a single operation.
+ *
+ * The transfers from @p p_cmd_list are executed one after another. The next transfer is
+ * set up and started directly from the driver interrupt handler, so a set of sensors
+ * or registers can be polled without any involvement of the application. The event
+ * handler is called only once, after the last transfer is finished, with
+ * the @ref NRFX_TWIM_EVT_DONE event. If any of the transfers fails, the remaining
+ * ones are skipped and the corresponding error event is generated. If the next transfer
+ * cannot be started, the list is stopped with the @ref NRFX_TWIM_EVT_BUS_ERROR event.
+ * The @ref nrfx_twim_event_t.cmd_idx field holds the index of the entry the event refers to.
+ *
+ * Only @ref NRFX_TWIM_XFER_TX, @ref NRFX_TWIM_XFER_RX, and @ref NRFX_TWIM_XFER_TXRX
+ * transfer types are supported in the command list.
+ *
+ * Additional options are provided using the flags parameter:
+ * - @ref NRFX_TWIM_FLAG_HOLD_XFER - Driver does not start the first transfer of the list.
+ *   Use @ref nrfx_twim_start_task_address_get with the type of the first entry to get
+ *   the address of the task that must be triggered externally, for example by a TIMER
+ *   COMPARE event connected through (D)PPI. The remaining transfers are started by the driver.
+ * - @ref NRFX_TWIM_FLAG_REPEATED_XFER - After the list is finished and the event handler is
+ *   called, the first transfer is set up again and held until it is triggered externally.
+ *   Must be used together with @ref NRFX_TWIM_FLAG_HOLD_XFER. This allows periodic
+ *   polling with no application activity between rounds. The operation
+ *   can be stopped with @ref nrfx_twim_disable.
+ *
+ * @note The command list and all buffers it refers to must remain valid until the operation
+ *       is finished. The list itself does not need to be placed in the Data RAM region.
+ * @note This function is supported only in non-blocking mode.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_cmd_list Pointer to the array of transfer descriptors.
+ * @param[in] count      Number of entries in @p p_cmd_list.
+ * @param[in] flags      Command list options (0 for default settings).
+ *
+ * @retval 0        The procedure is successful.
+ * @retval -EBUSY   The driver is not ready for a new transfer.
+ * @retval -ENOTSUP The provided parameters are not supported.
+ * @retval -EACCES  The provided buffers are not placed in the Data RAM region.
+ */
+int nrfx_twim_cmd_list_xfer(nrfx_twim_t *                 p_instance,
+                            nrfx_twim_xfer_desc_t const * p_cmd_list,
+                            size_t                        count,
+                            uint32_t                      flags);
+
 /**
  * @brief Function for checking the TWIM driver state.
  *
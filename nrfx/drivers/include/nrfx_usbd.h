@@ -382,6 +382,22 @@ typedef struct
     uint16_t wLength;       //!< byte 6, 7
 } nrfx_usbd_setup_t;
 
+/**
+ * @brief DMA statistics of the endpoint.
+ *
+ * Wait time is the time between the endpoint becoming ready for the DMA transfer (data
+ * provided by the application and endpoint buffer available) and the start of the transfer.
+ * It is expressed in ticks of NRFX_USBD_DMA_TIMESTAMP_GET, which by default is the CPU cycle
+ * counter (DWT->CYCCNT). The counter must be enabled by the application, by setting the TRCENA
+ * bit in CoreDebug->DEMCR and the CYCCNTENA bit in DWT->CTRL. Otherwise, the wait times are zero.
+ */
+typedef struct
+{
+    uint32_t transfers;  //!< Number of DMA transfers.
+    uint32_t wait_total; //!< Sum of wait times.
+    uint32_t wait_max;   //!< Maximum wait time.
+} nrfx_usbd_ep_dma_stats_t;
+
 /**
  * @brief Driver initialization.
  *
@@ -610,6 +626,35 @@ void nrfx_usbd_ep_max_packet_size_set(nrfx_usbd_ep_t ep, uint16_t size);
  */
 uint16_t nrfx_usbd_ep_max_packet_size_get(nrfx_usbd_ep_t ep);
 
+/**
+ * @brief Set the DMA priority of the endpoint.
+ *
+ * Endpoints with high priority are served by the DMA scheduler before the other
+ * non-isochronous endpoints. It is intended for interrupt endpoints which have bounded latency
+ * requirements and should not wait behind the bulk traffic.
+ *
+ * @param[in] ep   Endpoint number.
+ * @param[in] high True if endpoint has high priority, false otherwise.
+ */
+void nrfx_usbd_ep_dma_priority_set(nrfx_usbd_ep_t ep, bool high);
+
+#if NRFX_CHECK(NRFX_USBD_CONFIG_DMA_STATS_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Get the DMA statistics of the endpoint.
+ *
+ * @param[in]  ep      Endpoint number.
+ * @param[out] p_stats Pointer to the structure to be filled with the statistics.
+ */
+void nrfx_usbd_ep_dma_stats_get(nrfx_usbd_ep_t ep, nrfx_usbd_ep_dma_stats_t * p_stats);
+
+/**
+ * @brief Clear the DMA statistics of the endpoint.
+ *
+ * @param[in] ep Endpoint number.
+ */
+void nrfx_usbd_ep_dma_stats_clear(nrfx_usbd_ep_t ep);
+#endif
+
 /**
  * @brief Check if the selected endpoint is enabled.
  *
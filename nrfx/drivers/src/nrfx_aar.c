@@ -0,0 +1,625 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+#include <nrfx.h>
+#include <nrfx_aar.h>
+
+#define NRFX_LOG_MODULE AAR
+#include <nrfx_log.h>
+
+#if defined(NRF_AAR00)
+#define AAR_REG NRF_AAR00
+#else
+#define AAR_REG NRF_AAR
+#endif
+
+#define AAR_IRQN nrfx_get_irq_number(AAR_REG)
+
+/* Number of IRKs processed by a single resolution run on devices without job lists. */
+#define AAR_IRK_WINDOW_SIZE 16
+
+/* Offset of the address in the packet pointed to by ADDRPTR on devices without job lists.
+ * The address follows the S0, LENGTH and S1 fields of the packet header. */
+#define AAR_ADDR_PACKET_OFFSET 3
+
+#if NRF_AAR_HAS_IN_PTR
+/* Job attributes identifying the elements of the AAR data structures. */
+#define AAR_JOB_ATTR_HASH  11
+#define AAR_JOB_ATTR_PRAND 12
+#define AAR_JOB_ATTR_IRK   13
+#define AAR_JOB_ATTR_INDEX 11
+
+#define AAR_HASH_SIZE  3
+#define AAR_PRAND_SIZE 3
+#endif
+
+#if NRF_AAR_HAS_ERROR
+#define AAR_INT_MASK (NRF_AAR_INT_END_MASK | NRF_AAR_INT_ERROR_MASK)
+#else
+#define AAR_INT_MASK NRF_AAR_INT_END_MASK
+#endif
+
+/* Control block - driver instance local data. */
+typedef struct
+{
+    nrfx_aar_batch_t * volatile p_batch;   /* Batch being resolved. */
+    size_t                      addr_idx;  /* Index of the address being resolved. */
+    bool                        hw_active; /* Resolution run in progress. */
+    nrfx_aar_irk_table_t        table;
+    nrfx_aar_cache_entry_t *    p_cache;
+    uint8_t                     cache_size;
+    uint32_t                    stamp;     /* Last usage stamp assigned to a cache entry. */
+#if NRF_AAR_HAS_IN_PTR
+    nrf_vdma_job_t              out_job[2];
+    uint16_t                    out_idx;
+#else
+    uint16_t                    irk_base;  /* Index of the first IRK in the current window. */
+    uint8_t                     addr_packet[AAR_ADDR_PACKET_OFFSET + NRFX_AAR_ADDR_SIZE];
+#if NRF_AAR_HAS_SCRATCHPTR
+    uint8_t                     scratch[3];
+#endif
+#endif
+    nrfx_drv_state_t            state;
+} aar_control_block_t;
+
+static aar_control_block_t m_cb;
+
+/* AES S-box used by the software fallback. */
+static const uint8_t m_sbox[256] =
+{
+    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+    0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+    0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+    0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+    0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+    0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+    0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+    0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+    0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+    0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+    0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16,
+};
+
+static uint8_t xtime(uint8_t x)
+{
+    return (uint8_t)((x << 1) ^ ((x & 0x80) ? 0x1b : 0x00));
+}
+
+/* AES-128 block encryption with the round keys expanded on the fly. */
+static void aes_encrypt(uint8_t const * p_key, uint8_t const * p_in, uint8_t * p_out)
+{
+    uint8_t state[16];
+    uint8_t tmp[16];
+    uint8_t rk[16];
+    uint8_t rcon = 0x01;
+
+    for (size_t i = 0; i < 16; i++)
+    {
+        rk[i]    = p_key[i];
+        state[i] = p_in[i] ^ rk[i];
+    }
+
+    for (size_t round = 1; round <= 10; round++)
+    {
+        /* SubBytes and ShiftRows. */
+        for (size_t c = 0; c < 4; c++)
+        {
+            for (size_t r = 0; r < 4; r++)
+            {
+                tmp[4 * c + r] = m_sbox[state[4 * ((c + r) % 4) + r]];
+            }
+        }
+
+        /* MixColumns, skipped in the last round. */
+        if (round < 10)
+        {
+            for (size_t c = 0; c < 4; c++)
+            {
+                uint8_t * p_col = &tmp[4 * c];
+                uint8_t   a0    = p_col[0];
+                uint8_t   all   = p_col[0] ^ p_col[1] ^ p_col[2] ^ p_col[3];
+
+                p_col[0] ^= all ^ xtime(p_col[0] ^ p_col[1]);
+                p_col[1] ^= all ^ xtime(p_col[1] ^ p_col[2]);
+                p_col[2] ^= all ^ xtime(p_col[2] ^ p_col[3]);
+                p_col[3] ^= all ^ xtime(p_col[3] ^ a0);
+            }
+        }
+
+        /* Next round key. */
+        rk[0] ^= m_sbox[rk[13]] ^ rcon;
+        rk[1] ^= m_sbox[rk[14]];
+        rk[2] ^= m_sbox[rk[15]];
+        rk[3] ^= m_sbox[rk[12]];
+        for (size_t i = 4; i < 16; i++)
+        {
+            rk[i] ^= rk[i - 4];
+        }
+        rcon = xtime(rcon);
+
+        for (size_t i = 0; i < 16; i++)
+        {
+            state[i] = tmp[i] ^ rk[i];
+        }
+    }
+
+    for (size_t i = 0; i < 16; i++)
+    {
+        p_out[i] = state[i];
+    }
+}
+
+/* Bluetooth random address hash function ah() computed for the prand part of the address
+ * and compared against its hash part. The address is in on-air (little-endian) byte order,
+ * while the AES block is big-endian. */
+static bool addr_match_sw(uint8_t const * p_irk, uint8_t const * p_addr)
+{
+    uint8_t block[16] = {0};
+
+    block[13] = p_addr[5];
+    block[14] = p_addr[4];
+    block[15] = p_addr[3];
+    aes_encrypt(p_irk, block, block);
+
+    return (block[13] == p_addr[2]) && (block[14] == p_addr[1]) && (block[15] == p_addr[0]);
+}
+
+static nrfx_aar_cache_entry_t * cache_find(uint8_t const * p_addr)
+{
+    for (size_t i = 0; i < m_cb.cache_size; i++)
+    {
+        nrfx_aar_cache_entry_t * p_entry = &m_cb.p_cache[i];
+
+        if (p_entry->stamp && !memcmp(p_entry->addr, p_addr, NRFX_AAR_ADDR_SIZE))
+        {
+            return p_entry;
+        }
+    }
+    return NULL;
+}
+
+static uint32_t stamp_next(void)
+{
+    /* Zero marks an empty entry. A wrap-around only affects the eviction order. */
+    if (++m_cb.stamp == 0)
+    {
+        m_cb.stamp = 1;
+    }
+    return m_cb.stamp;
+}
+
+static void cache_store(uint8_t const * p_addr, int16_t irk_idx)
+{
+    nrfx_aar_cache_entry_t * p_victim = NULL;
+
+    for (size_t i = 0; i < m_cb.cache_size; i++)
+    {
+        nrfx_aar_cache_entry_t * p_entry = &m_cb.p_cache[i];
+
+        if (p_entry->stamp == 0)
+        {
+            p_victim = p_entry;
+            break;
+        }
+        if (!p_victim || (p_entry->stamp < p_victim->stamp))
+        {
+            p_victim = p_entry;
+        }
+    }
+
+    if (p_victim)
+    {
+        memcpy(p_victim->addr, p_addr, NRFX_AAR_ADDR_SIZE);
+        p_victim->irk_idx = irk_idx;
+        p_victim->stamp   = stamp_next();
+    }
+}
+
+#if !NRF_AAR_HAS_IN_PTR
+static void irk_window_start(void)
+{
+    uint16_t count = (uint16_t)(m_cb.table.irk_count - m_cb.irk_base);
+
+    if (count > AAR_IRK_WINDOW_SIZE)
+    {
+        count = AAR_IRK_WINDOW_SIZE;
+    }
+
+    nrf_aar_irk_pointer_set(AAR_REG, &m_cb.table.p_irks[m_cb.irk_base * NRFX_AAR_IRK_SIZE]);
+    nrf_aar_irk_number_set(AAR_REG, (uint8_t)count);
+    nrf_aar_addr_pointer_set(AAR_REG, m_cb.addr_packet);
+    nrf_aar_task_trigger(AAR_REG, NRF_AAR_TASK_START);
+}
+#endif
+
+/* Resolves the consecutive addresses of the batch that are found in the cache and starts
+ * the hardware for the first one that is not. Returns false if the batch is completed. */
+static bool address_next(void)
+{
+    nrfx_aar_batch_t * p_batch = m_cb.p_batch;
+
+    for (; m_cb.addr_idx < p_batch->count; m_cb.addr_idx++)
+    {
+        uint8_t const *          p_addr  = &p_batch->p_addrs[m_cb.addr_idx * NRFX_AAR_ADDR_SIZE];
+        nrfx_aar_cache_entry_t * p_entry = cache_find(p_addr);
+
+        if (p_entry == NULL)
+        {
+            m_cb.hw_active = true;
+#if NRF_AAR_HAS_IN_PTR
+            /* Only the address elements change, the IRK part of the job list is reused. */
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+#endif /* __GNUC__ */
+            m_cb.table.p_jobs[0].p_buffer = (uint8_t *)p_addr;
+            m_cb.table.p_jobs[1].p_buffer = (uint8_t *)&p_addr[AAR_HASH_SIZE];
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif /* __GNUC__ */
+            nrf_aar_task_trigger(AAR_REG, NRF_AAR_TASK_START);
+#else
+            /* The hardware reads the address from a radio packet. */
+            memcpy(&m_cb.addr_packet[AAR_ADDR_PACKET_OFFSET], p_addr, NRFX_AAR_ADDR_SIZE);
+            m_cb.irk_base = 0;
+            irk_window_start();
+#endif
+            return true;
+        }
+
+        p_entry->stamp = stamp_next();
+        p_batch->p_results[m_cb.addr_idx] = p_entry->irk_idx;
+    }
+
+    return false;
+}
+
+static void batch_complete(int result)
+{
+    nrfx_aar_batch_t * p_batch = m_cb.p_batch;
+
+    nrf_aar_disable(AAR_REG);
+    m_cb.hw_active = false;
+    m_cb.p_batch   = NULL;
+
+    NRFX_LOG_DEBUG("Batch completed, %d addresses.", (int)p_batch->count);
+    p_batch->handler(p_batch, result, p_batch->p_context);
+}
+
+static void table_jobs_build(void)
+{
+#if NRF_AAR_HAS_IN_PTR
+    nrf_vdma_job_t * p_jobs = m_cb.table.p_jobs;
+
+    /* The address buffers are set for each resolution run. */
+    nrf_vdma_job_fill(&p_jobs[0], NULL, AAR_HASH_SIZE, AAR_JOB_ATTR_HASH);
+    nrf_vdma_job_fill(&p_jobs[1], NULL, AAR_PRAND_SIZE, AAR_JOB_ATTR_PRAND);
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+#endif /* __GNUC__ */
+    for (uint16_t i = 0; i < m_cb.table.irk_count; i++)
+    {
+        nrf_vdma_job_fill(&p_jobs[2 + i],
+                          (void *)&m_cb.table.p_irks[i * NRFX_AAR_IRK_SIZE],
+                          NRFX_AAR_IRK_SIZE,
+                          AAR_JOB_ATTR_IRK);
+    }
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif /* __GNUC__ */
+    nrf_vdma_job_terminate(&p_jobs[2 + m_cb.table.irk_count]);
+
+    nrf_aar_in_ptr_set(AAR_REG, p_jobs);
+#endif
+}
+
+int nrfx_aar_init(nrfx_aar_config_t const * p_config)
+{
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(p_config->p_cache || (p_config->cache_size == 0));
+
+    int err_code;
+
+    if (m_cb.state != NRFX_DRV_STATE_UNINITIALIZED)
+    {
+        err_code = -EALREADY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    m_cb.p_batch         = NULL;
+    m_cb.hw_active       = false;
+    m_cb.table.p_irks    = NULL;
+    m_cb.table.irk_count = 0;
+    m_cb.p_cache         = p_config->p_cache;
+    m_cb.cache_size      = p_config->cache_size;
+    m_cb.stamp           = 0;
+    if (m_cb.p_cache)
+    {
+        memset(m_cb.p_cache, 0, m_cb.cache_size * sizeof(nrfx_aar_cache_entry_t));
+    }
+
+#if NRF_AAR_HAS_IN_PTR
+    nrf_vdma_job_fill(&m_cb.out_job[0], &m_cb.out_idx, sizeof(m_cb.out_idx),
+                      AAR_JOB_ATTR_INDEX);
+    nrf_vdma_job_terminate(&m_cb.out_job[1]);
+    nrf_aar_out_ptr_set(AAR_REG, m_cb.out_job);
+    nrf_aar_maxresolved_set(AAR_REG, 1);
+#elif NRF_AAR_HAS_SCRATCHPTR
+    nrf_aar_scratch_pointer_set(AAR_REG, m_cb.scratch);
+#endif
+
+    nrf_aar_event_clear(AAR_REG, NRF_AAR_EVENT_END);
+    nrf_aar_event_clear(AAR_REG, NRF_AAR_EVENT_RESOLVED);
+    nrf_aar_event_clear(AAR_REG, NRF_AAR_EVENT_NOTRESOLVED);
+#if NRF_AAR_HAS_ERROR
+    nrf_aar_event_clear(AAR_REG, NRF_AAR_EVENT_ERROR);
+#endif
+    nrf_aar_int_enable(AAR_REG, AAR_INT_MASK);
+    NRFX_IRQ_PRIORITY_SET(AAR_IRQN, p_config->interrupt_priority);
+    NRFX_IRQ_ENABLE(AAR_IRQN);
+
+    m_cb.state = NRFX_DRV_STATE_INITIALIZED;
+
+    err_code = 0;
+    NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+void nrfx_aar_uninit(void)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+
+    NRFX_IRQ_DISABLE(AAR_IRQN);
+    nrf_aar_int_disable(AAR_REG, AAR_INT_MASK);
+    if (m_cb.hw_active)
+    {
+        nrf_aar_task_trigger(AAR_REG, NRF_AAR_TASK_STOP);
+    }
+    nrf_aar_disable(AAR_REG);
+    nrf_aar_event_clear(AAR_REG, NRF_AAR_EVENT_END);
+    nrf_aar_event_clear(AAR_REG, NRF_AAR_EVENT_RESOLVED);
+    nrf_aar_event_clear(AAR_REG, NRF_AAR_EVENT_NOTRESOLVED);
+#if NRF_AAR_HAS_ERROR
+    nrf_aar_event_clear(AAR_REG, NRF_AAR_EVENT_ERROR);
+#endif
+
+    m_cb.p_batch   = NULL;
+    m_cb.hw_active = false;
+
+    m_cb.state = NRFX_DRV_STATE_UNINITIALIZED;
+    NRFX_LOG_INFO("Uninitialized.");
+}
+
+bool nrfx_aar_init_check(void)
+{
+    return (m_cb.state != NRFX_DRV_STATE_UNINITIALIZED);
+}
+
+int nrfx_aar_irk_table_set(nrfx_aar_irk_table_t const * p_table)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(p_table);
+
+    int err_code;
+
+    if (m_cb.p_batch)
+    {
+        err_code = -EBUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if ((p_table->irk_count == 0) || (p_table->p_irks == NULL)
+#if NRF_AAR_HAS_IN_PTR
+        || (p_table->p_jobs == NULL)
+#endif
+       )
+    {
+        err_code = -EINVAL;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    m_cb.table = *p_table;
+    table_jobs_build();
+    nrfx_aar_cache_flush();
+
+    return 0;
+}
+
+int nrfx_aar_batch_resolve(nrfx_aar_batch_t *       p_batch,
+                           nrfx_aar_batch_handler_t handler,
+                           void *                   p_context)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(p_batch);
+    NRFX_ASSERT(handler);
+
+    int err_code;
+
+    if ((p_batch->count == 0) || (p_batch->p_addrs == NULL) || (p_batch->p_results == NULL) ||
+        (m_cb.table.irk_count == 0))
+    {
+        err_code = -EINVAL;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    bool busy;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    busy = (m_cb.p_batch != NULL);
+    if (!busy)
+    {
+        m_cb.p_batch = p_batch;
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if (busy)
+    {
+        err_code = -EBUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_batch->handler   = handler;
+    p_batch->p_context = p_context;
+    m_cb.addr_idx      = 0;
+
+    nrf_aar_enable(AAR_REG);
+    if (!address_next())
+    {
+        /* All addresses were found in the cache. Complete the batch from the interrupt
+         * context, as in the other cases. */
+        NRFX_IRQ_PENDING_SET(AAR_IRQN);
+    }
+
+    return 0;
+}
+
+void nrfx_aar_cache_flush(void)
+{
+    NRFX_CRITICAL_SECTION_ENTER();
+    for (size_t i = 0; i < m_cb.cache_size; i++)
+    {
+        m_cb.p_cache[i].stamp = 0;
+    }
+    m_cb.stamp = 0;
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+int16_t nrfx_aar_sw_resolve(nrfx_aar_irk_table_t const * p_table, uint8_t const * p_addr)
+{
+    NRFX_ASSERT(p_table);
+    NRFX_ASSERT(p_addr);
+
+    for (uint16_t i = 0; i < p_table->irk_count; i++)
+    {
+        if (addr_match_sw(&p_table->p_irks[i * NRFX_AAR_IRK_SIZE], p_addr))
+        {
+            return (int16_t)i;
+        }
+    }
+    return NRFX_AAR_NOT_RESOLVED;
+}
+
+void nrfx_aar_irq_handler(void)
+{
+    nrfx_aar_batch_t * p_batch = m_cb.p_batch;
+
+#if NRF_AAR_HAS_ERROR
+    if (nrf_aar_event_check(AAR_REG, NRF_AAR_EVENT_ERROR))
+    {
+        nrf_aar_event_clear(AAR_REG, NRF_AAR_EVENT_ERROR);
+        nrf_aar_event_clear(AAR_REG, NRF_AAR_EVENT_END);
+        NRFX_LOG_DEBUG("Event: NRF_AAR_EVENT_ERROR, error: %d.",
+                       (int)nrf_aar_error_get(AAR_REG));
+        if (p_batch)
+        {
+            batch_complete(-ECANCELED);
+        }
+        return;
+    }
+#endif
+
+    if (nrf_aar_event_check(AAR_REG, NRF_AAR_EVENT_END))
+    {
+        nrf_aar_event_clear(AAR_REG, NRF_AAR_EVENT_END);
+
+        bool resolved = nrf_aar_event_check(AAR_REG, NRF_AAR_EVENT_RESOLVED);
+
+        nrf_aar_event_clear(AAR_REG, NRF_AAR_EVENT_RESOLVED);
+        nrf_aar_event_clear(AAR_REG, NRF_AAR_EVENT_NOTRESOLVED);
+
+        if ((p_batch == NULL) || !m_cb.hw_active)
+        {
+            return;
+        }
+
+        uint8_t const * p_addr = &p_batch->p_addrs[m_cb.addr_idx * NRFX_AAR_ADDR_SIZE];
+        int16_t         irk_idx;
+
+#if NRF_AAR_HAS_IN_PTR
+        irk_idx = resolved ? (int16_t)m_cb.out_idx : NRFX_AAR_NOT_RESOLVED;
+#else
+        if (resolved)
+        {
+            irk_idx = (int16_t)(m_cb.irk_base + nrf_aar_resolution_status_get(AAR_REG));
+        }
+        else if (m_cb.irk_base + AAR_IRK_WINDOW_SIZE < m_cb.table.irk_count)
+        {
+            m_cb.irk_base += AAR_IRK_WINDOW_SIZE;
+            irk_window_start();
+            return;
+        }
+        else
+        {
+            irk_idx = NRFX_AAR_NOT_RESOLVED;
+        }
+#endif
+
+        m_cb.hw_active = false;
+        p_batch->p_results[m_cb.addr_idx] = irk_idx;
+        cache_store(p_addr, irk_idx);
+        m_cb.addr_idx++;
+    }
+    else if ((p_batch == NULL) || m_cb.hw_active)
+    {
+        return;
+    }
+
+    if (!address_next())
+    {
+        batch_complete(0);
+    }
+}
@@ -83,6 +83,19 @@ typedef struct {
     uint8_t          key[CTR_DRBG_KEY_SIZE];
     uint8_t          value[AES_ECB_BLK_SZ];
     uint64_t         reseed_counter;
+    uint8_t          entropy[CTR_DRBG_ENTROPY_SIZE];
+    volatile bool    reseed_pending;
+    bool             entropy_ready;
+    nrfx_cracen_cm_job_t * volatile p_cm_job;
+    uint8_t *        p_pool;
+    size_t           pool_size;
+    size_t           pool_threshold;
+    size_t           pool_rd;
+    volatile size_t  pool_level;
+    size_t           pool_refill;
+    nrfx_cracen_cm_sg_t  pool_sg[3];
+    nrfx_cracen_cm_job_t pool_job;
+    uint8_t          pool_update[CTR_DRBG_ENTROPY_SIZE];
 #endif
     nrfx_drv_state_t initialized;
     bool             trng_conditioning_key_set;
@@ -256,7 +269,12 @@ int nrfx_cracen_entropy_get(uint8_t * p_buf, size_t size)
 #endif
     }
 
-    nrf_cracen_module_disable(NRF_CRACEN, NRF_CRACEN_MODULE_RNG_MASK);
+#if NRF_CRACEN_HAS_CRYPTOMASTER
+    if (!m_cb.reseed_pending)
+#endif
+    {
+        nrf_cracen_module_disable(NRF_CRACEN, NRF_CRACEN_MODULE_RNG_MASK);
+    }
 
     return 0;
 }
@@ -292,97 +310,496 @@ static cracen_ret_t cm_done_check(void)
     return OK;
 }
 
-/*
- * Function for encrypting with AES-ECB the input data using the CRACEN CryptoMaster module.
- *
- * @note The key, input and output data are in big endian/cryptographic order. That is, input[0]
- *       corresponds to the highest byte of the 128bit input.
- *
- * @note The only failure one can normally expect are bus failures due to incorrect pointers.
- *
- * @note This function is meant to be used by the nrfx_random_ctr_drbg driver.
- *       If using it outside of this driver it must be used with care specially if any other
- *       component is using CRACEN.
- *
- * @note The key size needs to be supported by the CRACEN CryptoMaster AES engine.
- *
- * @param[in] p_key    Pointer to the key.
- * @param[in] key_size Size of the key in bytes (valid sizes 16, 24 or 32 => 128, 192 or 256 bits).
- * @param[in] p_input  Pointer to the input data (16 bytes/128 bits).
- * @param[in] p_output Pointer to the output data (16 bytes/128 bits).
- *
- * @return OK on success, ERROR on failure.
- */
-static cracen_ret_t cm_aes_ecb(uint8_t * p_key, size_t key_size, uint8_t * p_input,
-                               uint8_t * p_output)
-{
-    cracen_ret_t ret;
+#define AES_CCM_HEADER_LEN_MAX 0xFF00U /* Largest AAD length encoded on two bytes */
 
-    static const uint32_t aes_config_value = NRF_CRACEN_CM_AES_CONFIG(
-            NRF_CRACEN_CM_AES_CONFIG_MODE_ECB,
-            NRF_CRACEN_CM_AES_CONFIG_KEY_SW_PROGRAMMED,
-            false, false, false);
+static void pool_refill_start(void);
+static void pool_job_wait(void);
 
-    struct nrf_cracen_cm_dma_desc in_descs[3];
+/* SHA-256 initial hash value, in big endian. */
+static const uint8_t m_sha256_iv[NRFX_CRACEN_SHA256_DIGEST_SIZE] =
+{
+    0x6a, 0x09, 0xe6, 0x67, 0xbb, 0x67, 0xae, 0x85, 0x3c, 0x6e, 0xf3, 0x72, 0xa5, 0x4f, 0xf5, 0x3a,
+    0x51, 0x0e, 0x52, 0x7f, 0x9b, 0x05, 0x68, 0x8c, 0x1f, 0x83, 0xd9, 0xab, 0x5b, 0xe0, 0xcd, 0x19,
+};
+
+static const uint8_t m_zero_block[AES_ECB_BLK_SZ];
 
+/*
+ * Append a descriptor to the chain.
+ * Returns the pointer to the next free descriptor.
+ */
+static nrf_cracen_cm_dma_desc_t * desc_add(nrf_cracen_cm_dma_desc_t * p_desc,
+                                           void const *               p_addr,
+                                           size_t                     length,
+                                           uint32_t                   dmatag)
+{
 #if defined(__GNUC__)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wcast-qual"
 #endif /* __GNUC__ */
-    in_descs[0].p_addr = (uint8_t *)&aes_config_value;
+    p_desc->p_addr = (uint8_t *)p_addr;
 #if defined(__GNUC__)
 #pragma GCC diagnostic pop
 #endif /* __GNUC__ */
-    in_descs[0].length = sizeof(aes_config_value) | NRF_CRACEN_CM_DMA_DESC_LENGTH_REALIGN;
-    in_descs[0].dmatag = NRF_CRACEN_CM_DMA_TAG_AES_CONFIG(NRF_CRACEN_CM_AES_REG_OFFSET_CONFIG);
-    in_descs[0].p_next = &in_descs[1];
+    p_desc->length = (uint32_t)length;
+    p_desc->dmatag = dmatag;
+    p_desc->p_next = p_desc + 1;
+
+    return p_desc + 1;
+}
+
+/*
+ * Append a list of segments to the chain, skipping empty ones, and realign the last one.
+ */
+static nrf_cracen_cm_dma_desc_t * desc_sg_add(nrf_cracen_cm_dma_desc_t *  p_desc,
+                                              nrfx_cracen_cm_sg_t const * p_sg,
+                                              uint8_t                     count,
+                                              uint32_t                    dmatag)
+{
+    nrf_cracen_cm_dma_desc_t * p_first = p_desc;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (p_sg[i].length)
+        {
+            p_desc = desc_add(p_desc, p_sg[i].p_data, p_sg[i].length, dmatag);
+        }
+    }
+    if (p_desc != p_first)
+    {
+        p_desc[-1].length |= NRF_CRACEN_CM_DMA_DESC_LENGTH_REALIGN;
+    }
+
+    return p_desc;
+}
+
+/*
+ * Terminate the chain ending before /p p_end. For the fetch chain, /p last_tag marks
+ * the last block of data for the crypto engine.
+ */
+static void desc_chain_end(nrf_cracen_cm_dma_desc_t * p_end, uint32_t last_tag)
+{
+    p_end[-1].p_next  = NRF_CRACEN_CM_DMA_DESC_STOP;
+    p_end[-1].length |= NRF_CRACEN_CM_DMA_DESC_LENGTH_REALIGN;
+    p_end[-1].dmatag |= last_tag;
+}
+
+static size_t sg_length(nrfx_cracen_cm_sg_t const * p_sg, uint8_t count)
+{
+    size_t length = 0;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        length += p_sg[i].length;
+    }
+    return length;
+}
+
+static void be_put(uint8_t * p_dst, uint64_t value, size_t size)
+{
+    while (size--)
+    {
+        p_dst[size] = (uint8_t)value;
+        value >>= 8;
+    }
+}
+
+/*
+ * Build the descriptor chains of a hash job.
+ * The message must be a multiple of the block size unless /p final is true, in which case
+ * padding for the message of /p total_length bytes is appended.
+ */
+static void hash_job_build(nrfx_cracen_cm_job_t *      p_job,
+                           uint8_t const *             p_state,
+                           nrfx_cracen_cm_sg_t const * p_sg,
+                           uint8_t                     count,
+                           bool                        final,
+                           uint64_t                    total_length,
+                           uint8_t *                   p_digest)
+{
+    nrf_cracen_cm_dma_desc_t * p_desc = p_job->fetch;
+    nrf_cracen_cm_dma_desc_t * p_msg;
+    uint32_t tag = NRF_CRACEN_CM_DMA_TAG_ENGINE_HASH;
+
+    p_job->config = NRF_CRACEN_CM_HASH_CONFIG_MODE_SHA256;
+    p_desc = desc_add(p_desc, &p_job->config,
+                      sizeof(p_job->config) | NRF_CRACEN_CM_DMA_DESC_LENGTH_REALIGN,
+                      NRF_CRACEN_CM_DMA_TAG_HASH_CONFIG);
+    p_desc = desc_add(p_desc, p_state,
+                      NRFX_CRACEN_SHA256_DIGEST_SIZE | NRF_CRACEN_CM_DMA_DESC_LENGTH_REALIGN,
+                      tag | NRF_CRACEN_CM_DMA_TAG_DATATYPE_HASH_INIT_DATA);
+    p_msg  = p_desc;
+    p_desc = desc_sg_add(p_desc, p_sg, count, tag | NRF_CRACEN_CM_DMA_TAG_DATATYPE_HASH_MESSAGE);
+
+    if (final)
+    {
+        /* The padding continues the message, so the DMA must not realign the message data
+         * before it. Otherwise dummy bytes are inserted if the message length is not
+         * a multiple of 4. */
+        if (p_desc != p_msg)
+        {
+            p_desc[-1].length &= ~NRF_CRACEN_CM_DMA_DESC_LENGTH_REALIGN;
+        }
 
-    in_descs[1].p_addr = p_key;
-    in_descs[1].length = key_size | NRF_CRACEN_CM_DMA_DESC_LENGTH_REALIGN;
-    in_descs[1].dmatag = NRF_CRACEN_CM_DMA_TAG_AES_CONFIG(NRF_CRACEN_CM_AES_REG_OFFSET_KEY);
-    in_descs[1].p_next = &in_descs[2];
+        size_t rem     = (size_t)(total_length % NRFX_CRACEN_SHA256_BLOCK_SIZE);
+        size_t pad_len = ((rem < 56) ? 56 : 120) - rem + 8;
 
-    in_descs[2].p_addr = p_input;
-    in_descs[2].length = AES_ECB_BLK_SZ | NRF_CRACEN_CM_DMA_DESC_LENGTH_REALIGN;
-    in_descs[2].dmatag = NRF_CRACEN_CM_DMA_TAG_LAST | NRF_CRACEN_CM_DMA_TAG_ENGINE_AES
-                          | NRF_CRACEN_CM_DMA_TAG_DATATYPE_AES_PAYLOAD;
-    in_descs[2].p_next = NRF_CRACEN_CM_DMA_DESC_STOP;
+        memset(p_job->extra, 0, pad_len);
+        p_job->extra[0] = 0x80;
+        be_put(&p_job->extra[pad_len - 8], total_length * 8, 8);
+        p_desc = desc_add(p_desc, p_job->extra, pad_len,
+                          tag | NRF_CRACEN_CM_DMA_TAG_DATATYPE_HASH_MESSAGE);
+    }
+    desc_chain_end(p_desc, NRF_CRACEN_CM_DMA_TAG_LAST);
 
-    struct nrf_cracen_cm_dma_desc out_desc;
+    p_desc = desc_add(p_job->push, p_digest, NRFX_CRACEN_SHA256_DIGEST_SIZE, 0);
+    desc_chain_end(p_desc, NRF_CRACEN_CM_DMA_TAG_LAST);
+}
 
-    out_desc.p_addr = p_output;
-    out_desc.length = AES_ECB_BLK_SZ | NRF_CRACEN_CM_DMA_DESC_LENGTH_REALIGN;
-    out_desc.p_next = NRF_CRACEN_CM_DMA_DESC_STOP;
-    out_desc.dmatag = NRF_CRACEN_CM_DMA_TAG_LAST;
+/*
+ * Check the AES job parameters and build its descriptor chains.
+ * Returns 0 on success, -EINVAL if the job is invalid.
+ */
+static int aes_job_build(nrfx_cracen_cm_job_t * p_job)
+{
+    size_t in_len  = sg_length(p_job->p_in, p_job->in_count);
+    size_t aad_len = sg_length(p_job->p_aad, p_job->aad_count);
+    bool   aead    = (p_job->op == NRFX_CRACEN_CM_OP_AES_CCM) ||
+                     (p_job->op == NRFX_CRACEN_CM_OP_AES_GCM);
+    uint32_t mode;
+
+    if (((p_job->key_size != 16) && (p_job->key_size != 24) && (p_job->key_size != 32)) ||
+        (p_job->out_count > NRFX_CRACEN_CM_SG_MAX) ||
+        (sg_length(p_job->p_out, p_job->out_count) != in_len) ||
+        (!aead && ((p_job->aad_count != 0) || (in_len == 0))) ||
+        (aead && ((p_job->tag_size < 4) || (p_job->tag_size > 16) || (p_job->p_tag == NULL))))
+    {
+        return -EINVAL;
+    }
 
+    switch (p_job->op)
+    {
+        case NRFX_CRACEN_CM_OP_AES_ECB:
+            if ((in_len % AES_ECB_BLK_SZ) != 0)
+            {
+                return -EINVAL;
+            }
+            mode = NRF_CRACEN_CM_AES_CONFIG_MODE_ECB;
+            break;
+
+        case NRFX_CRACEN_CM_OP_AES_CTR:
+            if (p_job->iv_size != AES_ECB_BLK_SZ)
+            {
+                return -EINVAL;
+            }
+            memcpy(p_job->iv_block, p_job->p_iv, AES_ECB_BLK_SZ);
+            mode = NRF_CRACEN_CM_AES_CONFIG_MODE_CTR;
+            break;
+
+        case NRFX_CRACEN_CM_OP_AES_GCM:
+            if (p_job->iv_size != 12)
+            {
+                return -EINVAL;
+            }
+            /* J0 = IV || 0^31 || 1 */
+            memcpy(p_job->iv_block, p_job->p_iv, 12);
+            be_put(&p_job->iv_block[12], 1, 4);
+            mode = NRF_CRACEN_CM_AES_CONFIG_MODE_GMC_GMAC;
+            break;
+
+        case NRFX_CRACEN_CM_OP_AES_CCM:
+        {
+            size_t q = 15 - p_job->iv_size;
+
+            if ((p_job->iv_size < 7) || (p_job->iv_size > 13) || (p_job->tag_size & 1) ||
+                (aad_len >= AES_CCM_HEADER_LEN_MAX) ||
+                ((q < sizeof(size_t)) && ((uint64_t)in_len >> (8 * q))))
+            {
+                return -EINVAL;
+            }
+            /* A0 = flags || nonce || 0, B0 = flags || nonce || Q as per NIST.SP.800-38C */
+            memset(p_job->iv_block, 0, sizeof(p_job->iv_block));
+            p_job->iv_block[0] = (uint8_t)(q - 1);
+            memcpy(&p_job->iv_block[1], p_job->p_iv, p_job->iv_size);
+
+            memcpy(p_job->extra, p_job->iv_block, AES_ECB_BLK_SZ);
+            p_job->extra[0] |= (uint8_t)(((aad_len ? 1 : 0) << 6) |
+                                         (((p_job->tag_size - 2) / 2) << 3));
+            be_put(&p_job->extra[16 - q], in_len, q);
+            be_put(&p_job->extra[AES_ECB_BLK_SZ], aad_len, 2);
+            mode = NRF_CRACEN_CM_AES_CONFIG_MODE_CCM;
+            break;
+        }
+
+        default:
+            return -EINVAL;
+    }
+
+    p_job->config = NRF_CRACEN_CM_AES_CONFIG(mode,
+                                             NRF_CRACEN_CM_AES_CONFIG_KEY_SW_PROGRAMMED,
+                                             false, false, p_job->decrypt);
+
+    uint32_t tag_header  = NRF_CRACEN_CM_DMA_TAG_ENGINE_AES |
+                           NRF_CRACEN_CM_DMA_TAG_DATATYPE_AES_HEADER;
+    uint32_t tag_payload = NRF_CRACEN_CM_DMA_TAG_ENGINE_AES |
+                           NRF_CRACEN_CM_DMA_TAG_DATATYPE_AES_PAYLOAD;
+    nrf_cracen_cm_dma_desc_t * p_desc = p_job->fetch;
+
+    p_desc = desc_add(p_desc, &p_job->config,
+                      sizeof(p_job->config) | NRF_CRACEN_CM_DMA_DESC_LENGTH_REALIGN,
+                      NRF_CRACEN_CM_DMA_TAG_AES_CONFIG(NRF_CRACEN_CM_AES_REG_OFFSET_CONFIG));
+    p_desc = desc_add(p_desc, p_job->p_key,
+                      p_job->key_size | NRF_CRACEN_CM_DMA_DESC_LENGTH_REALIGN,
+                      NRF_CRACEN_CM_DMA_TAG_AES_CONFIG(NRF_CRACEN_CM_AES_REG_OFFSET_KEY));
+    if (p_job->op != NRFX_CRACEN_CM_OP_AES_ECB)
+    {
+        p_desc = desc_add(p_desc, p_job->iv_block,
+                          sizeof(p_job->iv_block) | NRF_CRACEN_CM_DMA_DESC_LENGTH_REALIGN,
+                          NRF_CRACEN_CM_DMA_TAG_AES_CONFIG(NRF_CRACEN_CM_AES_REG_OFFSET_IV));
+    }
+
+    if (p_job->op == NRFX_CRACEN_CM_OP_AES_CCM)
+    {
+        /* The header is B0, the encoded AAD length and the AAD, zero-padded to a full block. */
+        size_t hdr_len = AES_ECB_BLK_SZ + (aad_len ? (2 + aad_len) : 0);
+
+        p_desc = desc_add(p_desc, p_job->extra,
+                          AES_ECB_BLK_SZ + (aad_len ? 2 : 0), tag_header);
+        p_desc = desc_sg_add(p_desc, p_job->p_aad, p_job->aad_count, tag_header);
+        p_desc[-1].length &= ~NRF_CRACEN_CM_DMA_DESC_LENGTH_REALIGN;
+        if (hdr_len % AES_ECB_BLK_SZ)
+        {
+            p_desc = desc_add(p_desc, m_zero_block,
+                              AES_ECB_BLK_SZ - (hdr_len % AES_ECB_BLK_SZ), tag_header);
+        }
+        p_desc[-1].length |= NRF_CRACEN_CM_DMA_DESC_LENGTH_REALIGN;
+    }
+    else if (p_job->op == NRFX_CRACEN_CM_OP_AES_GCM)
+    {
+        p_desc = desc_sg_add(p_desc, p_job->p_aad, p_job->aad_count, tag_header);
+    }
+
+    p_desc = desc_sg_add(p_desc, p_job->p_in, p_job->in_count, tag_payload);
+
+    if (p_job->op == NRFX_CRACEN_CM_OP_AES_GCM)
+    {
+        /* len(A) || len(C) in bits */
+        be_put(&p_job->extra[0], (uint64_t)aad_len * 8, 8);
+        be_put(&p_job->extra[8], (uint64_t)in_len * 8, 8);
+        p_desc = desc_add(p_desc, p_job->extra, AES_ECB_BLK_SZ, tag_header);
+    }
+    desc_chain_end(p_desc, NRF_CRACEN_CM_DMA_TAG_LAST);
+
+    p_desc = p_job->push;
+    for (uint8_t i = 0; i < p_job->out_count; i++)
+    {
+        if (p_job->p_out[i].length)
+        {
+            p_desc = desc_add(p_desc, p_job->p_out[i].p_data, p_job->p_out[i].length, 0);
+        }
+    }
+    if (aead)
+    {
+        p_desc = desc_add(p_desc, p_job->decrypt ? p_job->tag : p_job->p_tag,
+                          p_job->tag_size, 0);
+    }
+    if (p_desc == p_job->push)
+    {
+        /* Nothing to push, discard the engine output. */
+        p_desc = desc_add(p_desc, p_job->tag, AES_ECB_BLK_SZ, 0);
+    }
+    desc_chain_end(p_desc, 0);
+
+    return 0;
+}
+
+/*
+ * Start the CryptoMaster on the descriptor chains of the job.
+ */
+static void cm_job_hw_start(nrfx_cracen_cm_job_t * p_job)
+{
     nrf_cracen_module_enable(NRF_CRACEN, NRF_CRACEN_MODULE_CRYPTOMASTER_MASK);
 
-    nrf_cracen_cm_fetch_addr_set(NRF_CRACENCORE, (void *)in_descs);
-    nrf_cracen_cm_push_addr_set(NRF_CRACENCORE, (void *)&out_desc);
+    nrf_cracen_cm_fetch_addr_set(NRF_CRACENCORE, (void *)p_job->fetch);
+    nrf_cracen_cm_push_addr_set(NRF_CRACENCORE, (void *)p_job->push);
 
     nrf_cracen_cm_config_indirect_set(NRF_CRACENCORE,(nrf_cracen_cm_config_indirect_mask_t)
                                                      (NRF_CRACEN_CM_CONFIG_INDIRECT_FETCH_MASK |
                                                       NRF_CRACEN_CM_CONFIG_INDIRECT_PUSH_MASK));
 
-    /* Make sure the contents of in_descs and out_desc are updated before starting CryptoMaster. */
+    if (p_job->handler)
+    {
+        nrf_cracen_cm_int_clear(NRF_CRACENCORE, NRF_CRACEN_CM_INT_PUSH_STOPPED_MASK |
+                                                NRF_CRACEN_CM_INT_FETCH_ERROR_MASK  |
+                                                NRF_CRACEN_CM_INT_PUSH_ERROR_MASK);
+        nrf_cracen_event_clear(NRF_CRACEN, NRF_CRACEN_EVENT_CRYPTOMASTER);
+        nrf_cracen_cm_int_enable(NRF_CRACENCORE, NRF_CRACEN_CM_INT_PUSH_STOPPED_MASK |
+                                                 NRF_CRACEN_CM_INT_FETCH_ERROR_MASK  |
+                                                 NRF_CRACEN_CM_INT_PUSH_ERROR_MASK);
+        nrf_cracen_int_enable(NRF_CRACEN, NRF_CRACEN_INT_CRYPTOMASTER_MASK);
+    }
+
+    /* Make sure the contents of the descriptors are updated before starting CryptoMaster. */
     __DMB();
 
     nrf_cracen_cm_start(NRF_CRACENCORE);
+}
+
+/*
+ * Stop the CryptoMaster and compute the result of the job.
+ */
+static int cm_job_finalize(nrfx_cracen_cm_job_t * p_job, cracen_ret_t hw_ret)
+{
+    nrf_cracen_int_disable(NRF_CRACEN, NRF_CRACEN_INT_CRYPTOMASTER_MASK);
+    nrf_cracen_cm_int_disable(NRF_CRACENCORE, NRF_CRACEN_CM_INT_PUSH_STOPPED_MASK |
+                                              NRF_CRACEN_CM_INT_FETCH_ERROR_MASK  |
+                                              NRF_CRACEN_CM_INT_PUSH_ERROR_MASK);
+    nrf_cracen_cm_softreset(NRF_CRACENCORE);
+    nrf_cracen_module_disable(NRF_CRACEN, NRF_CRACEN_MODULE_CRYPTOMASTER_MASK);
+
+    if (hw_ret != OK)
+    {
+        return -ECANCELED;
+    }
+
+    if (p_job->decrypt &&
+        ((p_job->op == NRFX_CRACEN_CM_OP_AES_CCM) || (p_job->op == NRFX_CRACEN_CM_OP_AES_GCM)))
+    {
+        /* Constant time comparison of the tags. */
+        uint8_t diff = 0;
+
+        for (size_t i = 0; i < p_job->tag_size; i++)
+        {
+            diff |= (uint8_t)(p_job->tag[i] ^ p_job->p_tag[i]);
+        }
+        if (diff)
+        {
+            return -EBADMSG;
+        }
+    }
+
+    return 0;
+}
 
+/*
+ * Run the job whose descriptor chains are already built, blocking or not depending on
+ * whether the handler is set. The CryptoMaster must already be reserved for the job.
+ */
+static int cm_job_run(nrfx_cracen_cm_job_t * p_job)
+{
+    if (p_job->handler)
+    {
+        NRFX_IRQ_PRIORITY_SET(CRACEN_IRQn, NRFX_CRACEN_DEFAULT_CONFIG_IRQ_PRIORITY);
+        NRFX_IRQ_ENABLE(CRACEN_IRQn);
+        cm_job_hw_start(p_job);
+        return 0;
+    }
+
+    cracen_ret_t ret;
+
+    cm_job_hw_start(p_job);
     do {
-        /* The HW is so fast that it is better to "busy wait" here than program an
-         * interrupt. This will normally already succeed in the first try
-         */
 #if NRFX_CHECK(NRFX_CRACEN_BSIM_SUPPORT)
         nrfx_coredep_delay_us(1);
 #endif
         ret = cm_done_check();
     } while (ret == HW_PROCESSING);
 
-    nrf_cracen_cm_softreset(NRF_CRACENCORE);
-    nrf_cracen_module_disable(NRF_CRACEN, NRF_CRACEN_MODULE_CRYPTOMASTER_MASK);
+    p_job->result = cm_job_finalize(p_job, ret);
+    m_cb.p_cm_job = NULL;
+
+    return p_job->result;
+}
+
+/*
+ * Reserve the CryptoMaster for the job.
+ * A background refill of the pool is completed first, so that it never makes other jobs fail.
+ */
+static bool cm_job_reserve(nrfx_cracen_cm_job_t * p_job)
+{
+    bool reserved = false;
+
+    if (p_job != &m_cb.pool_job)
+    {
+        pool_job_wait();
+    }
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (m_cb.p_cm_job == NULL)
+    {
+        m_cb.p_cm_job = p_job;
+        reserved = true;
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return reserved;
+}
+
+/*
+ * Reserve the CryptoMaster for the job, waiting for a job in progress to complete.
+ * Must not be called from an interrupt that blocks the CRACEN interrupt.
+ */
+static void cm_job_reserve_wait(nrfx_cracen_cm_job_t * p_job)
+{
+    while (!cm_job_reserve(p_job))
+    {
+#if NRFX_CHECK(NRFX_CRACEN_BSIM_SUPPORT)
+        nrfx_coredep_delay_us(1);
+#endif
+    }
+}
 
-    return ret;
+/*
+ * Build and run a blocking AES job on the CryptoMaster reserved for it.
+ * The reservation is released also when the job is invalid.
+ */
+static int cm_aes_job_exec(nrfx_cracen_cm_job_t * p_job)
+{
+    int err_code = aes_job_build(p_job);
+
+    if (err_code != 0)
+    {
+        m_cb.p_cm_job = NULL;
+        return err_code;
+    }
+
+    return cm_job_run(p_job);
+}
+
+/*
+ * Process /p count full blocks of the streaming hash, optionally followed by the final padding.
+ */
+static int sha256_blocks_process(nrfx_cracen_sha256_ctx_t * p_ctx,
+                                 uint8_t const *            p_data,
+                                 size_t                     size,
+                                 bool                       final,
+                                 uint8_t *                  p_digest)
+{
+    nrfx_cracen_cm_job_t job = { .op = NRFX_CRACEN_CM_OP_SHA256 };
+    nrfx_cracen_cm_sg_t  sg[2] =
+    {
+        { .p_data = p_ctx->block,      .length = p_ctx->block_len },
+        { .p_data = (uint8_t *)p_data, .length = size },
+    };
+
+    if (!cm_job_reserve(&job))
+    {
+        return -EBUSY;
+    }
+
+    hash_job_build(&job, p_ctx->state, sg, NRFX_ARRAY_SIZE(sg),
+                   final, p_ctx->length + p_ctx->block_len + size, p_digest);
+
+    int err_code = cm_job_run(&job);
+    if (err_code == 0)
+    {
+        p_ctx->length   += p_ctx->block_len + size;
+        p_ctx->block_len = 0;
+    }
+
+    pool_refill_start();
+
+    return err_code;
 }
 
 /*
@@ -416,6 +833,103 @@ static inline void xor_array(uint32_t * a, const uint32_t * b, size_t size)
     }
 }
 
+/*
+ * Poll the TRNG for the entropy of a pending asynchronous reseed, without blocking.
+ */
+static void ctr_drbg_entropy_poll(void)
+{
+    if (!m_cb.reseed_pending)
+    {
+        return;
+    }
+
+    cracen_ret_t ret = trng_get(m_cb.entropy, sizeof(m_cb.entropy));
+
+    if (ret == TRNG_RESET_NEEDED)
+    {
+        trng_init();
+    }
+    else if (ret == OK)
+    {
+        nrf_cracen_module_disable(NRF_CRACEN, NRF_CRACEN_MODULE_RNG_MASK);
+        m_cb.entropy_ready  = true;
+        m_cb.reseed_pending = false;
+    }
+}
+
+/*
+ * Prepare a CTR_DRBG generate request as a single AES-ECB job.
+ *
+ * The counter blocks V+1, V+2, ... are written back to back over the /p count segments in /p p_sg,
+ * which are then encrypted in place. The last segment must be the CTR_DRBG_ENTROPY_SIZE bytes
+ * receiving the output of the CTR_DRBG_Update process.
+ */
+static void ctr_drbg_job_prepare(nrfx_cracen_cm_job_t * p_job,
+                                 nrfx_cracen_cm_sg_t *  p_sg,
+                                 uint8_t                count)
+{
+    uint8_t ctr[AES_ECB_BLK_SZ];
+    size_t  pos = 0;
+
+    ctr_drbg_entropy_poll();
+
+    memcpy(ctr, m_cb.value, sizeof(ctr));
+    for (uint8_t i = 0; i < count; i++)
+    {
+        uint8_t * p_data = p_sg[i].p_data;
+        size_t    length = p_sg[i].length;
+
+        while (length)
+        {
+            if (pos == 0)
+            {
+                be_incr(ctr, sizeof(ctr));
+            }
+
+            size_t chunk = NRFX_MIN(AES_ECB_BLK_SZ - pos, length);
+
+            memcpy(p_data, &ctr[pos], chunk);
+            p_data += chunk;
+            length -= chunk;
+            pos     = (pos + chunk) % AES_ECB_BLK_SZ;
+        }
+    }
+
+    p_job->op        = NRFX_CRACEN_CM_OP_AES_ECB;
+    p_job->decrypt   = false;
+    p_job->p_key     = m_cb.key;
+    p_job->key_size  = sizeof(m_cb.key);
+    p_job->p_in      = p_sg;
+    p_job->in_count  = count;
+    p_job->p_out     = p_sg;
+    p_job->out_count = count;
+    p_job->aad_count = 0;
+    p_job->handler   = NULL;
+}
+
+/*
+ * Finish the CTR_DRBG_Update process with the /p p_update output of a generate job, mixing in
+ * the entropy of a pending reseed if available.
+ */
+static void ctr_drbg_job_complete(uint8_t * p_update)
+{
+    if (m_cb.entropy_ready)
+    {
+        xor_array((uint32_t *)p_update, (uint32_t *)m_cb.entropy, CTR_DRBG_ENTROPY_SIZE);
+        memset(m_cb.entropy, 0, sizeof(m_cb.entropy));
+        m_cb.entropy_ready  = false;
+        m_cb.reseed_counter = 1;
+    }
+    else
+    {
+        m_cb.reseed_counter += 1;
+    }
+
+    memcpy(m_cb.key, p_update, sizeof(m_cb.key));
+    memcpy(m_cb.value, p_update + sizeof(m_cb.key), sizeof(m_cb.value));
+    memset(p_update, 0, CTR_DRBG_ENTROPY_SIZE);
+}
+
 /*
  * Implementation of the CTR_DRBG_Update process as described in NIST.SP.800-90Ar1 with ctr_len
  * equal to blocklen.
@@ -424,21 +938,17 @@ static inline void xor_array(uint32_t * a, const uint32_t * b, size_t size)
  */
 static cracen_ret_t ctr_drbg_update(uint8_t * data)
 {
-    int r = 0;
-    uint8_t temp[CTR_DRBG_ENTROPY_SIZE];
-    size_t temp_length = 0;
+    nrfx_cracen_cm_job_t job;
+    uint8_t temp[CTR_DRBG_ENTROPY_SIZE] __ALIGN(4);
+    nrfx_cracen_cm_sg_t sg = { .p_data = temp, .length = sizeof(temp) };
 
-    while (temp_length < sizeof(temp))
-    {
-        be_incr(m_cb.value, AES_ECB_BLK_SZ);
-
-        r = cm_aes_ecb(m_cb.key, sizeof(m_cb.key), m_cb.value, temp + temp_length);
+    cm_job_reserve_wait(&job);
 
-        if (r != OK)
-        {
-            return ERROR;
-        }
-        temp_length += AES_ECB_BLK_SZ;
+    ctr_drbg_job_prepare(&job, &sg, 1);
+    if (cm_aes_job_exec(&job) != 0)
+    {
+        memset(temp, 0, sizeof(temp));
+        return ERROR;
     }
 
     if (data)
@@ -479,6 +989,113 @@ static cracen_ret_t ctr_drbg_reseed(void)
 
     return OK;
 }
+
+/*
+ * Commit the result of a finished refill job to the pool and to the CTR_DRBG state.
+ * Called before the CryptoMaster is released, so that no other request uses the state
+ * already consumed by the refill.
+ */
+static void pool_job_handler(nrfx_cracen_cm_job_t * p_job, void * p_context)
+{
+    (void)p_context;
+
+    if (p_job->result != 0)
+    {
+        memset(m_cb.pool_update, 0, sizeof(m_cb.pool_update));
+        return;
+    }
+
+    ctr_drbg_job_complete(m_cb.pool_update);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    m_cb.pool_level += m_cb.pool_refill;
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+/*
+ * Wait for a running refill job and complete it in place, without starting the next one.
+ * The job is finalized in a critical section, so that it is not completed again
+ * by the interrupt handler.
+ */
+static void pool_job_wait(void)
+{
+    bool waiting = true;
+
+    while (waiting)
+    {
+        NRFX_CRITICAL_SECTION_ENTER();
+        if (m_cb.p_cm_job != &m_cb.pool_job)
+        {
+            waiting = false;
+        }
+        else
+        {
+            cracen_ret_t ret = cm_done_check();
+
+            if (ret != HW_PROCESSING)
+            {
+                nrf_cracen_event_clear(NRF_CRACEN, NRF_CRACEN_EVENT_CRYPTOMASTER);
+                m_cb.pool_job.result = cm_job_finalize(&m_cb.pool_job, ret);
+                pool_job_handler(&m_cb.pool_job, NULL);
+                m_cb.p_cm_job = NULL;
+                waiting = false;
+            }
+        }
+        NRFX_CRITICAL_SECTION_EXIT();
+#if NRFX_CHECK(NRFX_CRACEN_BSIM_SUPPORT)
+        if (waiting)
+        {
+            nrfx_coredep_delay_us(1);
+        }
+#endif
+    }
+}
+
+/*
+ * Start refilling the free space of the pool in the background if the pool level is below
+ * its threshold and the CryptoMaster is free.
+ */
+static void pool_refill_start(void)
+{
+    if ((m_cb.p_pool == NULL) || (m_cb.pool_level >= m_cb.pool_threshold) ||
+        !cm_job_reserve(&m_cb.pool_job))
+    {
+        return;
+    }
+
+    size_t wr;
+    size_t refill;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    wr     = (m_cb.pool_rd + m_cb.pool_level) % m_cb.pool_size;
+    refill = (m_cb.pool_size - m_cb.pool_level) & ~(size_t)(AES_ECB_BLK_SZ - 1);
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if (refill == 0)
+    {
+        m_cb.p_cm_job = NULL;
+        return;
+    }
+
+    /* The free space may wrap around the end of the pool. */
+    m_cb.pool_sg[0].p_data = &m_cb.p_pool[wr];
+    m_cb.pool_sg[0].length = NRFX_MIN(refill, m_cb.pool_size - wr);
+    m_cb.pool_sg[1].p_data = m_cb.p_pool;
+    m_cb.pool_sg[1].length = refill - m_cb.pool_sg[0].length;
+    m_cb.pool_sg[2].p_data = m_cb.pool_update;
+    m_cb.pool_sg[2].length = sizeof(m_cb.pool_update);
+    m_cb.pool_refill       = refill;
+
+    ctr_drbg_job_prepare(&m_cb.pool_job, m_cb.pool_sg, NRFX_ARRAY_SIZE(m_cb.pool_sg));
+    m_cb.pool_job.handler = pool_job_handler;
+
+    if (aes_job_build(&m_cb.pool_job) != 0)
+    {
+        m_cb.p_cm_job = NULL;
+        return;
+    }
+    (void)cm_job_run(&m_cb.pool_job);
+}
 #endif
 
 int nrfx_cracen_init(void)
@@ -508,6 +1125,16 @@ void nrfx_cracen_uninit(void)
 {
     NRFX_ASSERT(m_cb.initialized != NRFX_DRV_STATE_UNINITIALIZED);
 
+#if NRF_CRACEN_HAS_CRYPTOMASTER
+    NRFX_IRQ_DISABLE(CRACEN_IRQn);
+    nrfx_cracen_ctr_drbg_pool_uninit();
+    if (m_cb.reseed_pending)
+    {
+        nrf_cracen_module_disable(NRF_CRACEN, NRF_CRACEN_MODULE_RNG_MASK);
+        m_cb.reseed_pending = false;
+    }
+    m_cb.p_cm_job = NULL;
+#endif
     m_cb.initialized = NRFX_DRV_STATE_UNINITIALIZED;
 }
 
@@ -528,6 +1155,10 @@ int nrfx_cracen_ctr_drbg_random_get(uint8_t * p_buf, size_t size)
         return -EINVAL;
     }
 
+    /* A background refill of the pool updates the CTR_DRBG state when it finishes,
+     * so it is completed before the state is used here. */
+    pool_job_wait();
+
     if (m_cb.reseed_counter >= CTR_DRBG_RESEED_INTERVAL)
     {
         r = ctr_drbg_reseed();
@@ -537,38 +1168,319 @@ int nrfx_cracen_ctr_drbg_random_get(uint8_t * p_buf, size_t size)
         }
     }
 
-    while (size > 0)
+    nrfx_cracen_cm_job_t job;
+    uint8_t temp[AES_ECB_BLK_SZ + CTR_DRBG_ENTROPY_SIZE] __ALIGN(4);
+    size_t  whole = size & ~(size_t)(AES_ECB_BLK_SZ - 1);
+    size_t  tail  = size - whole;
+
+    /* Whole blocks can be generated in place only if the buffer is accessible by the
+     * CryptoMaster DMA. Otherwise, they are staged through the local buffer, one job per chunk.
+     * Counter is advanced by each chunk, so the output is the same as with a single job. */
+    if ((whole > 0) && !nrf_dma_accessible_check(NRF_CRACENCORE, p_buf))
     {
-        uint8_t temp[AES_ECB_BLK_SZ];
-        size_t cur_len = (size < AES_ECB_BLK_SZ) ? size : AES_ECB_BLK_SZ;
+        while (whole > 0)
+        {
+            nrfx_cracen_cm_sg_t stage =
+            {
+                .p_data = temp,
+                .length = NRFX_MIN(whole, sizeof(temp) & ~(size_t)(AES_ECB_BLK_SZ - 1)),
+            };
+
+            cm_job_reserve_wait(&job);
+            ctr_drbg_job_prepare(&job, &stage, 1);
+            if (cm_aes_job_exec(&job) != 0)
+            {
+                memset(temp, 0, sizeof(temp));
+                return -ECANCELED;
+            }
+
+            memcpy(p_buf, temp, stage.length);
+            for (size_t i = 0; i < stage.length; i += AES_ECB_BLK_SZ)
+            {
+                be_incr(m_cb.value, sizeof(m_cb.value));
+            }
+            p_buf += stage.length;
+            whole -= stage.length;
+        }
+        memset(temp, 0, sizeof(temp));
+    }
 
-        be_incr(m_cb.value, AES_ECB_BLK_SZ);
+    /* Remaining whole blocks are generated in place, followed by the partial block if any
+     * and the CTR_DRBG_Update output, in a single job. */
+    nrfx_cracen_cm_sg_t sg[2] =
+    {
+        { .p_data = p_buf, .length = whole },
+        { .p_data = tail ? temp : &temp[AES_ECB_BLK_SZ],
+          .length = (tail ? AES_ECB_BLK_SZ : 0) + CTR_DRBG_ENTROPY_SIZE },
+    };
 
-        r = cm_aes_ecb(m_cb.key, sizeof(m_cb.key), m_cb.value, temp);
-        if (r != OK)
+    cm_job_reserve_wait(&job);
+
+    ctr_drbg_job_prepare(&job, sg, NRFX_ARRAY_SIZE(sg));
+    if (cm_aes_job_exec(&job) != 0)
+    {
+        memset(temp, 0, sizeof(temp));
+        return -ECANCELED;
+    }
+
+    if (tail)
+    {
+        memcpy(&p_buf[whole], temp, tail);
+    }
+    ctr_drbg_job_complete(&temp[AES_ECB_BLK_SZ]);
+    memset(temp, 0, AES_ECB_BLK_SZ);
+
+    /* The refill is started only after the new Key and V are committed. */
+    pool_refill_start();
+
+    return 0;
+}
+
+void nrfx_cracen_ctr_drbg_reseed_request(void)
+{
+    NRFX_ASSERT(m_cb.initialized != NRFX_DRV_STATE_UNINITIALIZED);
+
+    bool start = false;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (!m_cb.reseed_pending && !m_cb.entropy_ready)
+    {
+        start = true;
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if (start)
+    {
+        nrf_cracen_module_enable(NRF_CRACEN, NRF_CRACEN_MODULE_RNG_MASK);
+        trng_init();
+        m_cb.reseed_pending = true;
+    }
+}
+
+int nrfx_cracen_ctr_drbg_pool_init(uint8_t * p_buffer, size_t size, size_t threshold)
+{
+    NRFX_ASSERT(m_cb.initialized != NRFX_DRV_STATE_UNINITIALIZED);
+
+    if (m_cb.p_pool != NULL)
+    {
+        return -EALREADY;
+    }
+
+    if ((p_buffer == NULL) || (size < AES_ECB_BLK_SZ) || (threshold > size))
+    {
+        return -EINVAL;
+    }
+
+    m_cb.pool_size      = size;
+    m_cb.pool_threshold = threshold;
+    m_cb.pool_rd        = 0;
+    m_cb.pool_level     = 0;
+    m_cb.p_pool         = p_buffer;
+
+    pool_refill_start();
+
+    return 0;
+}
+
+void nrfx_cracen_ctr_drbg_pool_uninit(void)
+{
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (m_cb.p_pool != NULL)
+    {
+        memset(m_cb.p_pool, 0, m_cb.pool_size);
+    }
+    m_cb.pool_level = 0;
+    m_cb.p_pool     = NULL;
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+int nrfx_cracen_ctr_drbg_pool_get(uint8_t * p_buf, size_t size)
+{
+    NRFX_ASSERT(m_cb.p_pool != NULL);
+
+    if (size > 0 && p_buf == NULL)
+    {
+        return -EINVAL;
+    }
+
+    int err_code = 0;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (size > m_cb.pool_level)
+    {
+        err_code = -EAGAIN;
+    }
+    else
+    {
+        /* Data is consumed and cleared within the critical section so that it is never
+         * handed out twice. */
+        size_t first = NRFX_MIN(size, m_cb.pool_size - m_cb.pool_rd);
+
+        memcpy(p_buf, &m_cb.p_pool[m_cb.pool_rd], first);
+        memset(&m_cb.p_pool[m_cb.pool_rd], 0, first);
+        memcpy(&p_buf[first], m_cb.p_pool, size - first);
+        memset(m_cb.p_pool, 0, size - first);
+
+        m_cb.pool_rd     = (m_cb.pool_rd + size) % m_cb.pool_size;
+        m_cb.pool_level -= size;
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    pool_refill_start();
+
+    return err_code;
+}
+
+size_t nrfx_cracen_ctr_drbg_pool_level_get(void)
+{
+    return m_cb.pool_level;
+}
+
+int nrfx_cracen_cm_job_start(nrfx_cracen_cm_job_t *   p_job,
+                             nrfx_cracen_cm_handler_t handler,
+                             void *                   p_context)
+{
+    NRFX_ASSERT(m_cb.initialized != NRFX_DRV_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_job);
+
+    int err_code;
+
+    if ((p_job->in_count > NRFX_CRACEN_CM_SG_MAX) ||
+        (p_job->aad_count > NRFX_CRACEN_CM_SG_MAX))
+    {
+        return -EINVAL;
+    }
+
+    if (!cm_job_reserve(p_job))
+    {
+        return -EBUSY;
+    }
+
+    p_job->handler   = handler;
+    p_job->p_context = p_context;
+
+    if (p_job->op == NRFX_CRACEN_CM_OP_SHA256)
+    {
+        if ((p_job->p_tag == NULL) || (p_job->tag_size != NRFX_CRACEN_SHA256_DIGEST_SIZE))
         {
-            return -ECANCELED;
+            err_code = -EINVAL;
         }
+        else
+        {
+            hash_job_build(p_job, m_sha256_iv, p_job->p_in, p_job->in_count, true,
+                           sg_length(p_job->p_in, p_job->in_count), p_job->p_tag);
+            err_code = 0;
+        }
+    }
+    else
+    {
+        err_code = aes_job_build(p_job);
+    }
 
-        memcpy(p_buf, temp, cur_len);
-
-        size -= cur_len;
-        p_buf += cur_len;
+    if (err_code != 0)
+    {
+        m_cb.p_cm_job = NULL;
+        return err_code;
     }
 
-    r = ctr_drbg_update(NULL);
-    if (r != OK)
+    err_code = cm_job_run(p_job);
+    if (handler == NULL)
     {
-        return -ECANCELED;
+        pool_refill_start();
     }
 
-    m_cb.reseed_counter += 1;
-    r = nrfx_cracen_entropy_get(p_buf, size);
+    return err_code;
+}
 
-    if (r != 0)
+bool nrfx_cracen_cm_busy_check(void)
+{
+    return (m_cb.p_cm_job != NULL);
+}
+
+void nrfx_cracen_sha256_init(nrfx_cracen_sha256_ctx_t * p_ctx)
+{
+    NRFX_ASSERT(p_ctx);
+
+    memcpy(p_ctx->state, m_sha256_iv, sizeof(p_ctx->state));
+    p_ctx->block_len = 0;
+    p_ctx->length    = 0;
+}
+
+int nrfx_cracen_sha256_update(nrfx_cracen_sha256_ctx_t * p_ctx,
+                              uint8_t const *            p_data,
+                              size_t                     size)
+{
+    NRFX_ASSERT(m_cb.initialized != NRFX_DRV_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_ctx);
+    NRFX_ASSERT(p_data || (size == 0));
+
+    size_t total = p_ctx->block_len + size;
+
+    if (total >= NRFX_CRACEN_SHA256_BLOCK_SIZE)
     {
-        return -ECANCELED;
+        size_t direct = (total - (total % NRFX_CRACEN_SHA256_BLOCK_SIZE)) - p_ctx->block_len;
+
+        int err_code = sha256_blocks_process(p_ctx, p_data, direct, false, p_ctx->state);
+        if (err_code != 0)
+        {
+            return err_code;
+        }
+        p_data += direct;
+        size   -= direct;
     }
+
+    memcpy(&p_ctx->block[p_ctx->block_len], p_data, size);
+    p_ctx->block_len += size;
+
     return 0;
 }
+
+int nrfx_cracen_sha256_finish(nrfx_cracen_sha256_ctx_t * p_ctx, uint8_t * p_digest)
+{
+    NRFX_ASSERT(m_cb.initialized != NRFX_DRV_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_ctx);
+    NRFX_ASSERT(p_digest);
+
+    return sha256_blocks_process(p_ctx, NULL, 0, true, p_digest);
+}
+
+void nrfx_cracen_irq_handler(void)
+{
+    nrfx_cracen_cm_job_t * p_job = m_cb.p_cm_job;
+
+    if (!nrf_cracen_event_check(NRF_CRACEN, NRF_CRACEN_EVENT_CRYPTOMASTER))
+    {
+        return;
+    }
+    nrf_cracen_event_clear(NRF_CRACEN, NRF_CRACEN_EVENT_CRYPTOMASTER);
+
+    if ((p_job == NULL) || (p_job->handler == NULL))
+    {
+        return;
+    }
+
+    cracen_ret_t ret = cm_done_check();
+    if (ret == HW_PROCESSING)
+    {
+        return;
+    }
+
+    p_job->result = cm_job_finalize(p_job, ret);
+
+    if (p_job == &m_cb.pool_job)
+    {
+        /* The refill is committed before the CryptoMaster is released. */
+        p_job->handler(p_job, p_job->p_context);
+        m_cb.p_cm_job = NULL;
+        if (p_job->result == 0)
+        {
+            pool_refill_start();
+        }
+        return;
+    }
+
+    m_cb.p_cm_job = NULL;
+    p_job->handler(p_job, p_job->p_context);
+    pool_refill_start();
+}
 #endif
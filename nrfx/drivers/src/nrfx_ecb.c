@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include <nrfx.h>
+#include <nrfx_ecb.h>
+
+#define NRFX_LOG_MODULE ECB
+#include <nrfx_log.h>
+
+#if defined(NRF_ECB00)
+#define ECB_REG  NRF_ECB00
+#define ECB_IRQN ECB00_IRQn
+#else
+#define ECB_REG  NRF_ECB
+#define ECB_IRQN ECB_IRQn
+#endif
+
+#if NRF_ECB_HAS_TASK_STARTECB
+#define ECB_TASK_START NRF_ECB_TASK_STARTECB
+#define ECB_TASK_STOP  NRF_ECB_TASK_STOPECB
+#else
+#define ECB_TASK_START NRF_ECB_TASK_START
+#define ECB_TASK_STOP  NRF_ECB_TASK_STOP
+#endif
+
+#if NRF_ECB_HAS_EVENT_ENDECB
+#define ECB_EVENT_END   NRF_ECB_EVENT_ENDECB
+#define ECB_EVENT_ERROR NRF_ECB_EVENT_ERRORECB
+#define ECB_INT_MASK    (NRF_ECB_INT_ENDECB_MASK | NRF_ECB_INT_ERRORECB_MASK)
+#else
+#define ECB_EVENT_END   NRF_ECB_EVENT_END
+#define ECB_EVENT_ERROR NRF_ECB_EVENT_ERROR
+#define ECB_INT_MASK    (NRF_ECB_INT_END_MASK | NRF_ECB_INT_ERROR_MASK)
+#endif
+
+#if NRF_ECB_HAS_ECBDATAPTR
+/* Data structure pointed to by ECBDATAPTR. */
+typedef struct
+{
+    uint8_t key[NRFX_ECB_BLOCK_SIZE];
+    uint8_t cleartext[NRFX_ECB_BLOCK_SIZE];
+    uint8_t ciphertext[NRFX_ECB_BLOCK_SIZE];
+} ecb_data_t;
+#endif
+
+/* Control block - driver instance local data. */
+typedef struct
+{
+    nrfx_ecb_job_t * volatile p_head;    /* Job in progress, followed by the queued ones. */
+    nrfx_ecb_job_t *          p_tail;
+    size_t                    block_idx;
+    uint8_t                   retry_count; /* Consecutive ERROR events for the current block. */
+    bool                      key_valid;
+#if NRF_ECB_HAS_ECBDATAPTR
+    ecb_data_t                data;
+#else
+    uint32_t                  key[NRFX_ECB_BLOCK_SIZE / sizeof(uint32_t)];
+    nrf_vdma_job_t            in_job[2];
+    nrf_vdma_job_t            out_job[2];
+#endif
+    nrfx_drv_state_t          state;
+} ecb_control_block_t;
+
+static ecb_control_block_t m_cb;
+
+static void block_start(nrfx_ecb_block_t const * p_block)
+{
+#if NRF_ECB_HAS_ECBDATAPTR
+    if (!m_cb.key_valid || memcmp(m_cb.data.key, p_block->p_key, NRFX_ECB_BLOCK_SIZE))
+    {
+        memcpy(m_cb.data.key, p_block->p_key, NRFX_ECB_BLOCK_SIZE);
+        m_cb.key_valid = true;
+    }
+    memcpy(m_cb.data.cleartext, p_block->p_cleartext, NRFX_ECB_BLOCK_SIZE);
+#else
+    if (!m_cb.key_valid || memcmp(m_cb.key, p_block->p_key, NRFX_ECB_BLOCK_SIZE))
+    {
+        memcpy(m_cb.key, p_block->p_key, NRFX_ECB_BLOCK_SIZE);
+        nrf_ecb_key_set(ECB_REG, m_cb.key);
+        m_cb.key_valid = true;
+    }
+
+    /* The blocks are transferred directly from and to the buffers of the job. */
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+#endif /* __GNUC__ */
+    nrf_vdma_job_fill(&m_cb.in_job[0], (void *)p_block->p_cleartext, NRFX_ECB_BLOCK_SIZE,
+                      NRF_VDMA_ATTRIBUTE_PLAIN_DATA);
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif /* __GNUC__ */
+    nrf_vdma_job_fill(&m_cb.out_job[0], p_block->p_ciphertext, NRFX_ECB_BLOCK_SIZE,
+                      NRF_VDMA_ATTRIBUTE_PLAIN_DATA);
+#endif
+
+    nrf_ecb_task_trigger(ECB_REG, ECB_TASK_START);
+}
+
+static void job_complete(int result)
+{
+    nrfx_ecb_job_t * p_job = m_cb.p_head;
+
+    /* Start the next job before calling the handler to keep the peripheral busy. */
+    NRFX_CRITICAL_SECTION_ENTER();
+    m_cb.p_head = p_job->p_next;
+    if (m_cb.p_head == NULL)
+    {
+        m_cb.p_tail = NULL;
+    }
+    m_cb.block_idx   = 0;
+    m_cb.retry_count = 0;
+    if (m_cb.p_head)
+    {
+        block_start(&m_cb.p_head->p_blocks[0]);
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    NRFX_LOG_DEBUG("Job completed, %d blocks, result %d.", (int)p_job->count, result);
+    p_job->handler(p_job, result, p_job->p_context);
+}
+
+int nrfx_ecb_init(nrfx_ecb_config_t const * p_config)
+{
+    NRFX_ASSERT(p_config);
+
+    int err_code;
+
+    if (m_cb.state != NRFX_DRV_STATE_UNINITIALIZED)
+    {
+        err_code = -EALREADY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    m_cb.p_head    = NULL;
+    m_cb.p_tail    = NULL;
+    m_cb.block_idx   = 0;
+    m_cb.retry_count = 0;
+    m_cb.key_valid   = false;
+
+#if NRF_ECB_HAS_ECBDATAPTR
+    nrf_ecb_data_pointer_set(ECB_REG, &m_cb.data);
+#else
+    nrf_vdma_job_terminate(&m_cb.in_job[1]);
+    nrf_vdma_job_terminate(&m_cb.out_job[1]);
+    nrf_ecb_in_ptr_set(ECB_REG, m_cb.in_job);
+    nrf_ecb_out_ptr_set(ECB_REG, m_cb.out_job);
+#endif
+
+    nrf_ecb_event_clear(ECB_REG, ECB_EVENT_END);
+    nrf_ecb_event_clear(ECB_REG, ECB_EVENT_ERROR);
+    nrf_ecb_int_enable(ECB_REG, ECB_INT_MASK);
+    NRFX_IRQ_PRIORITY_SET(ECB_IRQN, p_config->interrupt_priority);
+    NRFX_IRQ_ENABLE(ECB_IRQN);
+
+    m_cb.state = NRFX_DRV_STATE_INITIALIZED;
+
+    err_code = 0;
+    NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+void nrfx_ecb_uninit(void)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+
+    NRFX_IRQ_DISABLE(ECB_IRQN);
+    nrf_ecb_int_disable(ECB_REG, ECB_INT_MASK);
+    nrf_ecb_task_trigger(ECB_REG, ECB_TASK_STOP);
+    nrf_ecb_event_clear(ECB_REG, ECB_EVENT_END);
+    nrf_ecb_event_clear(ECB_REG, ECB_EVENT_ERROR);
+
+#if NRF_ECB_HAS_ECBDATAPTR
+    memset(&m_cb.data, 0, sizeof(m_cb.data));
+#else
+    memset(m_cb.key, 0, sizeof(m_cb.key));
+#endif
+    m_cb.key_valid = false;
+
+    nrfx_ecb_job_t * p_job = m_cb.p_head;
+
+    m_cb.p_head = NULL;
+    m_cb.p_tail = NULL;
+
+    m_cb.state = NRFX_DRV_STATE_UNINITIALIZED;
+    NRFX_LOG_INFO("Uninitialized.");
+
+    /* Complete the dropped jobs, so that their owners can release them. */
+    while (p_job)
+    {
+        nrfx_ecb_job_t * p_next = p_job->p_next;
+
+        p_job->handler(p_job, -ECANCELED, p_job->p_context);
+        p_job = p_next;
+    }
+}
+
+bool nrfx_ecb_init_check(void)
+{
+    return (m_cb.state != NRFX_DRV_STATE_UNINITIALIZED);
+}
+
+int nrfx_ecb_job_submit(nrfx_ecb_job_t *       p_job,
+                        nrfx_ecb_job_handler_t handler,
+                        void *                 p_context)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(p_job);
+    NRFX_ASSERT(handler);
+
+    int err_code;
+
+    if ((p_job->count == 0) || (p_job->p_blocks == NULL))
+    {
+        err_code = -EINVAL;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_job->handler   = handler;
+    p_job->p_context = p_context;
+    p_job->p_next    = NULL;
+
+    /* The job is started in the same critical section in which it is linked, so that
+     * the interrupt handler cannot complete the previous job in between and start this one
+     * a second time. */
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (m_cb.p_tail)
+    {
+        m_cb.p_tail->p_next = p_job;
+    }
+    else
+    {
+        m_cb.p_head = p_job;
+    }
+    m_cb.p_tail = p_job;
+    if (m_cb.p_head == p_job)
+    {
+        m_cb.block_idx   = 0;
+        m_cb.retry_count = 0;
+        block_start(&p_job->p_blocks[0]);
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return 0;
+}
+
+bool nrfx_ecb_busy_check(void)
+{
+    return (m_cb.p_head != NULL);
+}
+
+void nrfx_ecb_irq_handler(void)
+{
+    nrfx_ecb_job_t * p_job = m_cb.p_head;
+
+    if (nrf_ecb_event_check(ECB_REG, ECB_EVENT_ERROR))
+    {
+        nrf_ecb_event_clear(ECB_REG, ECB_EVENT_ERROR);
+        NRFX_LOG_DEBUG("Event: ECB_EVENT_ERROR.");
+
+        /* The encryption was aborted, most likely preempted by another user of the AES
+         * core. Start the same block again, unless it keeps failing. */
+        if (p_job == NULL)
+        {
+            return;
+        }
+        if (++m_cb.retry_count < NRFX_ECB_ERROR_RETRY_MAX)
+        {
+            block_start(&p_job->p_blocks[m_cb.block_idx]);
+        }
+        else
+        {
+            NRFX_LOG_WARNING("Block %d aborted %d times.",
+                             (int)m_cb.block_idx,
+                             (int)m_cb.retry_count);
+            job_complete(-EIO);
+        }
+        return;
+    }
+
+    if (!nrf_ecb_event_check(ECB_REG, ECB_EVENT_END))
+    {
+        return;
+    }
+    nrf_ecb_event_clear(ECB_REG, ECB_EVENT_END);
+
+    if (p_job == NULL)
+    {
+        return;
+    }
+
+#if NRF_ECB_HAS_ECBDATAPTR
+    memcpy(p_job->p_blocks[m_cb.block_idx].p_ciphertext,
+           m_cb.data.ciphertext,
+           NRFX_ECB_BLOCK_SIZE);
+#endif
+
+    m_cb.retry_count = 0;
+    if (++m_cb.block_idx < p_job->count)
+    {
+        block_start(&p_job->p_blocks[m_cb.block_idx]);
+        return;
+    }
+
+    job_complete(0);
+}
@@ -39,6 +39,18 @@
 #define NRFX_LOG_MODULE GPIOTE
 #include <nrfx_log.h>
 
+#ifndef NRFX_GPIOTE_PORT_EVENT_HOOK_BEGIN
+/* Hook called when processing of the PORT event starts. Together with
+ * @ref NRFX_GPIOTE_PORT_EVENT_HOOK_END it can be used to measure the duration of
+ * the processing, for example with NRFX_TRACE_BEGIN and NRFX_TRACE_END. */
+#define NRFX_GPIOTE_PORT_EVENT_HOOK_BEGIN()
+#endif
+
+#ifndef NRFX_GPIOTE_PORT_EVENT_HOOK_END
+/* Hook called when processing of the PORT event ends. */
+#define NRFX_GPIOTE_PORT_EVENT_HOOK_END()
+#endif
+
 /* Macro returning mask of pins in the port */
 #define GPIO_PIN_MASK(periph, prefix, i, _) NRFX_CONCAT(periph, prefix, i, _FEATURE_PINS_PRESENT)
 
@@ -439,6 +451,32 @@ static void release_handler(nrfx_gpiote_t * p_instance, nrfx_gpiote_pin_t pin)
     }
 }
 
+/* Sense is configured by the driver only through this function, so the sense mirror in
+ * the control block can be used by the PORT event handler. */
+static void pin_sense_set(nrfx_gpiote_control_block_t * p_cb,
+                          nrfx_gpiote_pin_t             pin,
+                          nrf_gpio_pin_sense_t          sense)
+{
+#if !defined(NRF_GPIO_LATCH_PRESENT)
+    uint32_t port_idx = pin >> 5;
+    uint32_t mask = NRFX_BIT(pin & 0x1F);
+
+    (void)NRFX_ATOMIC_FETCH_AND(&p_cb->sense_high[port_idx], ~mask);
+    (void)NRFX_ATOMIC_FETCH_AND(&p_cb->sense_low[port_idx], ~mask);
+    if (sense == NRF_GPIO_PIN_SENSE_HIGH)
+    {
+        (void)NRFX_ATOMIC_FETCH_OR(&p_cb->sense_high[port_idx], mask);
+    }
+    else if (sense == NRF_GPIO_PIN_SENSE_LOW)
+    {
+        (void)NRFX_ATOMIC_FETCH_OR(&p_cb->sense_low[port_idx], mask);
+    }
+#else
+    (void)p_cb;
+#endif
+    nrfy_gpio_cfg_sense_set(pin, sense);
+}
+
 /* Function releases the handler associated with the pin and sets GPIOTE channel
  * configuration to default if it was used with the pin.
  */
@@ -453,6 +491,7 @@ static void pin_handler_trigger_uninit(nrfx_gpiote_t * p_instance, nrfx_gpiote_p
     {
 #if !defined(NRF_GPIO_LATCH_PRESENT)
         nrf_bitmask_bit_clear(pin, (uint8_t *)p_instance->cb.port_pins);
+        nrf_bitmask_bit_clear(pin, (uint8_t *)p_instance->cb.level_pins);
 #endif
     }
 
@@ -463,7 +502,7 @@ static void pin_handler_trigger_uninit(nrfx_gpiote_t * p_instance, nrfx_gpiote_p
 /* Function disabling sense level for the given pin
  * or disabling interrupts and events for GPIOTE channel if it was used with the pin.
  */
-static void pin_trigger_disable(nrfx_gpiote_t const * p_instance, nrfx_gpiote_pin_t pin)
+static void pin_trigger_disable(nrfx_gpiote_t * p_instance, nrfx_gpiote_pin_t pin)
 {
     if (pin_in_use_by_te(p_instance, pin) && pin_is_input(p_instance, pin))
     {
@@ -480,7 +519,7 @@ static void pin_trigger_disable(nrfx_gpiote_t const * p_instance, nrfx_gpiote_pi
     }
     else
     {
-        nrfy_gpio_cfg_sense_set(pin, NRF_GPIO_PIN_NOSENSE);
+        pin_sense_set(&p_instance->cb, pin, NRF_GPIO_PIN_NOSENSE);
     }
 }
 
@@ -692,6 +731,7 @@ static int gpiote_input_configure(nrfx_gpiote_t *                        p_insta
         if (use_evt || trigger == NRFX_GPIOTE_TRIGGER_NONE)
         {
             nrf_bitmask_bit_clear(pin, (uint8_t *)cb->port_pins);
+            nrf_bitmask_bit_clear(pin, (uint8_t *)cb->level_pins);
         }
         else
         {
@@ -702,6 +742,14 @@ static int gpiote_input_configure(nrfx_gpiote_t *                        p_insta
             }
 #endif
             nrf_bitmask_bit_set(pin, (uint8_t *)cb->port_pins);
+            if (is_level(trigger))
+            {
+                nrf_bitmask_bit_set(pin, (uint8_t *)cb->level_pins);
+            }
+            else
+            {
+                nrf_bitmask_bit_clear(pin, (uint8_t *)cb->level_pins);
+            }
         }
 #endif
         cb->pin_flags[idx] &= (uint16_t)~PIN_FLAG_TRIG_MODE_MASK;
@@ -1070,9 +1118,9 @@ static void pin_clr_task_trigger(nrfx_gpiote_t const * p_instance, nrfx_gpiote_p
 }
 #endif // defined(GPIOTE_FEATURE_CLR_PRESENT)
 
-static void pin_trigger_enable(nrfx_gpiote_t const * p_instance,
-                               nrfx_gpiote_pin_t     pin,
-                               bool                  int_enable)
+static void pin_trigger_enable(nrfx_gpiote_t *   p_instance,
+                               nrfx_gpiote_pin_t pin,
+                               bool              int_enable)
 {
     NRFX_ASSERT(pin_has_trigger(p_instance, pin));
 
@@ -1101,7 +1149,7 @@ static void pin_trigger_enable(nrfx_gpiote_t const * p_instance,
         }
 
         NRFX_ASSERT(int_enable);
-        nrfy_gpio_cfg_sense_set(pin, get_initial_sense(p_instance, pin));
+        pin_sense_set(&p_instance->cb, pin, get_initial_sense(p_instance, pin));
     }
 }
 
@@ -1313,16 +1361,16 @@ void nrfx_gpiote_clr_task_trigger(nrfx_gpiote_t const * p_instance, nrfx_gpiote_
 }
 #endif // defined(GPIOTE_FEATURE_CLR_PRESENT)
 
-void nrfx_gpiote_trigger_enable(nrfx_gpiote_t const * p_instance,
-                                nrfx_gpiote_pin_t     pin,
-                                bool                  int_enable)
+void nrfx_gpiote_trigger_enable(nrfx_gpiote_t *   p_instance,
+                                nrfx_gpiote_pin_t pin,
+                                bool              int_enable)
 {
     NRFX_ASSERT(p_instance);
 
     pin_trigger_enable(p_instance, pin, int_enable);
 }
 
-void nrfx_gpiote_trigger_disable(nrfx_gpiote_t const * p_instance, nrfx_gpiote_pin_t pin)
+void nrfx_gpiote_trigger_disable(nrfx_gpiote_t * p_instance, nrfx_gpiote_pin_t pin)
 {
     NRFX_ASSERT(p_instance);
 
@@ -1369,8 +1417,8 @@ static void next_sense_cond_call_handler(nrfx_gpiote_control_block_t * p_cb,
         {
             /* The sensing mechanism needs to be reenabled here so that the PORT event
              * is generated again for the pin if it stays at the sensed level. */
-            nrfy_gpio_cfg_sense_set(pin, NRF_GPIO_PIN_NOSENSE);
-            nrfy_gpio_cfg_sense_set(pin, sense);
+            pin_sense_set(p_cb, pin, NRF_GPIO_PIN_NOSENSE);
+            pin_sense_set(p_cb, pin, sense);
         }
     }
     else
@@ -1381,7 +1429,7 @@ static void next_sense_cond_call_handler(nrfx_gpiote_control_block_t * p_cb,
         nrf_gpio_pin_sense_t next_sense = (sense == NRF_GPIO_PIN_SENSE_HIGH) ?
                 NRF_GPIO_PIN_SENSE_LOW : NRF_GPIO_PIN_SENSE_HIGH;
 
-        nrfy_gpio_cfg_sense_set(pin, next_sense);
+        pin_sense_set(p_cb, pin, next_sense);
 
         /* Invoke user handler only if the sensed pin level matches its polarity
          * configuration. Call handler unconditionally in case of toggle trigger or
@@ -1493,12 +1541,21 @@ static bool input_read_and_check(uint32_t * input,
     return process_inputs_again;
 }
 
+/* Function returns mask of pins which input level matches the sensed level. */
+static inline uint32_t sensed_pins_get(nrfx_gpiote_control_block_t const * p_cb,
+                                       uint32_t                            port_idx,
+                                       uint32_t                            input)
+{
+    return (input & p_cb->sense_high[port_idx]) | (~input & p_cb->sense_low[port_idx]);
+}
+
 static void port_event_handle(NRF_GPIOTE_Type *             p_gpiote,
                               nrfx_gpiote_control_block_t * p_cb,
                               const gpiote_config_t *       p_config)
 {
     uint32_t pins_to_check[GPIO_COUNT] = {0};
     uint32_t input[GPIO_COUNT] = {0};
+    uint32_t pins;
     uint8_t rel_pin;
     nrfx_gpiote_pin_t pin;
     nrfx_gpiote_trigger_t trigger;
@@ -1515,26 +1572,22 @@ static void port_event_handle(NRF_GPIOTE_Type *             p_gpiote,
     do {
         for (uint32_t i = 0; i < GPIO_COUNT; i++)
         {
-            while (pins_to_check[i])
+            /* Process only pins which state matches their sense level. Mask is evaluated
+             * again after each handler as the handler may reconfigure other pins. */
+            while ((pins = pins_to_check[i] & sensed_pins_get(p_cb, i, input[i])) != 0)
             {
                 nrf_gpio_pin_sense_t sense;
-                bool pin_state;
 
-                rel_pin = (uint8_t)NRF_CTZ(pins_to_check[i]);
+                rel_pin = (uint8_t)NRF_CTZ(pins);
                 pins_to_check[i] &= ~NRFX_BIT(rel_pin);
                 /* Absolute */
                 pin = rel_pin + 32 * i;
 
                 trigger = PIN_FLAG_TRIG_MODE_GET(p_cb->pin_flags[get_pin_idx(pin)]);
-                sense = nrfy_gpio_pin_sense_get(pin);
-                pin_state = nrf_bitmask_bit_is_set(pin, input);
+                sense = (p_cb->sense_high[i] & NRFX_BIT(rel_pin)) ?
+                        NRF_GPIO_PIN_SENSE_HIGH : NRF_GPIO_PIN_SENSE_LOW;
 
-                /* Process pin further only if its state matches its sense level. */
-                if ((pin_state && (sense == NRF_GPIO_PIN_SENSE_HIGH)) ||
-                    (!pin_state && (sense == NRF_GPIO_PIN_SENSE_LOW)) )
-                {
-                    next_sense_cond_call_handler(p_cb, pin, trigger, sense);
-                }
+                next_sense_cond_call_handler(p_cb, pin, trigger, sense);
             }
         }
 
@@ -1548,28 +1601,12 @@ static void port_event_handle(NRF_GPIOTE_Type *             p_gpiote,
 
                 /* Small trick to continue check if input level is equal to the trigger:
                 * Set input to the opposite level. If input equals trigger level that
-                * it will be set in pins_to_check. */
+                * it will be set in pins_to_check. Sense level of the level-triggered
+                * pin is the same as the trigger level. */
+                pins = pins_to_check[port_idx] & p_cb->level_pins[port_idx];
 
-                uint32_t pin_mask = pins_to_check[port_idx];
-
-                while (pin_mask)
-                {
-                    rel_pin = (uint8_t)NRF_CTZ(pin_mask);
-                    pin_mask &= ~NRFX_BIT(rel_pin);
-                    pin = rel_pin + 32 * port_idx;
-                    if (nrfy_gpio_pin_sense_get(pin) != NRF_GPIO_PIN_NOSENSE)
-                    {
-                        trigger = PIN_FLAG_TRIG_MODE_GET(p_cb->pin_flags[get_pin_idx(pin)]);
-                        if (trigger == NRFX_GPIOTE_TRIGGER_HIGH)
-                        {
-                            input[port_idx] &= ~NRFX_BIT(rel_pin);
-                        }
-                        else if (trigger == NRFX_GPIOTE_TRIGGER_LOW)
-                        {
-                            input[port_idx] |= NRFX_BIT(rel_pin);
-                        }
-                    }
-                }
+                input[port_idx] &= ~(pins & p_cb->sense_high[port_idx]);
+                input[port_idx] |= (pins & p_cb->sense_low[port_idx]);
             }
         }
 
@@ -1615,7 +1652,9 @@ static void irq_handler(NRF_GPIOTE_Type * p_gpiote, nrfx_gpiote_control_block_t
     /* Handle PORT event. */
     if (evt_mask & (uint32_t)NRF_GPIOTE_INT_PORT_MASK)
     {
+        NRFX_GPIOTE_PORT_EVENT_HOOK_BEGIN();
         port_event_handle(p_gpiote, p_cb, p_config);
+        NRFX_GPIOTE_PORT_EVENT_HOOK_END();
         evt_mask &= ~(uint32_t)NRF_GPIOTE_INT_PORT_MASK;
     }
 
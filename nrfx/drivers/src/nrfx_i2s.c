@@ -292,42 +292,22 @@ bool nrfx_i2s_init_check(nrfx_i2s_t const * p_instance)
     return (p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
 }
 
-int nrfx_i2s_start(nrfx_i2s_t *               p_instance,
-                   nrfx_i2s_buffers_t const * p_initial_buffers,
-                   uint8_t                    flags)
+static bool buffers_accessible_check(NRF_I2S_Type *             p_reg,
+                                     nrfx_i2s_buffers_t const * p_buffers)
 {
-    NRFX_ASSERT(p_instance && (p_initial_buffers != NULL) &&
-                ((p_initial_buffers->p_rx_buffer != NULL) ||
-                 (p_initial_buffers->p_tx_buffer != NULL)) &&
-                (p_initial_buffers->buffer_size != 0));
-    (void)(flags);
+    return !(((p_buffers->p_rx_buffer != NULL) &&
+              (!nrf_dma_accessible_check(p_reg, p_buffers->p_rx_buffer) ||
+               !nrfx_is_word_aligned(p_buffers->p_rx_buffer))) ||
+             ((p_buffers->p_tx_buffer != NULL) &&
+              (!nrf_dma_accessible_check(p_reg, p_buffers->p_tx_buffer) ||
+               !nrfx_is_word_aligned(p_buffers->p_tx_buffer))));
+}
 
-    int err_code;
+static void transfer_start(nrfx_i2s_t *               p_instance,
+                           nrfx_i2s_buffers_t const * p_initial_buffers)
+{
     nrfx_i2s_control_block_t * p_cb = &p_instance->cb;
 
-    if (p_cb->state != NRFX_DRV_STATE_INITIALIZED)
-    {
-        err_code = -EINPROGRESS;
-        NRFX_LOG_WARNING("Function: %s, error code: %s.",
-                         __func__,
-                         NRFX_LOG_ERROR_STRING_GET(err_code));
-        return err_code;
-    }
-
-    if (((p_initial_buffers->p_rx_buffer != NULL) &&
-         (!nrf_dma_accessible_check(p_instance->p_reg, p_initial_buffers->p_rx_buffer) ||
-          !nrfx_is_word_aligned(p_initial_buffers->p_rx_buffer))) ||
-        ((p_initial_buffers->p_tx_buffer != NULL) &&
-         (!nrf_dma_accessible_check(p_instance->p_reg, p_initial_buffers->p_tx_buffer) ||
-          !nrfx_is_word_aligned(p_initial_buffers->p_tx_buffer))))
-    {
-        err_code = -EACCES;
-        NRFX_LOG_WARNING("Function: %s, error code: %s.",
-                         __func__,
-                         NRFX_LOG_ERROR_STRING_GET(err_code));
-        return err_code;
-    }
-
     p_cb->use_rx         = (p_initial_buffers->p_rx_buffer != NULL);
     p_cb->use_tx         = (p_initial_buffers->p_tx_buffer != NULL);
     p_cb->rx_ready       = false;
@@ -362,6 +342,42 @@ int nrfx_i2s_start(nrfx_i2s_t *               p_instance,
     nrfy_i2s_xfer_start(p_instance->p_reg, NULL);
 
     NRFX_LOG_INFO("Started.");
+}
+
+int nrfx_i2s_start(nrfx_i2s_t *               p_instance,
+                   nrfx_i2s_buffers_t const * p_initial_buffers,
+                   uint8_t                    flags)
+{
+    NRFX_ASSERT(p_instance && (p_initial_buffers != NULL) &&
+                ((p_initial_buffers->p_rx_buffer != NULL) ||
+                 (p_initial_buffers->p_tx_buffer != NULL)) &&
+                (p_initial_buffers->buffer_size != 0));
+    (void)(flags);
+
+    int err_code;
+    nrfx_i2s_control_block_t * p_cb = &p_instance->cb;
+
+    if (p_cb->state != NRFX_DRV_STATE_INITIALIZED)
+    {
+        err_code = -EINPROGRESS;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if (!buffers_accessible_check(p_instance->p_reg, p_initial_buffers))
+    {
+        err_code = -EACCES;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_cb->p_ring = NULL;
+    transfer_start(p_instance, p_initial_buffers);
+
     return 0;
 }
 
@@ -375,6 +391,15 @@ int nrfx_i2s_next_buffers_set(nrfx_i2s_t *               p_instance,
     int err_code;
     nrfx_i2s_control_block_t * p_cb = &p_instance->cb;
 
+    if (p_cb->p_ring != NULL)
+    {
+        err_code = -EPERM;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
     if (!p_cb->buffers_needed)
     {
         err_code = -EINPROGRESS;
@@ -384,12 +409,7 @@ int nrfx_i2s_next_buffers_set(nrfx_i2s_t *               p_instance,
         return err_code;
     }
 
-    if (((p_buffers->p_rx_buffer != NULL) &&
-         (!nrf_dma_accessible_check(p_instance->p_reg, p_buffers->p_rx_buffer) ||
-          !nrfx_is_word_aligned(p_buffers->p_rx_buffer))) ||
-        ((p_buffers->p_tx_buffer != NULL) &&
-         (!nrf_dma_accessible_check(p_instance->p_reg, p_buffers->p_tx_buffer) ||
-          !nrfx_is_word_aligned(p_buffers->p_tx_buffer))))
+    if (!buffers_accessible_check(p_instance->p_reg, p_buffers))
     {
         err_code = -EACCES;
         NRFX_LOG_WARNING("Function: %s, error code: %s.",
@@ -415,6 +435,172 @@ int nrfx_i2s_next_buffers_set(nrfx_i2s_t *               p_instance,
     return 0;
 }
 
+static void ring_next_buffers_set(nrfx_i2s_t * p_instance)
+{
+    nrfx_i2s_control_block_t * p_cb = &p_instance->cb;
+
+    if (!p_cb->buffers_needed || (p_cb->ring_queued == 0))
+    {
+        return;
+    }
+
+    p_cb->next_buffers = p_cb->p_ring[p_cb->ring_idx];
+    nrfy_i2s_buffers_set(p_instance->p_reg, &p_cb->next_buffers);
+
+    p_cb->ring_idx = (uint8_t)((p_cb->ring_idx + 1) % p_cb->ring_size);
+    p_cb->ring_queued--;
+    p_cb->buffers_needed = false;
+}
+
+static void ring_buffers_process(nrfx_i2s_t *               p_instance,
+                                 nrfx_i2s_buffers_t const * p_released)
+{
+    nrfx_i2s_control_block_t * p_cb = &p_instance->cb;
+
+    if (p_released == NULL)
+    {
+        // The peripheral had to start processing the current buffers again,
+        // because no buffer was queued in time.
+        if (p_cb->use_tx)
+        {
+            p_cb->ring_stats.underrun_count++;
+        }
+        if (p_cb->use_rx)
+        {
+            p_cb->ring_stats.overrun_count++;
+        }
+        ring_next_buffers_set(p_instance);
+        return;
+    }
+
+    ring_next_buffers_set(p_instance);
+
+    if ((p_released->p_rx_buffer != NULL) || (p_released->p_tx_buffer != NULL))
+    {
+        p_cb->ring_held++;
+        p_cb->handler(p_released, NRFX_I2S_STATUS_BUFFER_RELEASED);
+    }
+}
+
+int nrfx_i2s_ring_start(nrfx_i2s_t *               p_instance,
+                        nrfx_i2s_buffers_t const * p_ring,
+                        uint8_t                    count,
+                        uint8_t                    flags)
+{
+    NRFX_ASSERT(p_instance && p_ring);
+    (void)(flags);
+
+    int err_code;
+    nrfx_i2s_control_block_t * p_cb = &p_instance->cb;
+
+    if (p_cb->state != NRFX_DRV_STATE_INITIALIZED)
+    {
+        err_code = -EINPROGRESS;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    err_code = 0;
+    if ((count < 2) ||
+        (p_ring[0].buffer_size == 0) ||
+        ((p_ring[0].p_rx_buffer == NULL) && (p_ring[0].p_tx_buffer == NULL)))
+    {
+        err_code = -EINVAL;
+    }
+
+    for (uint8_t i = 0; (i < count) && (err_code == 0); i++)
+    {
+        if (((p_ring[i].p_rx_buffer == NULL) != (p_ring[0].p_rx_buffer == NULL)) ||
+            ((p_ring[i].p_tx_buffer == NULL) != (p_ring[0].p_tx_buffer == NULL)) ||
+            (p_ring[i].buffer_size != p_ring[0].buffer_size))
+        {
+            err_code = -EINVAL;
+        }
+        else if (!buffers_accessible_check(p_instance->p_reg, &p_ring[i]))
+        {
+            err_code = -EACCES;
+        }
+    }
+
+    if (err_code != 0)
+    {
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_cb->p_ring      = p_ring;
+    p_cb->ring_size   = count;
+    p_cb->ring_idx    = 1;
+    p_cb->ring_queued = (uint8_t)(count - 1);
+    p_cb->ring_held   = 0;
+    p_cb->ring_stats  = (nrfx_i2s_ring_stats_t){ 0 };
+
+    transfer_start(p_instance, &p_ring[0]);
+
+    return 0;
+}
+
+int nrfx_i2s_ring_buffer_return(nrfx_i2s_t * p_instance)
+{
+    NRFX_ASSERT(p_instance);
+
+    int err_code = 0;
+    nrfx_i2s_control_block_t * p_cb = &p_instance->cb;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+
+    if ((p_cb->p_ring == NULL) || (p_cb->state != NRFX_DRV_STATE_POWERED_ON))
+    {
+        err_code = -EPERM;
+    }
+    else if (p_cb->ring_held == 0)
+    {
+        err_code = -EINVAL;
+    }
+    else
+    {
+        p_cb->ring_held--;
+        p_cb->ring_queued++;
+        ring_next_buffers_set(p_instance);
+    }
+
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if (err_code != 0)
+    {
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+    }
+    return err_code;
+}
+
+uint8_t nrfx_i2s_ring_fill_level_get(nrfx_i2s_t const * p_instance)
+{
+    NRFX_ASSERT(p_instance);
+
+    nrfx_i2s_control_block_t const * p_cb = &p_instance->cb;
+
+    if ((p_cb->p_ring == NULL) || (p_cb->state != NRFX_DRV_STATE_POWERED_ON))
+    {
+        return 0;
+    }
+
+    return (uint8_t)(p_cb->ring_queued + (p_cb->buffers_needed ? 0 : 1));
+}
+
+void nrfx_i2s_ring_stats_get(nrfx_i2s_t const *      p_instance,
+                             nrfx_i2s_ring_stats_t * p_stats)
+{
+    NRFX_ASSERT(p_instance && p_stats);
+
+    *p_stats = p_instance->cb.ring_stats;
+}
+
 void nrfx_i2s_stop(nrfx_i2s_t * p_instance)
 {
     NRFX_ASSERT(p_instance && (p_instance->cb.state != NRFX_DRV_STATE_UNINITIALIZED));
@@ -615,6 +801,7 @@ void nrfx_i2s_irq_handler(nrfx_i2s_t * p_instance)
         // the next part of the transfer, and signal that the transfer has
         // finished.
 
+        p_cb->p_ring = NULL;
         p_cb->handler(&p_cb->current_buffers, 0);
 
         // Change the state of the driver before calling the handler with
@@ -653,7 +840,14 @@ void nrfx_i2s_irq_handler(nrfx_i2s_t * p_instance)
                 // set in this window, so to be sure this flag is set to true,
                 // set it explicitly.
                 p_cb->buffers_needed = true;
-                p_cb->handler(NULL, NRFX_I2S_STATUS_NEXT_BUFFERS_NEEDED);
+                if (p_cb->p_ring != NULL)
+                {
+                    ring_buffers_process(p_instance, NULL);
+                }
+                else
+                {
+                    p_cb->handler(NULL, NRFX_I2S_STATUS_NEXT_BUFFERS_NEEDED);
+                }
             }
             else
             {
@@ -666,7 +860,14 @@ void nrfx_i2s_irq_handler(nrfx_i2s_t * p_instance)
                 p_cb->next_buffers.p_rx_buffer = NULL;
                 p_cb->next_buffers.p_tx_buffer = NULL;
                 p_cb->buffers_needed = true;
-                p_cb->handler(&released_buffers, NRFX_I2S_STATUS_NEXT_BUFFERS_NEEDED);
+                if (p_cb->p_ring != NULL)
+                {
+                    ring_buffers_process(p_instance, &released_buffers);
+                }
+                else
+                {
+                    p_cb->handler(&released_buffers, NRFX_I2S_STATUS_NEXT_BUFFERS_NEEDED);
+                }
             }
         }
     }
@@ -55,6 +55,13 @@
 
 #endif // NRF_ERRATA_STATIC_CHECK(52, 109)
 
+// Maximum number of duty cycle values in a sequence.
+#if NRF_PWM_HAS_DMA_REG
+#define PWM_SEQ_LENGTH_MAX (PWM_DMA_SEQ_MAXCNT_MAXCNT_Msk / sizeof(uint16_t))
+#else
+#define PWM_SEQ_LENGTH_MAX PWM_SEQ_CNT_CNT_Msk
+#endif
+
 static void pins_configure(nrfx_pwm_config_t const * p_config)
 {
     // Nothing to do here if both GPIO configuration and pin selection are
@@ -191,6 +198,7 @@ int nrfx_pwm_init(nrfx_pwm_t *              p_instance,
 
     p_cb->handler = handler;
     p_cb->p_context = p_context;
+    p_cb->stream.active = false;
 #if NRF_ERRATA_STATIC_CHECK(52, 109)
     if (p_instance->p_reg == NRF_PWM0)
     {
@@ -359,6 +367,7 @@ uint32_t nrfx_pwm_simple_playback(nrfx_pwm_t *               p_instance,
                 nrf_dma_accessible_check(p_instance->p_reg, p_sequence->values.p_raw));
 
     nrfx_pwm_control_block_t * p_cb = &p_instance->cb;
+    p_cb->stream.active = false;
 
     // To take advantage of the looping mechanism, we need to use both sequences
     // (single sequence can be played back only once).
@@ -405,6 +414,7 @@ uint32_t nrfx_pwm_complex_playback(nrfx_pwm_t *               p_instance,
                 nrf_dma_accessible_check(p_instance->p_reg, p_sequence_1->values.p_raw));
 
     nrfx_pwm_control_block_t * p_cb = &p_instance->cb;
+    p_cb->stream.active = false;
 
     nrfy_pwm_sequence_set(p_instance->p_reg, 0, p_sequence_0);
     nrfy_pwm_sequence_set(p_instance->p_reg, 1, p_sequence_1);
@@ -440,6 +450,178 @@ uint32_t nrfx_pwm_complex_playback(nrfx_pwm_t *               p_instance,
     return start_playback(p_instance, p_cb, flags, 0);
 }
 
+static void stream_fill(nrfx_pwm_stream_cb_t * p_stream)
+{
+    nrfx_pwm_stream_config_t const * p_config = &p_stream->config;
+
+    // Blocks are filled in the ring order, so the filling stops at the first
+    // block that is still in use.
+    while (!((p_stream->ready_mask | p_stream->busy_mask) & NRFX_BIT(p_stream->fill_idx)))
+    {
+        uint16_t * p_block = &p_config->p_buffer[p_stream->fill_idx * p_config->block_length];
+
+        if (!p_config->producer(p_block, p_config->block_length, p_config->p_context))
+        {
+            break;
+        }
+        p_stream->ready_mask |= NRFX_BIT(p_stream->fill_idx);
+        p_stream->fill_idx = (uint8_t)((p_stream->fill_idx + 1) % p_config->block_count);
+    }
+}
+
+static void stream_underrun(nrfx_pwm_t * p_instance)
+{
+    nrfx_pwm_control_block_t * p_cb = &p_instance->cb;
+
+    p_cb->stream.underruns++;
+    p_cb->handler(NRFX_PWM_EVENT_STREAM_UNDERRUN, p_cb->p_context);
+}
+
+// Returns the block played by the given sequence to the ring and sets up
+// the sequence with the next ready block.
+static void stream_sequence_next(nrfx_pwm_t * p_instance, uint8_t seq_id)
+{
+    nrfx_pwm_stream_cb_t *           p_stream = &p_instance->cb.stream;
+    nrfx_pwm_stream_config_t const * p_config = &p_stream->config;
+    uint8_t                          idx      = p_stream->play_idx;
+
+    if (p_stream->seq_block[seq_id] >= 0)
+    {
+        p_stream->busy_mask &= ~NRFX_BIT(p_stream->seq_block[seq_id]);
+    }
+
+    stream_fill(p_stream);
+
+    if (p_stream->ready_mask & NRFX_BIT(idx))
+    {
+        nrf_pwm_sequence_t const seq =
+        {
+            .values.p_raw = &p_config->p_buffer[idx * p_config->block_length],
+            .length       = p_config->block_length,
+            .repeats      = p_config->repeats,
+            .end_delay    = 0,
+        };
+
+        nrfy_pwm_sequence_set(p_instance->p_reg, seq_id, &seq);
+        p_stream->ready_mask &= ~NRFX_BIT(idx);
+        p_stream->busy_mask  |= NRFX_BIT(idx);
+        p_stream->seq_block[seq_id] = (int8_t)idx;
+        p_stream->play_idx = (uint8_t)((idx + 1) % p_config->block_count);
+    }
+    else
+    {
+        nrfy_pwm_sequence_set(p_instance->p_reg, seq_id, p_config->p_idle);
+        p_stream->seq_block[seq_id] = -1;
+        stream_underrun(p_instance);
+    }
+}
+
+static void stream_seqend_handle(nrfx_pwm_t * p_instance, uint32_t evt_mask)
+{
+    nrfx_pwm_stream_cb_t * p_stream = &p_instance->cb.stream;
+    uint32_t const seqend_mask[2] =
+    {
+        NRFY_EVENT_TO_INT_BITMASK(NRF_PWM_EVENT_SEQEND0),
+        NRFY_EVENT_TO_INT_BITMASK(NRF_PWM_EVENT_SEQEND1),
+    };
+    uint8_t expected = p_stream->next_end;
+    uint8_t other    = expected ^ 1;
+
+    if (evt_mask & seqend_mask[other])
+    {
+        // Both sequences ended before the interrupt was handled, or the end of
+        // the expected sequence was missed. Either way, the expected sequence is now
+        // played again with its previous block. That block stays in use until
+        // the sequence ends again.
+        stream_underrun(p_instance);
+        stream_sequence_next(p_instance, other);
+    }
+    else if (evt_mask & seqend_mask[expected])
+    {
+        stream_sequence_next(p_instance, expected);
+        p_stream->next_end = other;
+    }
+}
+
+int nrfx_pwm_stream_start(nrfx_pwm_t * p_instance, nrfx_pwm_stream_config_t const * p_config)
+{
+    NRFX_ASSERT(p_instance && (p_instance->cb.state != NRFX_DRV_STATE_UNINITIALIZED) &&
+                p_instance->cb.handler && p_config);
+
+    nrfx_pwm_control_block_t * p_cb     = &p_instance->cb;
+    nrfx_pwm_stream_cb_t *     p_stream = &p_cb->stream;
+    int err_code;
+
+    if (p_cb->state == NRFX_DRV_STATE_POWERED_ON)
+    {
+        err_code = -EBUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if (!p_config->p_buffer || !p_config->producer || !p_config->p_idle ||
+        (p_config->block_length == 0) || (p_config->block_length > PWM_SEQ_LENGTH_MAX) ||
+        (p_config->p_idle->length == 0) || (p_config->p_idle->length > PWM_SEQ_LENGTH_MAX) ||
+        (p_config->block_count < 2) || (p_config->block_count > 32) ||
+        !nrf_dma_accessible_check(p_instance->p_reg, p_config->p_buffer) ||
+        !nrf_dma_accessible_check(p_instance->p_reg, p_config->p_idle->values.p_raw))
+    {
+        err_code = -EINVAL;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+#if NRF_PWM_HAS_SHORT_LOOPSDONE_SEQSTART
+    p_stream->config       = *p_config;
+    p_stream->ready_mask   = 0;
+    p_stream->busy_mask    = 0;
+    p_stream->underruns    = 0;
+    p_stream->fill_idx     = 0;
+    p_stream->play_idx     = 0;
+    p_stream->seq_block[0] = -1;
+    p_stream->seq_block[1] = -1;
+    p_stream->next_end     = 0;
+    p_stream->active       = true;
+
+    stream_sequence_next(p_instance, 0);
+    stream_sequence_next(p_instance, 1);
+
+    // Sequences are played alternately in an endless loop, the LOOPSDONE event
+    // restarts the playback from sequence 0 through the shortcut.
+    nrfy_pwm_loop_set(p_instance->p_reg, UINT16_MAX);
+    nrfy_pwm_shorts_set(p_instance->p_reg, NRF_PWM_SHORT_LOOPSDONE_SEQSTART0_MASK);
+
+    NRFX_LOG_INFO("Function: %s, block length: %d, block count: %d.",
+                  __func__,
+                  p_config->block_length,
+                  p_config->block_count);
+    (void)start_playback(p_instance, p_cb,
+                         NRFX_PWM_FLAG_SIGNAL_END_SEQ0 |
+                         NRFX_PWM_FLAG_SIGNAL_END_SEQ1 |
+                         NRFX_PWM_FLAG_NO_EVT_FINISHED,
+                         0);
+    return 0;
+#else
+    (void)p_stream;
+    err_code = -EINVAL;
+    NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                     __func__,
+                     NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+#endif
+}
+
+uint32_t nrfx_pwm_stream_underruns_get(nrfx_pwm_t const * p_instance)
+{
+    NRFX_ASSERT(p_instance);
+
+    return p_instance->cb.stream.underruns;
+}
+
 bool nrfx_pwm_stop(nrfx_pwm_t * p_instance, bool wait_until_stopped)
 {
     NRFX_ASSERT(p_instance && (p_instance->cb.state != NRFX_DRV_STATE_UNINITIALIZED));
@@ -493,20 +675,28 @@ void nrfx_pwm_irq_handler(nrfx_pwm_t * p_instance)
                                                 NRFY_EVENT_TO_INT_BITMASK(NRF_PWM_EVENT_LOOPSDONE) |
                                                 NRFY_EVENT_TO_INT_BITMASK(NRF_PWM_EVENT_STOPPED));
 
+    // In the streaming playback the sequence end events are consumed by the driver.
+    if (p_cb->stream.active)
+    {
+        stream_seqend_handle(p_instance, evt_mask);
+    }
     // The user handler is called for SEQEND0 and SEQEND1 events only when the
     // user asks for it (by setting proper flags when starting the playback).
-    if (evt_mask & NRFY_EVENT_TO_INT_BITMASK(NRF_PWM_EVENT_SEQEND0))
+    else
     {
-        if ((p_cb->flags & NRFX_PWM_FLAG_SIGNAL_END_SEQ0) && p_cb->handler)
+        if (evt_mask & NRFY_EVENT_TO_INT_BITMASK(NRF_PWM_EVENT_SEQEND0))
         {
-            p_cb->handler(NRFX_PWM_EVENT_END_SEQ0, p_cb->p_context);
+            if ((p_cb->flags & NRFX_PWM_FLAG_SIGNAL_END_SEQ0) && p_cb->handler)
+            {
+                p_cb->handler(NRFX_PWM_EVENT_END_SEQ0, p_cb->p_context);
+            }
         }
-    }
-    if (evt_mask & NRFY_EVENT_TO_INT_BITMASK(NRF_PWM_EVENT_SEQEND1))
-    {
-        if ((p_cb->flags & NRFX_PWM_FLAG_SIGNAL_END_SEQ1) && p_cb->handler)
+        if (evt_mask & NRFY_EVENT_TO_INT_BITMASK(NRF_PWM_EVENT_SEQEND1))
         {
-            p_cb->handler(NRFX_PWM_EVENT_END_SEQ1, p_cb->p_context);
+            if ((p_cb->flags & NRFX_PWM_FLAG_SIGNAL_END_SEQ1) && p_cb->handler)
+            {
+                p_cb->handler(NRFX_PWM_EVENT_END_SEQ1, p_cb->p_context);
+            }
         }
     }
     // For LOOPSDONE the handler is called by default, but the user can disable
@@ -524,6 +714,7 @@ void nrfx_pwm_irq_handler(nrfx_pwm_t * p_instance)
     {
         nrfy_pwm_disable(p_instance->p_reg);
         p_cb->state = NRFX_DRV_STATE_INITIALIZED;
+        p_cb->stream.active = false;
         if (p_cb->handler)
         {
             p_cb->handler(NRFX_PWM_EVENT_STOPPED, p_cb->p_context);
@@ -35,6 +35,7 @@
 #include <nrfx_qspi.h>
 #include <hal/nrf_clock.h>
 #include <hal/nrf_gpio.h>
+#include <string.h>
 
 #define NRFX_LOG_MODULE QSPI
 #include <nrfx_log.h>
@@ -105,6 +106,40 @@ typedef struct
 
 static qspi_control_block_t m_cb;
 
+/** @brief Maximum length of a single read operation in the request queue mode. */
+#define QSPI_QUEUE_READ_MAX_LEN (QSPI_READ_CNT_CNT_Msk & ~0x3UL)
+
+/** @brief Operations performed by the request queue. */
+typedef enum
+{
+    QSPI_QUEUE_OP_NONE,       /**< No operation in progress. */
+    QSPI_QUEUE_OP_REQ,        /**< Operation on behalf of the request at the head of the queue. */
+    QSPI_QUEUE_OP_CACHE_FILL, /**< Read-ahead buffer fill for the request at the head of the queue. */
+    QSPI_QUEUE_OP_PREFETCH,   /**< Background read-ahead buffer fill. */
+} qspi_queue_op_t;
+
+/** @brief Request queue data. */
+typedef struct
+{
+    nrfx_qspi_req_handler_t handler;    /**< Request completion handler. */
+    void *                  p_context;  /**< Context passed to the completion handler. */
+    nrfx_qspi_req_t *       p_head;     /**< First pending request. */
+    nrfx_qspi_req_t *       p_tail;     /**< Last pending request. */
+    uint8_t *               p_page_buf; /**< Buffer used for coalescing writes. */
+    uint32_t                page_size;  /**< Program page size of the memory device. */
+    uint8_t *               p_cache;    /**< Read-ahead buffer. */
+    uint32_t                cache_size; /**< Size of the read-ahead buffer. */
+    uint32_t                cache_addr; /**< Memory address of data in the read-ahead buffer. */
+    uint32_t                cache_len;  /**< Number of valid bytes in the read-ahead buffer. */
+    uint32_t                next_addr;  /**< Address following the last read request. */
+    uint32_t                op_len;     /**< Number of request bytes handled by the ongoing operation. */
+    qspi_queue_op_t         op;         /**< Operation in progress. */
+    bool                    prefetch;   /**< Flag indicating whether background prefetch is enabled. */
+    bool                    sequential; /**< Flag indicating that the last completed request was a read. */
+} qspi_queue_t;
+
+static qspi_queue_t m_queue;
+
 static int  qspi_activate(bool wait);
 static int  qspi_ready_wait(void);
 static void qspi_workaround_215_43_apply(void);
@@ -734,7 +769,24 @@ void nrfx_qspi_uninit(void)
         qspi_pins_deconfigure();
     }
 
+    // Queue is detached before the handlers are called, so that the driver is left
+    // uninitialized with the request queue mode disabled.
+    nrfx_qspi_req_handler_t handler   = m_queue.handler;
+    void *                  p_context = m_queue.p_context;
+    nrfx_qspi_req_t *       p_req     = m_queue.p_head;
+
+    memset(&m_queue, 0, sizeof(m_queue));
     m_cb.state = NRFX_QSPI_STATE_UNINITIALIZED;
+
+    while (p_req)
+    {
+        nrfx_qspi_req_t * p_next = p_req->p_next;
+
+        p_req->result = -ECANCELED;
+        handler(p_req, p_context);
+        p_req = p_next;
+    }
+
     NRFX_LOG_INFO("Uninitialized.");
 }
 
@@ -776,6 +828,11 @@ int nrfx_qspi_write(void const * p_tx_buffer,
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wcast-qual"
 #endif
+    if (m_queue.handler)
+    {
+        return -EBUSY;
+    }
+
     return qspi_xfer((void *)p_tx_buffer, tx_buffer_length, dst_address, NRFX_QSPI_STATE_WRITE);
 
 #if defined(__GNUC__)
@@ -787,14 +844,16 @@ int nrfx_qspi_read(void *   p_rx_buffer,
                           size_t   rx_buffer_length,
                           uint32_t src_address)
 {
+    if (m_queue.handler)
+    {
+        return -EBUSY;
+    }
+
     return qspi_xfer((void *)p_rx_buffer, rx_buffer_length, src_address, NRFX_QSPI_STATE_READ);
 }
 
-int nrfx_qspi_erase(nrf_qspi_erase_len_t length,
-                           uint32_t             start_address)
+static int qspi_erase(nrf_qspi_erase_len_t length, uint32_t start_address)
 {
-    NRFX_ASSERT(m_cb.state != NRFX_QSPI_STATE_UNINITIALIZED);
-
     if (qspi_errata_159_conditions_check())
     {
         return -EPERM;
@@ -842,6 +901,19 @@ int nrfx_qspi_erase(nrf_qspi_erase_len_t length,
     return 0;
 }
 
+int nrfx_qspi_erase(nrf_qspi_erase_len_t length,
+                           uint32_t             start_address)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_QSPI_STATE_UNINITIALIZED);
+
+    if (m_queue.handler)
+    {
+        return -EBUSY;
+    }
+
+    return qspi_erase(length, start_address);
+}
+
 int nrfx_qspi_chip_erase(void)
 {
     NRFX_ASSERT(m_cb.state != NRFX_QSPI_STATE_UNINITIALIZED);
@@ -911,6 +983,368 @@ int nrfx_qspi_dma_encrypt(nrf_qspi_encryption_t const * p_config)
 }
 #endif
 
+static bool qspi_queue_dma_buffer_check(void const * p_buffer)
+{
+    return nrf_dma_accessible_check(NRF_QSPI, p_buffer) && nrfx_is_word_aligned(p_buffer);
+}
+
+static bool qspi_queue_read_cacheable(nrfx_qspi_req_t const * p_req)
+{
+    return m_queue.p_cache && (((p_req->addr & 0x3UL) + p_req->size) <= m_queue.cache_size);
+}
+
+static bool qspi_queue_cache_hit(uint32_t addr, size_t size)
+{
+    return (m_queue.cache_len != 0) &&
+           (addr >= m_queue.cache_addr) &&
+           ((addr + size) <= (m_queue.cache_addr + m_queue.cache_len));
+}
+
+static void qspi_queue_cache_invalidate(uint32_t addr, uint32_t length)
+{
+    if ((m_queue.cache_len != 0) &&
+        (addr < (m_queue.cache_addr + m_queue.cache_len)) &&
+        (m_queue.cache_addr < (addr + length)))
+    {
+        m_queue.cache_len = 0;
+    }
+}
+
+static int qspi_queue_cache_fill(uint32_t addr, qspi_queue_op_t op)
+{
+    m_queue.cache_addr = addr & ~0x3UL;
+    m_queue.cache_len  = 0;
+    m_queue.op         = op;
+
+    return qspi_xfer(m_queue.p_cache, m_queue.cache_size, m_queue.cache_addr,
+                     NRFX_QSPI_STATE_READ);
+}
+
+static void qspi_queue_req_complete(int result)
+{
+    nrfx_qspi_req_t * p_req = m_queue.p_head;
+
+    m_queue.p_head = p_req->p_next;
+    if (!m_queue.p_head)
+    {
+        m_queue.p_tail = NULL;
+    }
+
+    m_queue.sequential = (p_req->type == NRFX_QSPI_REQ_READ);
+    if (m_queue.sequential)
+    {
+        m_queue.next_addr = p_req->addr + p_req->size;
+    }
+
+    p_req->result = result;
+    m_queue.handler(p_req, m_queue.p_context);
+}
+
+static int qspi_queue_read_start(nrfx_qspi_req_t * p_req)
+{
+    if (qspi_queue_read_cacheable(p_req))
+    {
+        if (qspi_queue_cache_hit(p_req->addr, p_req->size))
+        {
+            memcpy(p_req->p_buffer,
+                   &m_queue.p_cache[p_req->addr - m_queue.cache_addr],
+                   p_req->size);
+            qspi_queue_req_complete(0);
+            return 0;
+        }
+
+        return qspi_queue_cache_fill(p_req->addr, QSPI_QUEUE_OP_CACHE_FILL);
+    }
+
+    size_t length = NRFX_MIN(p_req->size - p_req->offset, QSPI_QUEUE_READ_MAX_LEN);
+
+    m_queue.op     = QSPI_QUEUE_OP_REQ;
+    m_queue.op_len = length;
+    return qspi_xfer((uint8_t *)p_req->p_buffer + p_req->offset,
+                     length,
+                     p_req->addr + p_req->offset,
+                     NRFX_QSPI_STATE_READ);
+}
+
+static int qspi_queue_write_start(nrfx_qspi_req_t * p_req)
+{
+    uint8_t * p_src     = (uint8_t *)p_req->p_buffer + p_req->offset;
+    uint32_t  addr      = p_req->addr + p_req->offset;
+    uint32_t  page_left = m_queue.page_size - (addr % m_queue.page_size);
+    uint32_t  length    = NRFX_MIN(p_req->size - p_req->offset, page_left);
+
+    if (m_queue.p_page_buf &&
+        ((length < page_left) || !qspi_queue_dma_buffer_check(p_src)))
+    {
+        // Gather data of the following write requests that continue in the same page,
+        // so that the whole page is programmed with a single operation.
+        memcpy(m_queue.p_page_buf, p_src, length);
+
+        nrfx_qspi_req_t * p_next = p_req->p_next;
+        while (p_next &&
+               (p_next->type == NRFX_QSPI_REQ_WRITE) &&
+               (p_next->addr == (addr + length)) &&
+               (length < page_left))
+        {
+            uint32_t chunk = NRFX_MIN(p_next->size, page_left - length);
+
+            memcpy(&m_queue.p_page_buf[length], p_next->p_buffer, chunk);
+            length += chunk;
+            p_next = p_next->p_next;
+        }
+
+        p_src = m_queue.p_page_buf;
+    }
+
+    qspi_queue_cache_invalidate(addr, length);
+
+    m_queue.op     = QSPI_QUEUE_OP_REQ;
+    m_queue.op_len = length;
+    return qspi_xfer(p_src, length, addr, NRFX_QSPI_STATE_WRITE);
+}
+
+static int qspi_queue_erase_start(nrfx_qspi_req_t * p_req)
+{
+    switch (p_req->erase_len)
+    {
+        case NRF_QSPI_ERASE_LEN_4KB:
+            qspi_queue_cache_invalidate(p_req->addr & ~0xFFFUL, 0x1000UL);
+            break;
+        case NRF_QSPI_ERASE_LEN_64KB:
+            qspi_queue_cache_invalidate(p_req->addr & ~0xFFFFUL, 0x10000UL);
+            break;
+        default:
+            m_queue.cache_len = 0;
+            break;
+    }
+
+    m_queue.op     = QSPI_QUEUE_OP_REQ;
+    m_queue.op_len = 0;
+    return qspi_erase(p_req->erase_len, p_req->addr);
+}
+
+static void qspi_queue_process(void)
+{
+    while (m_queue.p_head && (m_queue.op == QSPI_QUEUE_OP_NONE))
+    {
+        nrfx_qspi_req_t * p_req = m_queue.p_head;
+        int err_code;
+
+        switch (p_req->type)
+        {
+            case NRFX_QSPI_REQ_READ:
+                err_code = qspi_queue_read_start(p_req);
+                break;
+            case NRFX_QSPI_REQ_WRITE:
+                err_code = qspi_queue_write_start(p_req);
+                break;
+            default:
+                err_code = qspi_queue_erase_start(p_req);
+                break;
+        }
+
+        if (err_code != 0)
+        {
+            m_queue.op = QSPI_QUEUE_OP_NONE;
+            qspi_queue_req_complete(err_code);
+        }
+    }
+
+    if (!m_queue.p_head &&
+        (m_queue.op == QSPI_QUEUE_OP_NONE) &&
+        m_queue.prefetch &&
+        m_queue.sequential &&
+        !qspi_queue_cache_hit(m_queue.next_addr, sizeof(uint32_t)))
+    {
+        if (qspi_queue_cache_fill(m_queue.next_addr, QSPI_QUEUE_OP_PREFETCH) != 0)
+        {
+            m_queue.op = QSPI_QUEUE_OP_NONE;
+        }
+    }
+}
+
+static void qspi_queue_op_done(int result)
+{
+    qspi_queue_op_t op = m_queue.op;
+
+    m_queue.op = QSPI_QUEUE_OP_NONE;
+
+    if (op == QSPI_QUEUE_OP_NONE)
+    {
+        // READY event of an operation not started by the queue, for example of a custom
+        // instruction transfer.
+    }
+    else if (result != 0)
+    {
+        // Failed operation fails only the request at the head of the queue. Data of requests
+        // gathered into the same write is programmed again by their own operations.
+        if (op != QSPI_QUEUE_OP_PREFETCH)
+        {
+            qspi_queue_req_complete(result);
+        }
+    }
+    else if (op == QSPI_QUEUE_OP_REQ)
+    {
+        if (m_queue.p_head->type == NRFX_QSPI_REQ_ERASE)
+        {
+            qspi_queue_req_complete(0);
+        }
+
+        // Account for the data of all requests covered by the finished operation.
+        uint32_t length = m_queue.op_len;
+        while (length)
+        {
+            nrfx_qspi_req_t * p_req = m_queue.p_head;
+            uint32_t chunk = NRFX_MIN(p_req->size - p_req->offset, length);
+
+            p_req->offset += chunk;
+            length        -= chunk;
+            if (p_req->offset == p_req->size)
+            {
+                qspi_queue_req_complete(0);
+            }
+        }
+    }
+    else
+    {
+        m_queue.cache_len = m_queue.cache_size;
+    }
+
+    qspi_queue_process();
+}
+
+int nrfx_qspi_queue_init(nrfx_qspi_queue_config_t const * p_config,
+                         nrfx_qspi_req_handler_t          handler,
+                         void *                           p_context)
+{
+    NRFX_ASSERT((m_cb.state != NRFX_QSPI_STATE_UNINITIALIZED) && m_cb.handler);
+    NRFX_ASSERT(p_config && handler);
+
+    if (m_cb.state != NRFX_QSPI_STATE_IDLE || m_queue.handler)
+    {
+        return -EBUSY;
+    }
+
+    if ((p_config->page_size == 0) || (p_config->page_size & 0x3UL) ||
+        (p_config->p_cache && ((p_config->cache_size == 0) || (p_config->cache_size & 0x3UL))))
+    {
+        return -EINVAL;
+    }
+
+    if ((p_config->p_page_buf && !qspi_queue_dma_buffer_check(p_config->p_page_buf)) ||
+        (p_config->p_cache && !qspi_queue_dma_buffer_check(p_config->p_cache)))
+    {
+        return -EACCES;
+    }
+
+    m_queue = (qspi_queue_t){
+        .p_context  = p_context,
+        .p_page_buf = (uint8_t *)p_config->p_page_buf,
+        .page_size  = p_config->page_size,
+        .p_cache    = (uint8_t *)p_config->p_cache,
+        .cache_size = p_config->p_cache ? p_config->cache_size : 0,
+        .prefetch   = p_config->p_cache ? p_config->prefetch : false,
+        .op         = QSPI_QUEUE_OP_NONE,
+    };
+    m_queue.handler = handler;
+
+    return 0;
+}
+
+int nrfx_qspi_queue_submit(nrfx_qspi_req_t * p_req)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_QSPI_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_req);
+
+    if (!m_queue.handler)
+    {
+        return -EPERM;
+    }
+
+    switch (p_req->type)
+    {
+        case NRFX_QSPI_REQ_READ:
+            if (!p_req->p_buffer || (p_req->size == 0))
+            {
+                return -EINVAL;
+            }
+            if (!qspi_queue_read_cacheable(p_req) &&
+                (!qspi_queue_dma_buffer_check(p_req->p_buffer) ||
+                 !nrfx_is_word_aligned((void const *)p_req->addr) ||
+                 (p_req->size & 0x3UL)))
+            {
+                return -EACCES;
+            }
+            break;
+
+        case NRFX_QSPI_REQ_WRITE:
+            if (!p_req->p_buffer || (p_req->size == 0) || (p_req->size & 0x3UL))
+            {
+                return -EINVAL;
+            }
+            if (!nrfx_is_word_aligned((void const *)p_req->addr) ||
+                (!m_queue.p_page_buf && !qspi_queue_dma_buffer_check(p_req->p_buffer)))
+            {
+                return -EACCES;
+            }
+            break;
+
+        case NRFX_QSPI_REQ_ERASE:
+            if (!nrfx_is_word_aligned((void const *)p_req->addr))
+            {
+                return -EACCES;
+            }
+            break;
+
+        default:
+            return -EINVAL;
+    }
+
+    p_req->p_next = NULL;
+    p_req->offset = 0;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (m_queue.p_tail)
+    {
+        m_queue.p_tail->p_next = p_req;
+    }
+    else
+    {
+        m_queue.p_head = p_req;
+    }
+    m_queue.p_tail = p_req;
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    // Requests are always processed in the interrupt context. If no operation is in progress,
+    // pend the interrupt to kick the processing.
+    if (m_queue.op == QSPI_QUEUE_OP_NONE)
+    {
+        NRFX_IRQ_PENDING_SET(QSPI_IRQn);
+    }
+
+    return 0;
+}
+
+bool nrfx_qspi_queue_pending_check(void)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_QSPI_STATE_UNINITIALIZED);
+
+    return m_queue.p_head != NULL;
+}
+
+int nrfx_qspi_queue_uninit(void)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_QSPI_STATE_UNINITIALIZED);
+
+    if (m_queue.p_head || (m_queue.op != QSPI_QUEUE_OP_NONE))
+    {
+        return -EBUSY;
+    }
+
+    m_queue.handler = NULL;
+    return 0;
+}
+
 static void qspi_event_xfer_handle(nrfx_qspi_evt_ext_xfer_t * p_xfer)
 {
     p_xfer->p_buffer = (uint8_t *)m_cb.p_buffer_primary;
@@ -1001,6 +1435,13 @@ void nrfx_qspi_irq_handler(void)
             m_cb.state = NRFX_QSPI_STATE_IDLE;
         }
 
+        if (m_queue.handler)
+        {
+            m_cb.evt_ext.type = NRFX_QSPI_EVENT_NONE;
+            qspi_queue_op_done(m_cb.timeout_signal ? -ETIMEDOUT : 0);
+            return;
+        }
+
         if (!m_cb.timeout_signal)
         {
             m_cb.handler(NRFX_QSPI_EVENT_DONE, m_cb.p_context);
@@ -1008,4 +1449,8 @@ void nrfx_qspi_irq_handler(void)
 
         m_cb.evt_ext.type = NRFX_QSPI_EVENT_NONE;
     }
+    else if (m_queue.handler)
+    {
+        qspi_queue_process();
+    }
 }
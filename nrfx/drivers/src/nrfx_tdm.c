@@ -301,6 +301,42 @@ static int tdm_verify_buffers(nrfx_tdm_buffers_t const * p_buffers,
     return 0;
 }
 
+static void transfer_start(nrfx_tdm_t *               p_instance,
+                           nrfx_tdm_buffers_t const * p_initial_buffers)
+{
+    nrfx_tdm_control_block_t * p_cb = &p_instance->cb;
+
+    p_cb->use_rx = (p_initial_buffers->p_rx_buffer != NULL);
+    p_cb->use_tx = (p_initial_buffers->p_tx_buffer != NULL);
+    p_cb->rx_ready       = false;
+    p_cb->tx_ready       = false;
+    p_cb->buffers_needed = false;
+    p_cb->buffers_reused = false;
+
+    p_cb->next_buffers = *p_initial_buffers;
+    p_cb->current_buffers.p_rx_buffer = NULL;
+    p_cb->current_buffers.p_tx_buffer = NULL;
+
+    p_cb->state = NRFX_DRV_STATE_POWERED_ON;
+
+    nrf_tdm_int_enable(p_instance->p_reg,
+                      (p_cb->use_rx ? NRF_TDM_INT_RXPTRUPD_MASK_MASK : 0) |
+                      (p_cb->use_tx ? NRF_TDM_INT_TXPTRUPD_MASK_MASK : 0) |
+                       NRF_TDM_INT_STOPPED_MASK_MASK |
+                       NRF_TDM_INT_ABORTED_MASK);
+
+    tdm_buffers_set(p_instance, p_initial_buffers);
+
+    nrf_tdm_transfer_direction_set(p_instance->p_reg,
+                                   p_cb->use_rx ? (p_cb->use_tx ? NRF_TDM_RXTXEN_DUPLEX
+                                                                : NRF_TDM_RXTXEN_RX)
+                                                                : NRF_TDM_RXTXEN_TX);
+
+    nrf_tdm_enable(p_instance->p_reg);
+
+    nrf_tdm_task_trigger(p_instance->p_reg, NRF_TDM_TASK_START);
+}
+
 int nrfx_tdm_start(nrfx_tdm_t *               p_instance,
                    nrfx_tdm_buffers_t const * p_initial_buffers)
 {
@@ -338,35 +374,8 @@ int nrfx_tdm_start(nrfx_tdm_t *               p_instance,
         return err_code;
     }
 
-    p_cb->use_rx = use_rx;
-    p_cb->use_tx = use_tx;
-    p_cb->rx_ready       = false;
-    p_cb->tx_ready       = false;
-    p_cb->buffers_needed = false;
-    p_cb->buffers_reused = false;
-
-    p_cb->next_buffers = *p_initial_buffers;
-    p_cb->current_buffers.p_rx_buffer = NULL;
-    p_cb->current_buffers.p_tx_buffer = NULL;
-
-    p_cb->state = NRFX_DRV_STATE_POWERED_ON;
-
-    nrf_tdm_int_enable(p_instance->p_reg,
-                      (p_cb->use_rx ? NRF_TDM_INT_RXPTRUPD_MASK_MASK : 0) |
-                      (p_cb->use_tx ? NRF_TDM_INT_TXPTRUPD_MASK_MASK : 0) |
-                       NRF_TDM_INT_STOPPED_MASK_MASK |
-                       NRF_TDM_INT_ABORTED_MASK);
-
-    tdm_buffers_set(p_instance, p_initial_buffers);
-
-    nrf_tdm_transfer_direction_set(p_instance->p_reg,
-                                   p_cb->use_rx ? (p_cb->use_tx ? NRF_TDM_RXTXEN_DUPLEX
-                                                                : NRF_TDM_RXTXEN_RX)
-                                                                : NRF_TDM_RXTXEN_TX);
-
-    nrf_tdm_enable(p_instance->p_reg);
-
-    nrf_tdm_task_trigger(p_instance->p_reg, NRF_TDM_TASK_START);
+    p_cb->p_ring = NULL;
+    transfer_start(p_instance, p_initial_buffers);
 
     return 0;
 }
@@ -388,6 +397,15 @@ int nrfx_tdm_next_buffers_set(nrfx_tdm_t *               p_instance,
         return err_code;
     }
 
+    if (p_cb->p_ring != NULL)
+    {
+        err_code = -EPERM;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
     err_code = tdm_verify_buffers(p_buffers,
                                   p_instance->p_reg,
                                   p_cb->use_rx, p_cb->use_tx);
@@ -408,6 +426,169 @@ int nrfx_tdm_next_buffers_set(nrfx_tdm_t *               p_instance,
     return 0;
 }
 
+static void ring_next_buffers_set(nrfx_tdm_t * p_instance)
+{
+    nrfx_tdm_control_block_t * p_cb = &p_instance->cb;
+
+    if (!p_cb->buffers_needed || (p_cb->ring_queued == 0))
+    {
+        return;
+    }
+
+    p_cb->next_buffers = p_cb->p_ring[p_cb->ring_idx];
+    tdm_buffers_set(p_instance, &p_cb->next_buffers);
+
+    p_cb->ring_idx = (uint8_t)((p_cb->ring_idx + 1) % p_cb->ring_size);
+    p_cb->ring_queued--;
+    p_cb->buffers_needed = false;
+}
+
+static void ring_buffers_process(nrfx_tdm_t *               p_instance,
+                                 nrfx_tdm_buffers_t const * p_released)
+{
+    nrfx_tdm_control_block_t * p_cb = &p_instance->cb;
+
+    if (p_released == NULL)
+    {
+        // The peripheral had to start processing the current buffers again,
+        // because no buffer was queued in time.
+        if (p_cb->use_tx)
+        {
+            p_cb->ring_stats.underrun_count++;
+        }
+        if (p_cb->use_rx)
+        {
+            p_cb->ring_stats.overrun_count++;
+        }
+        ring_next_buffers_set(p_instance);
+        return;
+    }
+
+    ring_next_buffers_set(p_instance);
+
+    if ((p_released->p_rx_buffer != NULL) || (p_released->p_tx_buffer != NULL))
+    {
+        p_cb->ring_held++;
+        p_cb->handler(p_released, NRFX_TDM_STATUS_BUFFER_RELEASED);
+    }
+}
+
+int nrfx_tdm_ring_start(nrfx_tdm_t *               p_instance,
+                        nrfx_tdm_buffers_t const * p_ring,
+                        uint8_t                    count)
+{
+    NRFX_ASSERT(p_instance && p_ring);
+
+    nrfx_tdm_control_block_t * p_cb = &p_instance->cb;
+    int err_code;
+
+    if (p_cb->state != NRFX_DRV_STATE_INITIALIZED)
+    {
+        err_code = (p_cb->state == NRFX_DRV_STATE_UNINITIALIZED) ? -EINPROGRESS : -EALREADY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    bool use_rx = (p_ring[0].p_rx_buffer != NULL);
+    bool use_tx = (p_ring[0].p_tx_buffer != NULL);
+
+    err_code = ((count < 2) || (!use_rx && !use_tx)) ? -EINVAL : 0;
+
+    for (uint8_t i = 0; (i < count) && (err_code == 0); i++)
+    {
+        if ((!use_rx && (p_ring[i].p_rx_buffer != NULL)) ||
+            (!use_tx && (p_ring[i].p_tx_buffer != NULL)) ||
+            (p_ring[i].rx_buffer_size != p_ring[0].rx_buffer_size) ||
+            (p_ring[i].tx_buffer_size != p_ring[0].tx_buffer_size) ||
+            (use_rx && use_tx && (p_ring[i].rx_buffer_size != p_ring[i].tx_buffer_size)))
+        {
+            err_code = -EINVAL;
+        }
+        else
+        {
+            err_code = tdm_verify_buffers(&p_ring[i], p_instance->p_reg, use_rx, use_tx);
+        }
+    }
+
+    if (err_code < 0)
+    {
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_cb->p_ring      = p_ring;
+    p_cb->ring_size   = count;
+    p_cb->ring_idx    = 1;
+    p_cb->ring_queued = (uint8_t)(count - 1);
+    p_cb->ring_held   = 0;
+    p_cb->ring_stats  = (nrfx_tdm_ring_stats_t){ 0 };
+
+    transfer_start(p_instance, &p_ring[0]);
+
+    return 0;
+}
+
+int nrfx_tdm_ring_buffer_return(nrfx_tdm_t * p_instance)
+{
+    NRFX_ASSERT(p_instance);
+
+    nrfx_tdm_control_block_t * p_cb = &p_instance->cb;
+    int err_code = 0;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+
+    if ((p_cb->p_ring == NULL) || (p_cb->state != NRFX_DRV_STATE_POWERED_ON))
+    {
+        err_code = -EPERM;
+    }
+    else if (p_cb->ring_held == 0)
+    {
+        err_code = -EINVAL;
+    }
+    else
+    {
+        p_cb->ring_held--;
+        p_cb->ring_queued++;
+        ring_next_buffers_set(p_instance);
+    }
+
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if (err_code < 0)
+    {
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+    }
+    return err_code;
+}
+
+uint8_t nrfx_tdm_ring_fill_level_get(nrfx_tdm_t const * p_instance)
+{
+    NRFX_ASSERT(p_instance);
+
+    nrfx_tdm_control_block_t const * p_cb = &p_instance->cb;
+
+    if ((p_cb->p_ring == NULL) || (p_cb->state != NRFX_DRV_STATE_POWERED_ON))
+    {
+        return 0;
+    }
+
+    return (uint8_t)(p_cb->ring_queued + (p_cb->buffers_needed ? 0 : 1));
+}
+
+void nrfx_tdm_ring_stats_get(nrfx_tdm_t const *      p_instance,
+                             nrfx_tdm_ring_stats_t * p_stats)
+{
+    NRFX_ASSERT(p_instance && p_stats);
+
+    *p_stats = p_instance->cb.ring_stats;
+}
+
 void nrfx_tdm_stop(nrfx_tdm_t * p_instance, bool abort)
 {
     NRFX_ASSERT(p_instance);
@@ -416,6 +597,7 @@ void nrfx_tdm_stop(nrfx_tdm_t * p_instance, bool abort)
 
     p_cb->buffers_needed = false;
     p_cb->buffers_reused = false;
+    p_cb->p_ring = NULL;
     p_cb->state = NRFX_DRV_STATE_INITIALIZED;
 
     nrf_tdm_int_disable(p_instance->p_reg, NRF_TDM_INT_RXPTRUPD_MASK_MASK |
@@ -540,7 +722,14 @@ void nrfx_tdm_irq_handler(nrfx_tdm_t * p_instance)
         {
             p_cb->buffers_reused = false;
             p_cb->buffers_needed = true;
-            p_cb->handler(NULL, NRFX_TDM_STATUS_NEXT_BUFFERS_NEEDED);
+            if (p_cb->p_ring != NULL)
+            {
+                ring_buffers_process(p_instance, NULL);
+            }
+            else
+            {
+                p_cb->handler(NULL, NRFX_TDM_STATUS_NEXT_BUFFERS_NEEDED);
+            }
         }
         else
         {
@@ -551,7 +740,14 @@ void nrfx_tdm_irq_handler(nrfx_tdm_t * p_instance)
             p_cb->next_buffers.p_tx_buffer = NULL;
             p_cb->next_buffers.tx_buffer_size = 0;
             p_cb->buffers_needed = true;
-            p_cb->handler(&released_buffers, NRFX_TDM_STATUS_NEXT_BUFFERS_NEEDED);
+            if (p_cb->p_ring != NULL)
+            {
+                ring_buffers_process(p_instance, &released_buffers);
+            }
+            else
+            {
+                p_cb->handler(&released_buffers, NRFX_TDM_STATUS_NEXT_BUFFERS_NEEDED);
+            }
         }
     }
 }
@@ -424,6 +424,7 @@ void nrfx_twim_disable(nrfx_twim_t * p_instance)
     NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
 
     p_cb->int_mask = 0;
+    p_cb->p_cmd_list = NULL;
     nrfy_twim_stop(p_instance->p_twim);
     p_cb->state = NRFX_DRV_STATE_INITIALIZED;
     p_cb->busy = false;
@@ -684,6 +685,109 @@ int nrfx_twim_xfer(nrfx_twim_t                 * p_instance,
     return twim_xfer(p_cb, p_instance->p_twim, p_xfer_desc, flags);
 }
 
+int nrfx_twim_cmd_list_xfer(nrfx_twim_t *                 p_instance,
+                            nrfx_twim_xfer_desc_t const * p_cmd_list,
+                            size_t                        count,
+                            uint32_t                      flags)
+{
+    NRFX_ASSERT(p_instance && p_cmd_list && count);
+
+    nrfx_twim_control_block_t * p_cb = &p_instance->cb;
+    int err_code;
+
+    NRFX_ASSERT(p_cb->state == NRFX_DRV_STATE_POWERED_ON);
+    NRFX_ASSERT(p_cb->handler);
+
+    if ((flags & ~(NRFX_TWIM_FLAG_HOLD_XFER | NRFX_TWIM_FLAG_REPEATED_XFER)) ||
+        ((flags & NRFX_TWIM_FLAG_REPEATED_XFER) && !(flags & NRFX_TWIM_FLAG_HOLD_XFER)))
+    {
+        err_code = -ENOTSUP;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    // Validate the whole list up front, so that no transfer of the list is rejected
+    // later on in the interrupt context.
+    for (size_t i = 0; i < count; i++)
+    {
+        nrfx_twim_xfer_desc_t const * p_desc = &p_cmd_list[i];
+
+        if (p_desc->type == NRFX_TWIM_XFER_TXTX)
+        {
+            err_code = -ENOTSUP;
+            NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                             __func__,
+                             NRFX_LOG_ERROR_STRING_GET(err_code));
+            return err_code;
+        }
+
+        if ((p_desc->primary_length != 0 &&
+             !nrf_dma_accessible_check(p_instance->p_twim, p_desc->p_primary_buf)) ||
+            (p_desc->type == NRFX_TWIM_XFER_TXRX &&
+             !nrf_dma_accessible_check(p_instance->p_twim, p_desc->p_secondary_buf)))
+        {
+            err_code = -EACCES;
+            NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                             __func__,
+                             NRFX_LOG_ERROR_STRING_GET(err_code));
+            return err_code;
+        }
+    }
+
+    if (p_cb->busy)
+    {
+        err_code = -EBUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    NRFX_LOG_INFO("Command list with %u transfers.", (uint32_t)count);
+
+    p_cb->p_cmd_list = p_cmd_list;
+    p_cb->cmd_count  = count;
+    p_cb->cmd_idx    = 0;
+    p_cb->cmd_flags  = flags;
+
+    err_code = twim_xfer(p_cb, p_instance->p_twim, &p_cmd_list[0],
+                         flags & NRFX_TWIM_FLAG_HOLD_XFER);
+    if (err_code != 0)
+    {
+        p_cb->p_cmd_list = NULL;
+    }
+    return err_code;
+}
+
+static bool cmd_list_next(nrfx_twim_t * p_instance)
+{
+    nrfx_twim_control_block_t * p_cb = &p_instance->cb;
+    uint32_t flags = 0;
+
+    if (++p_cb->cmd_idx == p_cb->cmd_count)
+    {
+        if (!(p_cb->cmd_flags & NRFX_TWIM_FLAG_REPEATED_XFER))
+        {
+            return false;
+        }
+        // Rearm the first transfer of the list to be triggered externally.
+        p_cb->cmd_idx = 0;
+        flags = NRFX_TWIM_FLAG_HOLD_XFER;
+    }
+
+    p_cb->busy = false;
+    if (twim_xfer(p_cb, p_instance->p_twim, &p_cb->p_cmd_list[p_cb->cmd_idx], flags) != 0)
+    {
+        // The list is validated when it is submitted, so this is not expected to happen.
+        // Stop the list and report the failure to the application.
+        p_cb->error = true;
+        return false;
+    }
+    return (flags == 0);
+}
+
 uint32_t nrfx_twim_start_task_address_get(nrfx_twim_t const *   p_instance,
                                           nrfx_twim_xfer_type_t xfer_type)
 {
@@ -891,7 +995,37 @@ void nrfx_twim_irq_handler(nrfx_twim_t * p_instance)
         NRFX_LOG_DEBUG("Event: %s.", EVT_TO_STR(NRFX_TWIM_EVT_DONE));
     }
 
-    if (!p_cb->repeated)
+    event.cmd_idx = p_cb->cmd_idx;
+
+    if (p_cb->p_cmd_list)
+    {
+        if (event.type == NRFX_TWIM_EVT_DONE)
+        {
+            if (cmd_list_next(p_instance))
+            {
+                // Next transfer from the command list is in progress.
+                return;
+            }
+            if (p_cb->error)
+            {
+                // Next transfer from the command list could not be started.
+                event.type       = NRFX_TWIM_EVT_BUS_ERROR;
+                event.cmd_idx    = p_cb->cmd_idx;
+                p_cb->p_cmd_list = NULL;
+                NRFX_LOG_DEBUG("Event: %s.", EVT_TO_STR(NRFX_TWIM_EVT_BUS_ERROR));
+            }
+            else if (!(p_cb->cmd_flags & NRFX_TWIM_FLAG_REPEATED_XFER))
+            {
+                p_cb->p_cmd_list = NULL;
+            }
+        }
+        else
+        {
+            p_cb->p_cmd_list = NULL;
+        }
+    }
+
+    if (!p_cb->repeated && !p_cb->p_cmd_list)
     {
         p_cb->busy = false;
     }
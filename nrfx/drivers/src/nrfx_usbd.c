@@ -59,6 +59,27 @@
 #define NRFX_USBD_CONFIG_ISO_IN_ZLP  0
 #endif
 
+#ifndef NRFX_USBD_CONFIG_DMASCHEDULER_MODE
+/*
+ * Order of the DMA transfers of endpoints with the same priority:
+ * 0 - prioritized (lowest endpoint first), 1 - round robin.
+ */
+#define NRFX_USBD_CONFIG_DMASCHEDULER_MODE 0
+#endif
+
+#ifndef NRFX_USBD_DMA_TIMESTAMP_GET
+/*
+ * Timestamp used for the DMA wait time statistics.
+ * By default, the DWT cycle counter is used where available. The counter must be enabled
+ * by the application. Without the counter, wait times in the statistics are zero.
+ */
+#if defined(DWT_CTRL_CYCCNTENA_Msk)
+#define NRFX_USBD_DMA_TIMESTAMP_GET() (DWT->CYCCNT)
+#else
+#define NRFX_USBD_DMA_TIMESTAMP_GET() 0UL
+#endif
+#endif
+
 #ifndef NRFX_USBD_ISO_DEBUG
 /* Also generate information about ISOCHRONOUS events and transfers.
  * Turn this off if no ISOCHRONOUS transfers are going to be debugged and this
@@ -271,6 +292,43 @@ static bool m_dma_pending;
  */
 static uint8_t m_dma_odd;
 
+/**
+ * @brief Mark endpoints with high DMA priority.
+ *
+ * Endpoints are served by the DMA scheduler after isochronous ones
+ * and before the other endpoints.
+ */
+static uint32_t m_ep_dma_prio;
+
+/** @brief Classes of endpoints served in turn by the DMA scheduler. */
+typedef enum
+{
+    USBD_DMA_CLASS_ISO,    ///< Isochronous endpoints, with the ISO boost enabled.
+    USBD_DMA_CLASS_PRIO,   ///< Endpoints with the high DMA priority.
+    USBD_DMA_CLASS_NORMAL, ///< Other endpoints.
+    USBD_DMA_CLASS_COUNT
+} usbd_dma_class_t;
+
+/**
+ * @brief Bit position of the endpoint served last by the DMA scheduler, for each class.
+ *
+ * Used in the round robin mode. Each class keeps its own position, so that serving
+ * an endpoint of one class does not change the order of the other classes.
+ */
+static uint8_t m_dma_last_pos[USBD_DMA_CLASS_COUNT];
+
+#if NRFX_CHECK(NRFX_USBD_CONFIG_DMA_STATS_ENABLED)
+/**
+ * @brief Timestamps of the endpoints becoming ready for the DMA transfer.
+ */
+static uint32_t m_ep_dma_ts[NRFX_USBD_EPOUT_BITPOS_0 + NRF_USBD_EPOUT_CNT];
+
+/**
+ * @brief DMA statistics of the endpoints.
+ */
+static nrfx_usbd_ep_dma_stats_t m_ep_dma_stats[NRFX_USBD_EPOUT_BITPOS_0 + NRF_USBD_EPOUT_CNT];
+#endif
+
 #if NRF_ERRATA_STATIC_CHECK(52, 223)
 /**
  * @brief First time enabling after reset. Used in nRF52 errata 223.
@@ -709,6 +767,50 @@ static inline nrfx_usbd_ep_t bit2ep(uint8_t bitpos)
         NRF_USBD_EPOUT(bitpos - NRFX_USBD_EPOUT_BITPOS_0) : NRF_USBD_EPIN(bitpos));
 }
 
+/**
+ * @brief Mark the start of waiting for the DMA transfer.
+ *
+ * @param mask Bit mask of the endpoints which became ready for the transfer.
+ */
+static inline void usbd_dma_wait_start(uint32_t mask)
+{
+#if NRFX_CHECK(NRFX_USBD_CONFIG_DMA_STATS_ENABLED)
+    uint32_t ts = NRFX_USBD_DMA_TIMESTAMP_GET();
+
+    while (mask)
+    {
+        uint8_t pos = (uint8_t)NRF_CTZ(mask);
+
+        mask &= ~(1U << pos);
+        m_ep_dma_ts[pos] = ts;
+    }
+#else
+    (void)mask;
+#endif
+}
+
+/**
+ * @brief Update the DMA statistics of the endpoint when its transfer starts.
+ *
+ * @param pos Bit position of the endpoint.
+ */
+static inline void usbd_dma_wait_end(uint8_t pos)
+{
+#if NRFX_CHECK(NRFX_USBD_CONFIG_DMA_STATS_ENABLED)
+    uint32_t wait = NRFX_USBD_DMA_TIMESTAMP_GET() - m_ep_dma_ts[pos];
+    nrfx_usbd_ep_dma_stats_t * p_stats = &m_ep_dma_stats[pos];
+
+    p_stats->transfers++;
+    p_stats->wait_total += wait;
+    if (wait > p_stats->wait_max)
+    {
+        p_stats->wait_max = wait;
+    }
+#else
+    (void)pos;
+#endif
+}
+
 /**
  * @brief Mark that EasyDMA is working.
  *
@@ -1131,6 +1233,7 @@ static void ev_sof_handler(void)
         iso_ready_mask |= (1U << ep2bit(NRFX_USBD_EPOUT8));
     }
     m_ep_ready |= iso_ready_mask;
+    usbd_dma_wait_start(iso_ready_mask);
 
     m_event_handler(&evt);
 }
@@ -1147,6 +1250,7 @@ static void usbd_ep_data_handler(nrfx_usbd_ep_t ep, uint8_t bitpos)
     NRFX_LOG_DEBUG("USBD event: EndpointData: %x", ep);
     /* Mark endpoint ready for next DMA access */
     m_ep_ready |= (1U << bitpos);
+    usbd_dma_wait_start(1U << bitpos);
 
     if (NRF_USBD_EPIN_CHECK(ep))
     {
@@ -1304,16 +1408,27 @@ static void ev_epdata_handler(void)
  * Function that realizes algorithm to schedule right channel for EasyDMA transfer.
  * It gets a variable with flags for the endpoints currently requiring transfer.
  *
- * @param[in] req Bit flags for channels currently requiring transfer.
- *                Bits 0...8 used for IN endpoints.
- *                Bits 16...24 used for OUT endpoints.
+ * @param[in] req       Bit flags for channels currently requiring transfer.
+ *                      Bits 0...8 used for IN endpoints.
+ *                      Bits 16...24 used for OUT endpoints.
+ * @param[in] dma_class Class of the endpoints in @p req.
  * @note
  * This function would be never called with 0 as a @c req argument.
  * @return The bit number of the endpoint that should be processed now.
  */
-static uint8_t usbd_dma_scheduler_algorithm(uint32_t req)
+static uint8_t usbd_dma_scheduler_algorithm(uint32_t req, usbd_dma_class_t dma_class)
 {
-    /* Only prioritized scheduling mode is supported. */
+    if (NRFX_USBD_CONFIG_DMASCHEDULER_MODE == 1)
+    {
+        /* Round robin - take the first endpoint after the one of the class served last. */
+        uint32_t req_next = req & ~((2UL << m_dma_last_pos[dma_class]) - 1UL);
+
+        m_dma_last_pos[dma_class] = (uint8_t)NRF_CTZ((req_next != 0) ? req_next : req);
+        return m_dma_last_pos[dma_class];
+    }
+
+    /* Prioritized - take the endpoint with the lowest bit position. */
+    (void)dma_class;
     return (uint8_t)NRF_CTZ(req);
 }
 
@@ -1356,11 +1471,16 @@ static void usbd_dmareq_process(void)
             uint8_t pos;
             if (NRFX_USBD_CONFIG_DMASCHEDULER_ISO_BOOST && ((req & USBD_EPISO_BIT_MASK) != 0))
             {
-                pos = usbd_dma_scheduler_algorithm(req & USBD_EPISO_BIT_MASK);
+                pos = usbd_dma_scheduler_algorithm(req & USBD_EPISO_BIT_MASK,
+                                                   USBD_DMA_CLASS_ISO);
+            }
+            else if ((req & m_ep_dma_prio) != 0)
+            {
+                pos = usbd_dma_scheduler_algorithm(req & m_ep_dma_prio, USBD_DMA_CLASS_PRIO);
             }
             else
             {
-                pos = usbd_dma_scheduler_algorithm(req);
+                pos = usbd_dma_scheduler_algorithm(req, USBD_DMA_CLASS_NORMAL);
             }
             nrfx_usbd_ep_t ep = bit2ep(pos);
             usbd_ep_state_t * p_state = ep_state_access(ep);
@@ -1424,6 +1544,7 @@ static void usbd_dmareq_process(void)
 
             usbd_dma_pending_set();
             m_ep_ready &= ~(1U << pos);
+            usbd_dma_wait_end(pos);
             if (NRFX_USBD_ISO_DEBUG || (!NRF_USBD_EPISO_CHECK(ep)))
             {
                 NRFX_LOG_DEBUG(
@@ -1974,6 +2095,43 @@ uint16_t nrfx_usbd_ep_max_packet_size_get(nrfx_usbd_ep_t ep)
     return p_state->max_packet_size;
 }
 
+void nrfx_usbd_ep_dma_priority_set(nrfx_usbd_ep_t ep, bool high)
+{
+    NRFX_USBD_ASSERT_EP_VALID(ep);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (high)
+    {
+        m_ep_dma_prio |= 1U << ep2bit(ep);
+    }
+    else
+    {
+        m_ep_dma_prio &= ~(1U << ep2bit(ep));
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+#if NRFX_CHECK(NRFX_USBD_CONFIG_DMA_STATS_ENABLED)
+void nrfx_usbd_ep_dma_stats_get(nrfx_usbd_ep_t ep, nrfx_usbd_ep_dma_stats_t * p_stats)
+{
+    NRFX_USBD_ASSERT_EP_VALID(ep);
+    NRFX_ASSERT(p_stats);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    *p_stats = m_ep_dma_stats[ep2bit(ep)];
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+void nrfx_usbd_ep_dma_stats_clear(nrfx_usbd_ep_t ep)
+{
+    NRFX_USBD_ASSERT_EP_VALID(ep);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    m_ep_dma_stats[ep2bit(ep)] = (nrfx_usbd_ep_dma_stats_t){0};
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+#endif
+
 bool nrfx_usbd_ep_enable_check(nrfx_usbd_ep_t ep)
 {
     return nrf_usbd_ep_enable_check(NRF_USBD, ep_to_hal(ep));
@@ -2122,6 +2280,7 @@ int nrfx_usbd_ep_transfer(
         p_state->transfer_cnt = 0;
         p_state->status    =  NRFX_USBD_EP_OK;
         m_ep_dma_waiting   |= 1U << ep_bitpos;
+        usbd_dma_wait_start(1U << ep_bitpos);
         ret = 0;
         usbd_int_rise();
     }
@@ -2179,6 +2338,7 @@ int nrfx_usbd_ep_handled_transfer(
         p_state->p_context = p_handler->p_context;
         p_state->status    =  NRFX_USBD_EP_OK;
         m_ep_dma_waiting   |= 1U << ep_bitpos;
+        usbd_dma_wait_start(1U << ep_bitpos);
 
         ret = 0;
         usbd_int_rise();
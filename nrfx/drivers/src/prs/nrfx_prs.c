@@ -47,20 +47,33 @@
     {                                                                              \
         return &NRFX_CONCAT(m_prs_box_, i);                         \
     }
+#if defined(NRFX_PRS_TIMESTAMP_GET)
+#define PRS_TIMESTAMP_GET() NRFX_PRS_TIMESTAMP_GET()
+#else
+#define PRS_TIMESTAMP_GET() 0
+#endif
+
 typedef struct {
     nrfx_irq_handler_t     handler;
     bool                   acquired;
     void *                 p_instance;
+    nrfx_prs_owner_t *     p_owner;   // Owner holding the peripheral in the sharing mode.
+    nrfx_prs_owner_t *     p_last;    // Owner whose configuration is in the registers.
+    nrfx_prs_owner_t *     p_queue;   // Owners waiting for the peripheral.
+    volatile uint32_t *    p_enable;  // ENABLE register shared by the peripherals.
 } prs_box_t;
 
-#define PRS_BOX_DEFINE(periph_name, prefix, n, _)                \
-    static prs_box_t m_prs_box_##n = { .handler = NULL,          \
-                                       .acquired = false,        \
-                                       .p_instance = NULL };     \
-    void nrfx_prs_box_##n##_irq_handler(void)                    \
-    {                                                            \
-        NRFX_ASSERT(m_prs_box_##n.handler);                      \
-        m_prs_box_##n.handler(m_prs_box_##n.p_instance);         \
+// All peripherals sharing an ID have the ENABLE register at the same offset,
+// so the register of the peripheral that identifies the box is used for all of them.
+#define PRS_BOX_DEFINE(periph_name, prefix, n, _)                                      \
+    static prs_box_t m_prs_box_##n = { .handler = NULL,                                \
+                                       .acquired = false,                              \
+                                       .p_instance = NULL,                             \
+                                       .p_enable = &NRFX_PRS_BOX_##n##_ADDR->ENABLE }; \
+    void nrfx_prs_box_##n##_irq_handler(void)                                          \
+    {                                                                                  \
+        NRFX_ASSERT(m_prs_box_##n.handler);                                            \
+        m_prs_box_##n.handler(m_prs_box_##n.p_instance);                               \
     }
 
 NRFX_FOREACH_ENABLED(PRS_BOX_, PRS_BOX_DEFINE, (), (), _)
@@ -90,13 +103,25 @@ int nrfx_prs_acquire(void const *       p_base_addr,
         NRFX_CRITICAL_SECTION_ENTER();
         if (p_box->acquired)
         {
-            busy = true;
+            // In the sharing mode, the driver of the current owner is allowed
+            // to register its interrupt handler.
+            if (p_box->p_owner && (p_box->p_owner->p_instance == p_instance))
+            {
+                p_box->p_owner->irq_handler = irq_handler;
+                p_box->handler              = irq_handler;
+            }
+            else
+            {
+                busy = true;
+            }
         }
         else
         {
             p_box->acquired   = true;
             p_box->handler    = irq_handler;
             p_box->p_instance = p_instance;
+            // Configuration of the last owner is overwritten by this user.
+            p_box->p_last     = NULL;
         }
         NRFX_CRITICAL_SECTION_EXIT();
 
@@ -118,10 +143,156 @@ void nrfx_prs_release(void const * p_base_addr)
     NRFX_ASSERT(p_base_addr);
 
     prs_box_t * p_box = prs_box_get(p_base_addr);
-    if (p_box != NULL)
+    if ((p_box != NULL) && (p_box->p_owner == NULL))
     {
         p_box->handler  = NULL;
         p_box->acquired = false;
         p_box->p_instance = NULL;
     }
 }
+
+// Must be called in a critical section.
+static bool owner_grant(prs_box_t * p_box, nrfx_prs_owner_t * p_owner, uint32_t now)
+{
+    bool restore = (p_box->p_last != p_owner);
+
+    if (restore && p_box->p_last)
+    {
+        // Peripheral may still be enabled with the configuration of the previous owner.
+        // It must be disabled before the new owner writes PSEL and other registers
+        // that can only be changed while the peripheral is disabled.
+        *p_box->p_enable = 0;
+    }
+
+    p_box->acquired   = true;
+    p_box->p_owner    = p_owner;
+    p_box->p_last     = p_owner;
+    p_box->handler    = p_owner->irq_handler;
+    p_box->p_instance = p_owner->p_instance;
+
+    p_owner->pending   = false;
+    p_owner->timestamp = now;
+    p_owner->stats.grants++;
+    if (restore)
+    {
+        p_owner->stats.restores++;
+    }
+    return restore;
+}
+
+int nrfx_prs_owner_request(void const * p_base_addr, nrfx_prs_owner_t * p_owner)
+{
+    NRFX_ASSERT(p_base_addr);
+    NRFX_ASSERT(p_owner && p_owner->handler);
+    int ret_code;
+    bool restore = false;
+
+    prs_box_t * p_box = prs_box_get(p_base_addr);
+    if (p_box == NULL)
+    {
+        ret_code = -EINVAL;
+        LOG_FUNCTION_EXIT(WARNING, ret_code);
+        return ret_code;
+    }
+
+    uint32_t now = PRS_TIMESTAMP_GET();
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if ((p_box->p_owner == p_owner) || p_owner->pending)
+    {
+        ret_code = -EALREADY;
+    }
+    else if (!p_box->acquired)
+    {
+        p_owner->p_base_addr = p_base_addr;
+        restore  = owner_grant(p_box, p_owner, now);
+        ret_code = 0;
+    }
+    else if (p_box->p_owner == NULL)
+    {
+        ret_code = -EBUSY;
+    }
+    else
+    {
+        nrfx_prs_owner_t ** pp_last = &p_box->p_queue;
+
+        while (*pp_last)
+        {
+            pp_last = &(*pp_last)->p_next;
+        }
+        *pp_last = p_owner;
+
+        p_owner->p_next      = NULL;
+        p_owner->p_base_addr = p_base_addr;
+        p_owner->pending     = true;
+        p_owner->timestamp   = now;
+        p_owner->stats.waits++;
+        ret_code = -EINPROGRESS;
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if (ret_code == 0)
+    {
+        p_owner->handler(p_owner, restore, p_owner->p_context);
+    }
+
+    LOG_FUNCTION_EXIT(INFO, ret_code);
+    return ret_code;
+}
+
+void nrfx_prs_owner_release(nrfx_prs_owner_t * p_owner)
+{
+    NRFX_ASSERT(p_owner);
+
+    prs_box_t * p_box = prs_box_get(p_owner->p_base_addr);
+    NRFX_ASSERT(p_box);
+
+    nrfx_prs_owner_t * p_next = NULL;
+    bool restore = false;
+    uint32_t now = PRS_TIMESTAMP_GET();
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (p_owner->pending)
+    {
+        nrfx_prs_owner_t ** pp_item = &p_box->p_queue;
+
+        while (*pp_item != p_owner)
+        {
+            pp_item = &(*pp_item)->p_next;
+        }
+        *pp_item = p_owner->p_next;
+
+        p_owner->pending = false;
+        p_owner->stats.wait_time += (uint32_t)(now - p_owner->timestamp);
+    }
+    else if (p_box->p_owner == p_owner)
+    {
+        // Interrupt handler is switched to the next owner, so any event of a transfer
+        // that is still ongoing would be handled by the wrong driver.
+        NRFX_ASSERT(!p_box->p_queue ||
+                    !NRFX_IRQ_IS_PENDING(nrfx_get_irq_number(p_owner->p_base_addr)));
+
+        p_owner->stats.busy_time += (uint32_t)(now - p_owner->timestamp);
+
+        p_next = p_box->p_queue;
+        if (p_next)
+        {
+            p_box->p_queue = p_next->p_next;
+            p_next->stats.wait_time += (uint32_t)(now - p_next->timestamp);
+            restore = owner_grant(p_box, p_next, now);
+        }
+        else
+        {
+            // The interrupt handler of the owner is kept, so that it can still
+            // handle the interrupts of the last transfer.
+            p_box->p_owner  = NULL;
+            p_box->acquired = false;
+        }
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if (p_next)
+    {
+        p_next->handler(p_next, restore, p_next->p_context);
+    }
+}
@@ -80,6 +80,109 @@ int nrfx_prs_acquire(void const *       p_base_addr,
  */
 void nrfx_prs_release(void const * p_base_addr);
 
+#if !defined(NRFX_PRS_TIMESTAMP_GET) && defined(DWT_CTRL_CYCCNTENA_Msk)
+/**
+ * @brief Macro for getting the timestamp used for the occupancy statistics of owners.
+ *
+ * By default, the DWT cycle counter is used where available. The counter must be
+ * enabled by the application. Without this macro, times in the statistics are zero.
+ */
+#define NRFX_PRS_TIMESTAMP_GET() (DWT->CYCCNT)
+#endif
+
+/** @brief Structure for the occupancy statistics of an owner. */
+typedef struct
+{
+    uint32_t grants;    ///< Number of times the ownership was granted.
+    uint32_t restores;  ///< Number of grants that required the configuration to be restored.
+    uint32_t waits;     ///< Number of requests that were queued.
+    uint64_t wait_time; ///< Total time spent in the queue, in @ref NRFX_PRS_TIMESTAMP_GET ticks.
+    uint64_t busy_time; ///< Total time of the ownership, in @ref NRFX_PRS_TIMESTAMP_GET ticks.
+} nrfx_prs_owner_stats_t;
+
+/** @brief Owner of a time-multiplexed shared peripheral. */
+typedef struct nrfx_prs_owner_s nrfx_prs_owner_t;
+
+/**
+ * @brief Handler called when the ownership is granted.
+ *
+ * If @p restore is true, the peripheral was used by another owner since this owner
+ * released it, or this owner is granted the peripheral for the first time. The peripheral
+ * is then disabled, by the PRS if another owner used it, and the handler must restore
+ * the configuration of its driver and enable the peripheral, typically
+ * by calling the reconfigure function of the driver with the configuration cached
+ * by the owner. Otherwise, the registers still hold the configuration of this owner.
+ *
+ * @param[in] p_owner   Pointer to the owner.
+ * @param[in] restore   True if the configuration must be restored.
+ * @param[in] p_context Context passed in @ref nrfx_prs_owner_t.
+ */
+typedef void (* nrfx_prs_owner_handler_t)(nrfx_prs_owner_t * p_owner,
+                                          bool               restore,
+                                          void *             p_context);
+
+/** @brief Structure for the owner of a time-multiplexed shared peripheral. */
+struct nrfx_prs_owner_s
+{
+    void *                   p_instance; ///< Driver instance passed to @ref nrfx_prs_acquire by the driver of the owner.
+    nrfx_prs_owner_handler_t handler;    ///< Handler called when the ownership is granted.
+    void *                   p_context;  ///< Context passed to @p handler.
+    nrfx_prs_owner_stats_t   stats;      ///< Occupancy statistics.
+    /** @cond Driver internal data. */
+    nrfx_irq_handler_t       irq_handler;
+    nrfx_prs_owner_t *       p_next;
+    void const *             p_base_addr;
+    uint32_t                 timestamp;
+    bool                     pending;
+    /** @endcond */
+};
+
+/**
+ * @brief Function for requesting the ownership of a time-multiplexed shared peripheral.
+ *
+ * Time-multiplexed sharing lets drivers of peripherals with the same ID, for example
+ * TWIM0 and SPIM0, stay initialized at the same time and take turns in using
+ * the peripheral. Each driver is initialized once, while its owner holds the peripheral,
+ * and @ref nrfx_prs_acquire called by the driver then registers its interrupt handler
+ * in the owner. Afterwards, only the configuration of the driver is restored
+ * on every switch, instead of the driver being uninitialized and initialized again.
+ *
+ * If the peripheral is free, the ownership is granted immediately and @p handler of
+ * the owner is called from within this function. Otherwise, the request is queued and
+ * the handler is called when the ownership is passed to the owner by
+ * @ref nrfx_prs_owner_release. Requests are served in the order of arrival.
+ *
+ * @note While the peripheral is in the time-multiplexed sharing mode, @ref nrfx_prs_release
+ *       has no effect on it.
+ *
+ * @param[in] p_base_addr Requested peripheral base pointer.
+ * @param[in] p_owner     Pointer to the owner.
+ *
+ * @retval 0            The ownership was granted.
+ * @retval -EINPROGRESS The request was queued.
+ * @retval -EALREADY    The owner already holds the peripheral or waits for it.
+ * @retval -EBUSY       The peripheral is acquired with @ref nrfx_prs_acquire outside
+ *                      of the time-multiplexed sharing mode.
+ * @retval -EINVAL      The peripheral is not handled by the PRS subsystem.
+ */
+int nrfx_prs_owner_request(void const * p_base_addr, nrfx_prs_owner_t * p_owner);
+
+/**
+ * @brief Function for releasing the ownership of a time-multiplexed shared peripheral.
+ *
+ * If other owners wait for the peripheral, the ownership is passed to the first one
+ * and its handler is called from within this function. If the owner is only queued,
+ * its request is cancelled.
+ *
+ * @warning The interrupt handler of the peripheral is switched to the next owner
+ *          immediately and the peripheral is disabled before the configuration of the next
+ *          owner is restored. The function must be called only after the transfer started
+ *          by the owner has completed and its events have been handled.
+ *
+ * @param[in] p_owner Pointer to the owner.
+ */
+void nrfx_prs_owner_release(nrfx_prs_owner_t * p_owner);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -163,6 +163,22 @@ typedef enum
      | (decrypt ? 1 : 0)                  \
     )
 
+/**
+ * @brief Tag targeting the configuration register of the Hash crypto engine.
+ */
+#define NRF_CRACEN_CM_DMA_TAG_HASH_CONFIG \
+    (NRF_CRACEN_CM_DMA_TAG_ENGINE_HASH | NRF_CRACEN_CM_DMA_TAG_CONFIG)
+
+/** @brief CRACEN CM Hash crypto engine configuration modes of operation. */
+typedef enum
+{
+    NRF_CRACEN_CM_HASH_CONFIG_MODE_SHA1   = 0x02, ///< SHA-1 mode.
+    NRF_CRACEN_CM_HASH_CONFIG_MODE_SHA224 = 0x04, ///< SHA-224 mode.
+    NRF_CRACEN_CM_HASH_CONFIG_MODE_SHA256 = 0x08, ///< SHA-256 mode.
+    NRF_CRACEN_CM_HASH_CONFIG_MODE_SHA384 = 0x10, ///< SHA-384 mode.
+    NRF_CRACEN_CM_HASH_CONFIG_MODE_SHA512 = 0x20, ///< SHA-512 mode.
+} nrf_cracen_cm_hash_config_mode_t;
+
 /** @} */
 
 #ifdef __cplusplus
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+#include <nrfx.h>
+#include <helpers/nrfx_cache_prof.h>
+
+void nrfx_cache_prof_enable(NRF_CACHE_Type * p_reg)
+{
+    nrf_cache_profiling_set(p_reg, true);
+    nrf_cache_profiling_counters_clear(p_reg);
+}
+
+void nrfx_cache_prof_disable(NRF_CACHE_Type * p_reg)
+{
+    nrf_cache_profiling_set(p_reg, false);
+}
+
+void nrfx_cache_prof_counters_get(NRF_CACHE_Type const *       p_reg,
+                                  nrfx_cache_prof_counters_t * p_counters)
+{
+#if NRFX_CACHE_PROF_HAS_DATA_COUNTERS
+    p_counters->data_hits   = nrf_cache_data_hit_counter_get(p_reg, NRF_CACHE_REGION_FLASH) +
+                              nrf_cache_data_hit_counter_get(p_reg, NRF_CACHE_REGION_XIP);
+    p_counters->data_misses = nrf_cache_data_miss_counter_get(p_reg, NRF_CACHE_REGION_FLASH) +
+                              nrf_cache_data_miss_counter_get(p_reg, NRF_CACHE_REGION_XIP);
+    p_counters->hits        = nrf_cache_instruction_hit_counter_get(p_reg,
+                                                                    NRF_CACHE_REGION_FLASH) +
+                              nrf_cache_instruction_hit_counter_get(p_reg,
+                                                                    NRF_CACHE_REGION_XIP) +
+                              p_counters->data_hits;
+    p_counters->misses      = nrf_cache_instruction_miss_counter_get(p_reg,
+                                                                     NRF_CACHE_REGION_FLASH) +
+                              nrf_cache_instruction_miss_counter_get(p_reg,
+                                                                     NRF_CACHE_REGION_XIP) +
+                              p_counters->data_misses;
+#else
+    /* A single pair of counters covers all accesses. */
+    p_counters->hits   = nrf_cache_instruction_hit_counter_get(p_reg, NRF_CACHE_REGION_FLASH);
+    p_counters->misses = nrf_cache_instruction_miss_counter_get(p_reg, NRF_CACHE_REGION_FLASH);
+#endif
+}
+
+void nrfx_cache_prof_window_start(NRF_CACHE_Type const *     p_reg,
+                                  nrfx_cache_prof_window_t * p_window)
+{
+    NRFX_ASSERT(p_window);
+
+    nrfx_cache_prof_counters_get(p_reg, &p_window->start);
+}
+
+void nrfx_cache_prof_window_end(NRF_CACHE_Type const *           p_reg,
+                                nrfx_cache_prof_window_t const * p_window,
+                                nrfx_cache_prof_region_t *       p_region)
+{
+    NRFX_ASSERT(p_window);
+    NRFX_ASSERT(p_region);
+
+    nrfx_cache_prof_counters_t end;
+
+    nrfx_cache_prof_counters_get(p_reg, &end);
+
+    /* Unsigned arithmetic handles a single wrap-around of the counters. */
+    uint32_t misses = end.misses - p_window->start.misses;
+
+    p_region->hits   += end.hits - p_window->start.hits;
+    p_region->misses += misses;
+#if NRFX_CACHE_PROF_HAS_DATA_COUNTERS
+    p_region->data_hits   += end.data_hits - p_window->start.data_hits;
+    p_region->data_misses += end.data_misses - p_window->start.data_misses;
+#endif
+    if (misses > p_region->worst_misses)
+    {
+        p_region->worst_misses = misses;
+    }
+    p_region->windows++;
+}
+
+void nrfx_cache_prof_run(NRF_CACHE_Type *           p_reg,
+                         nrfx_cache_prof_region_t * p_region,
+                         nrfx_cache_prof_fn_t       fn,
+                         void *                     p_context)
+{
+    NRFX_ASSERT(fn);
+
+    nrfx_cache_prof_window_t window;
+
+    nrfx_cache_prof_window_start(p_reg, &window);
+    fn(p_context);
+    nrfx_cache_prof_window_end(p_reg, &window, p_region);
+}
+
+uint32_t nrfx_cache_prof_hit_rate_get(nrfx_cache_prof_region_t const * p_region)
+{
+    NRFX_ASSERT(p_region);
+
+    uint64_t total = p_region->hits + p_region->misses;
+
+    if (total == 0)
+    {
+        return 10000;
+    }
+    return (uint32_t)((p_region->hits * 10000) / total);
+}
+
+void nrfx_cache_prof_region_reset(nrfx_cache_prof_region_t * p_region)
+{
+    NRFX_ASSERT(p_region);
+
+    char const * p_name = p_region->p_name;
+
+    memset(p_region, 0, sizeof(*p_region));
+    p_region->p_name = p_name;
+}
+
+#if NRF_CACHE_HAS_RAM_MODE && NRF_CACHE_HAS_CACHEDATA
+void * nrfx_cache_prof_ram_load(NRF_CACHE_Type * p_reg,
+                                size_t           offset,
+                                void const *     p_src,
+                                size_t           size)
+{
+    NRFX_ASSERT(p_src);
+
+    if ((offset > NRFX_CACHE_PROF_RAM_SIZE) || (size > NRFX_CACHE_PROF_RAM_SIZE - offset))
+    {
+        return NULL;
+    }
+
+    if (!nrf_cache_ram_mode_check(p_reg))
+    {
+        /* Entering the RAM mode clears the cache memory. */
+        nrf_cache_disable(p_reg);
+        nrf_cache_ram_mode_set(p_reg, true);
+        nrf_cache_enable(p_reg);
+    }
+
+    uint8_t * p_dst = (uint8_t *)NRF_CACHEDATA + offset;
+
+    memcpy(p_dst, p_src, size);
+    __DSB();
+    __ISB();
+
+    return p_dst;
+}
+
+void nrfx_cache_prof_ram_mode_exit(NRF_CACHE_Type * p_reg)
+{
+    nrf_cache_disable(p_reg);
+    nrf_cache_ram_mode_set(p_reg, false);
+    nrf_cache_enable(p_reg);
+}
+#endif
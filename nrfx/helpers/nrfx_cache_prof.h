@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#ifndef NRFX_CACHE_PROF_H__
+#define NRFX_CACHE_PROF_H__
+
+#include <nrfx.h>
+#include <hal/nrf_cache.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_cache_prof Generic cache profiling layer
+ * @{
+ * @ingroup nrf_cache
+ *
+ * @brief Helper layer for measuring cache hit rates of code regions.
+ *
+ * The hit and miss counters of the cache are sampled at the start and at the end of
+ * a profiling window and the difference is accumulated in the structure describing
+ * the profiled region, for example an interrupt handler. As the counters are never
+ * cleared by a window, windows can be nested, for example a window in an interrupt
+ * handler can preempt a window in the thread context. The counts of the nested window
+ * are then included in the outer one.
+ *
+ * The accumulated results are kept in plain structures, so they can be read
+ * by a test harness or a debugger and compared against the expected hit rates.
+ */
+
+#if defined(CACHE_PROFILING_IHIT_HITS_Msk) || defined(__NRFX_DOXYGEN__)
+/** @brief Symbol indicating whether separate counters are available for data accesses. */
+#define NRFX_CACHE_PROF_HAS_DATA_COUNTERS 1
+#else
+#define NRFX_CACHE_PROF_HAS_DATA_COUNTERS 0
+#endif
+
+/** @brief Structure for the values of the cache counters. */
+typedef struct
+{
+    uint32_t hits;        ///< Cache hits.
+    uint32_t misses;      ///< Cache misses.
+#if NRFX_CACHE_PROF_HAS_DATA_COUNTERS || defined(__NRFX_DOXYGEN__)
+    uint32_t data_hits;   ///< Part of @p hits caused by data accesses.
+    uint32_t data_misses; ///< Part of @p misses caused by data accesses.
+#endif
+} nrfx_cache_prof_counters_t;
+
+/** @brief Structure for the profiling window. */
+typedef struct
+{
+    /** @cond Driver internal data. */
+    nrfx_cache_prof_counters_t start;
+    /** @endcond */
+} nrfx_cache_prof_window_t;
+
+/** @brief Structure for the results accumulated for a profiled region. */
+typedef struct
+{
+    char const * p_name;       ///< Name of the region, for reporting. Can be NULL.
+    uint64_t     hits;         ///< Accumulated cache hits.
+    uint64_t     misses;       ///< Accumulated cache misses.
+#if NRFX_CACHE_PROF_HAS_DATA_COUNTERS || defined(__NRFX_DOXYGEN__)
+    uint64_t     data_hits;    ///< Part of @p hits caused by data accesses.
+    uint64_t     data_misses;  ///< Part of @p misses caused by data accesses.
+#endif
+    uint32_t     windows;      ///< Number of completed windows.
+    uint32_t     worst_misses; ///< Largest number of misses in a single window.
+} nrfx_cache_prof_region_t;
+
+/** @brief Macro for initializing the region structure. */
+#define NRFX_CACHE_PROF_REGION_INIT(name) { .p_name = (name) }
+
+/** @brief Function type of the profiled code for @ref nrfx_cache_prof_run. */
+typedef void (* nrfx_cache_prof_fn_t)(void * p_context);
+
+/**
+ * @brief Function for enabling the profiling counters.
+ *
+ * The counters are cleared.
+ *
+ * @param[in] p_reg Pointer to the structure of registers of the cache.
+ */
+void nrfx_cache_prof_enable(NRF_CACHE_Type * p_reg);
+
+/**
+ * @brief Function for disabling the profiling counters.
+ *
+ * @param[in] p_reg Pointer to the structure of registers of the cache.
+ */
+void nrfx_cache_prof_disable(NRF_CACHE_Type * p_reg);
+
+/**
+ * @brief Function for reading the current values of the counters.
+ *
+ * On devices with separate counters for the flash and XIP regions, the values
+ * for both regions are added.
+ *
+ * @param[in]  p_reg      Pointer to the structure of registers of the cache.
+ * @param[out] p_counters Pointer to the structure to be filled with the counter values.
+ */
+void nrfx_cache_prof_counters_get(NRF_CACHE_Type const *       p_reg,
+                                  nrfx_cache_prof_counters_t * p_counters);
+
+/**
+ * @brief Function for starting a profiling window.
+ *
+ * @param[in]  p_reg    Pointer to the structure of registers of the cache.
+ * @param[out] p_window Pointer to the window structure.
+ */
+void nrfx_cache_prof_window_start(NRF_CACHE_Type const *     p_reg,
+                                  nrfx_cache_prof_window_t * p_window);
+
+/**
+ * @brief Function for ending a profiling window and adding its counts to a region.
+ *
+ * @param[in]    p_reg    Pointer to the structure of registers of the cache.
+ * @param[in]    p_window Pointer to the window structure started with
+ *                        @ref nrfx_cache_prof_window_start.
+ * @param[inout] p_region Pointer to the region structure.
+ */
+void nrfx_cache_prof_window_end(NRF_CACHE_Type const *           p_reg,
+                                nrfx_cache_prof_window_t const * p_window,
+                                nrfx_cache_prof_region_t *       p_region);
+
+/**
+ * @brief Function for running a function in a profiling window.
+ *
+ * @param[in]    p_reg     Pointer to the structure of registers of the cache.
+ * @param[inout] p_region  Pointer to the region structure.
+ * @param[in]    fn        Function to be profiled.
+ * @param[in]    p_context Context passed to @p fn.
+ */
+void nrfx_cache_prof_run(NRF_CACHE_Type *           p_reg,
+                         nrfx_cache_prof_region_t * p_region,
+                         nrfx_cache_prof_fn_t       fn,
+                         void *                     p_context);
+
+/**
+ * @brief Function for getting the hit rate of a region.
+ *
+ * @param[in] p_region Pointer to the region structure.
+ *
+ * @return Hit rate in hundredths of a percent, from 0 to 10000. 10000 is returned
+ *         when no accesses were counted.
+ */
+uint32_t nrfx_cache_prof_hit_rate_get(nrfx_cache_prof_region_t const * p_region);
+
+/**
+ * @brief Function for clearing the results of a region.
+ *
+ * @param[out] p_region Pointer to the region structure.
+ */
+void nrfx_cache_prof_region_reset(nrfx_cache_prof_region_t * p_region);
+
+#if (NRF_CACHE_HAS_RAM_MODE && NRF_CACHE_HAS_CACHEDATA) || defined(__NRFX_DOXYGEN__)
+/** @brief Size of the cache memory available in the RAM mode. */
+#define NRFX_CACHE_PROF_RAM_SIZE sizeof(NRF_CACHEDATA_Type)
+
+/**
+ * @brief Function for switching the cache to the RAM mode and loading it with code or data.
+ *
+ * In the RAM mode, the cache memory is mapped at the address of the CACHEDATA
+ * region and the accesses to the non-volatile memory are no longer cached.
+ * This allows keeping a small, frequently executed routine in a fast memory with
+ * a deterministic access time. The routine must be position independent. On the Cortex-M
+ * CPU, the entry address of the loaded function must have the Thumb bit set.
+ *
+ * @param[in] p_reg  Pointer to the structure of registers of the cache.
+ * @param[in] offset Offset in the cache memory at which the content is placed.
+ * @param[in] p_src  Pointer to the content to be loaded.
+ * @param[in] size   Size of the content in bytes.
+ *
+ * @return Pointer to the loaded content or NULL if it does not fit in the cache memory.
+ */
+void * nrfx_cache_prof_ram_load(NRF_CACHE_Type * p_reg,
+                                size_t           offset,
+                                void const *     p_src,
+                                size_t           size);
+
+/**
+ * @brief Function for switching the cache back from the RAM mode.
+ *
+ * The cache is invalidated and the content loaded in the RAM mode is lost.
+ *
+ * @param[in] p_reg Pointer to the structure of registers of the cache.
+ */
+void nrfx_cache_prof_ram_mode_exit(NRF_CACHE_Type * p_reg);
+#endif
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_CACHE_PROF_H__
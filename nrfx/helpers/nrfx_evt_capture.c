@@ -0,0 +1,419 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if defined(PPI_PRESENT) || defined(DPPIC_PRESENT)
+#include <helpers/nrfx_evt_capture.h>
+
+static bool source_is_timer(nrfx_evt_capture_t const * p_capture)
+{
+    return p_capture->config.source == NRFX_EVT_CAPTURE_SOURCE_TIMER;
+}
+
+static uint64_t cc_read(nrfx_evt_capture_t const * p_capture, uint8_t channel)
+{
+#if NRFX_CHECK(NRFX_GRTC_ENABLED)
+    if (!source_is_timer(p_capture))
+    {
+        return nrfx_grtc_sys_counter_cc_get(channel);
+    }
+#endif
+    return nrfy_timer_cc_get(p_capture->config.p_timer->p_reg, (nrf_timer_cc_channel_t)channel);
+}
+
+static uint32_t capture_task_address_get(nrfx_evt_capture_t const * p_capture, uint8_t channel)
+{
+#if NRFX_CHECK(NRFX_GRTC_ENABLED)
+    if (!source_is_timer(p_capture))
+    {
+        return nrfx_grtc_capture_task_address_get(channel);
+    }
+#endif
+    return nrfy_timer_task_address_get(p_capture->config.p_timer->p_reg,
+                                       nrfy_timer_capture_task_get(channel));
+}
+
+// Sets up the channel of a new endpoint.
+static int channel_get(nrfx_evt_capture_t const * p_capture, nrfx_evt_capture_ep_t * p_ep)
+{
+#if NRFX_CHECK(NRFX_GRTC_ENABLED)
+    if (!source_is_timer(p_capture))
+    {
+        if (p_ep->channel == NRFX_EVT_CAPTURE_CHANNEL_ALLOC)
+        {
+            int err = nrfx_grtc_channel_alloc(&p_ep->channel);
+
+            if (err < 0)
+            {
+                return err;
+            }
+            p_ep->channel_alloc = true;
+        }
+
+        // Capture fails for a channel that is not allocated, and marks the channel as used
+        // by the GRTC driver otherwise.
+        if (nrfx_grtc_syscounter_capture(p_ep->channel) != 0)
+        {
+            return -EINVAL;
+        }
+        return 0;
+    }
+#endif
+    return (p_ep->channel < p_capture->config.cc_count) ? 0 : -EINVAL;
+}
+
+static void channel_put(nrfx_evt_capture_ep_t * p_ep)
+{
+#if NRFX_CHECK(NRFX_GRTC_ENABLED)
+    if (p_ep->channel_alloc)
+    {
+        (void)nrfx_grtc_channel_free(p_ep->channel);
+        p_ep->channel_alloc = false;
+    }
+#else
+    (void)p_ep;
+#endif
+}
+
+static uint64_t counter_mask_get(nrfx_evt_capture_t const * p_capture)
+{
+    if (!source_is_timer(p_capture))
+    {
+        return UINT64_MAX;
+    }
+
+    switch (nrfy_timer_bit_width_get(p_capture->config.p_timer->p_reg))
+    {
+        case NRF_TIMER_BIT_WIDTH_8:
+            return UINT8_MAX;
+        case NRF_TIMER_BIT_WIDTH_16:
+            return UINT16_MAX;
+        case NRF_TIMER_BIT_WIDTH_24:
+            return NRFX_BIT_MASK(24);
+        default:
+            return UINT32_MAX;
+    }
+}
+
+static uint8_t hist_bucket_get(uint64_t delta)
+{
+    uint8_t bucket = 0;
+
+    // Number of significant bits of the delta.
+    while (delta && (bucket < (NRFX_EVT_CAPTURE_HIST_BUCKETS - 1)))
+    {
+        delta >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+static void stats_update(nrfx_evt_capture_stats_t * p_stats, uint64_t delta)
+{
+    if ((p_stats->count == 0) || (delta < p_stats->min))
+    {
+        p_stats->min = delta;
+    }
+    if (delta > p_stats->max)
+    {
+        p_stats->max = delta;
+    }
+    p_stats->count++;
+    p_stats->sum += delta;
+    p_stats->hist[hist_bucket_get(delta)]++;
+}
+
+static void ring_put(nrfx_evt_capture_t * p_capture, uint64_t timestamp, uint8_t endpoint)
+{
+    uint16_t next = (uint16_t)((p_capture->head + 1) % p_capture->config.ring_size);
+
+    // One element is kept free to tell a full ring from an empty one.
+    if (next == p_capture->tail)
+    {
+        p_capture->overflows++;
+        return;
+    }
+
+    p_capture->config.p_ring[p_capture->head].timestamp = timestamp;
+    p_capture->config.p_ring[p_capture->head].endpoint  = endpoint;
+    p_capture->head = next;
+}
+
+// Must be called in a critical section.
+static void timestamp_register(nrfx_evt_capture_t * p_capture, uint8_t endpoint, uint64_t cc)
+{
+    nrfx_evt_capture_ep_t *       p_ep  = &p_capture->ep[endpoint];
+    nrfx_evt_capture_ep_t const * p_ref = &p_capture->ep[p_ep->ref];
+
+    // Deltas are calculated before the timestamp is updated, so that an endpoint
+    // that is its own reference measures the interval since its previous event.
+    if (p_ref->captured)
+    {
+        stats_update(&p_ep->stats, (cc - p_ref->timestamp) & p_capture->mask);
+    }
+
+    p_ep->last_cc   = cc;
+    p_ep->timestamp = cc;
+    p_ep->captured  = true;
+    ring_put(p_capture, cc, endpoint);
+}
+
+int nrfx_evt_capture_init(nrfx_evt_capture_t *              p_capture,
+                          nrfx_evt_capture_config_t const * p_config)
+{
+    NRFX_ASSERT(p_capture);
+    NRFX_ASSERT(p_config);
+
+    if (!p_config->p_ring || (p_config->ring_size < 2) ||
+        ((p_config->source == NRFX_EVT_CAPTURE_SOURCE_TIMER) &&
+         (!p_config->p_timer || (p_config->cc_count == 0) ||
+          (p_config->cc_count > NRF_TIMER_CC_COUNT_MAX))))
+    {
+        return -EINVAL;
+    }
+
+    memset(p_capture, 0, sizeof(*p_capture));
+    p_capture->config = *p_config;
+    p_capture->mask   = counter_mask_get(p_capture);
+
+    return 0;
+}
+
+void nrfx_evt_capture_uninit(nrfx_evt_capture_t * p_capture)
+{
+    NRFX_ASSERT(p_capture);
+
+    nrfx_evt_capture_disable(p_capture);
+
+    for (uint8_t i = 0; i < p_capture->ep_count; i++)
+    {
+        nrfx_evt_capture_ep_t * p_ep = &p_capture->ep[i];
+
+        if (p_ep->eep)
+        {
+            nrfx_gppi_conn_free(p_ep->eep,
+                                capture_task_address_get(p_capture, p_ep->channel),
+                                p_ep->handle);
+        }
+        channel_put(p_ep);
+    }
+    p_capture->ep_count = 0;
+}
+
+int nrfx_evt_capture_endpoint_add(nrfx_evt_capture_t *                       p_capture,
+                                  nrfx_evt_capture_endpoint_config_t const * p_config)
+{
+    NRFX_ASSERT(p_capture);
+    NRFX_ASSERT(p_config);
+
+    uint8_t                 idx = p_capture->ep_count;
+    nrfx_evt_capture_ep_t * p_ep;
+    int                     err;
+
+    if (idx >= NRFX_EVT_CAPTURE_MAX_ENDPOINTS)
+    {
+        return -ENOMEM;
+    }
+    if (p_config->ref > idx)
+    {
+        return -EINVAL;
+    }
+
+    p_ep = &p_capture->ep[idx];
+    memset(p_ep, 0, sizeof(*p_ep));
+    p_ep->eep     = p_config->eep;
+    p_ep->channel = p_config->channel;
+    p_ep->ref     = p_config->ref;
+
+    err = channel_get(p_capture, p_ep);
+    if (err < 0)
+    {
+        channel_put(p_ep);
+        return err;
+    }
+
+    // The current value of the channel is not a capture of this endpoint.
+    p_ep->last_cc = cc_read(p_capture, p_ep->channel);
+
+    if (p_ep->eep)
+    {
+        err = nrfx_gppi_conn_alloc(p_ep->eep,
+                                   capture_task_address_get(p_capture, p_ep->channel),
+                                   &p_ep->handle);
+        if (err < 0)
+        {
+            channel_put(p_ep);
+            return err;
+        }
+        if (p_capture->enabled)
+        {
+            nrfx_gppi_conn_enable(p_ep->handle);
+        }
+    }
+
+    p_capture->ep_count++;
+    return idx;
+}
+
+void nrfx_evt_capture_enable(nrfx_evt_capture_t * p_capture)
+{
+    NRFX_ASSERT(p_capture);
+
+    for (uint8_t i = 0; i < p_capture->ep_count; i++)
+    {
+        if (p_capture->ep[i].eep)
+        {
+            nrfx_gppi_conn_enable(p_capture->ep[i].handle);
+        }
+    }
+    p_capture->enabled = true;
+}
+
+void nrfx_evt_capture_disable(nrfx_evt_capture_t * p_capture)
+{
+    NRFX_ASSERT(p_capture);
+
+    for (uint8_t i = 0; i < p_capture->ep_count; i++)
+    {
+        if (p_capture->ep[i].eep)
+        {
+            nrfx_gppi_conn_disable(p_capture->ep[i].handle);
+        }
+    }
+    p_capture->enabled = false;
+}
+
+void nrfx_evt_capture_process(nrfx_evt_capture_t * p_capture)
+{
+    NRFX_ASSERT(p_capture);
+
+    for (uint8_t i = 0; i < p_capture->ep_count; i++)
+    {
+        nrfx_evt_capture_ep_t * p_ep = &p_capture->ep[i];
+
+        if (!p_ep->eep)
+        {
+            continue;
+        }
+
+        NRFX_CRITICAL_SECTION_ENTER();
+        uint64_t cc = cc_read(p_capture, p_ep->channel);
+
+        if (cc != p_ep->last_cc)
+        {
+            timestamp_register(p_capture, i, cc);
+        }
+        NRFX_CRITICAL_SECTION_EXIT();
+    }
+}
+
+uint64_t nrfx_evt_capture_trigger(nrfx_evt_capture_t * p_capture, uint8_t endpoint)
+{
+    NRFX_ASSERT(p_capture);
+    NRFX_ASSERT(endpoint < p_capture->ep_count);
+
+    nrfx_evt_capture_ep_t * p_ep = &p_capture->ep[endpoint];
+    uint64_t                cc;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+#if NRFX_CHECK(NRFX_GRTC_ENABLED)
+    if (!source_is_timer(p_capture))
+    {
+        (void)nrfx_grtc_syscounter_capture(p_ep->channel);
+        cc = nrfx_grtc_sys_counter_cc_get(p_ep->channel);
+    }
+    else
+#endif
+    {
+        cc = nrfy_timer_capture_get(p_capture->config.p_timer->p_reg,
+                                    (nrf_timer_cc_channel_t)p_ep->channel);
+    }
+    timestamp_register(p_capture, endpoint, cc);
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return cc;
+}
+
+uint16_t nrfx_evt_capture_read(nrfx_evt_capture_t *        p_capture,
+                               nrfx_evt_capture_sample_t * p_samples,
+                               uint16_t                    max_count)
+{
+    NRFX_ASSERT(p_capture);
+    NRFX_ASSERT(p_samples || (max_count == 0));
+
+    uint16_t count = 0;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    while ((count < max_count) && (p_capture->tail != p_capture->head))
+    {
+        p_samples[count++] = p_capture->config.p_ring[p_capture->tail];
+        p_capture->tail = (uint16_t)((p_capture->tail + 1) % p_capture->config.ring_size);
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return count;
+}
+
+uint32_t nrfx_evt_capture_overflows_get(nrfx_evt_capture_t const * p_capture)
+{
+    NRFX_ASSERT(p_capture);
+
+    return p_capture->overflows;
+}
+
+nrfx_evt_capture_stats_t const * nrfx_evt_capture_stats_get(nrfx_evt_capture_t const * p_capture,
+                                                            uint8_t                    endpoint)
+{
+    NRFX_ASSERT(p_capture);
+    NRFX_ASSERT(endpoint < p_capture->ep_count);
+
+    return &p_capture->ep[endpoint].stats;
+}
+
+void nrfx_evt_capture_stats_reset(nrfx_evt_capture_t * p_capture)
+{
+    NRFX_ASSERT(p_capture);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    for (uint8_t i = 0; i < p_capture->ep_count; i++)
+    {
+        memset(&p_capture->ep[i].stats, 0, sizeof(p_capture->ep[i].stats));
+    }
+    p_capture->head      = 0;
+    p_capture->tail      = 0;
+    p_capture->overflows = 0;
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+#endif // defined(PPI_PRESENT) || defined(DPPIC_PRESENT)
@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_EVT_CAPTURE_H__
+#define NRFX_EVT_CAPTURE_H__
+
+#include <nrfx.h>
+#include <nrfx_timer.h>
+#include <helpers/nrfx_gppi.h>
+#if NRFX_CHECK(NRFX_GRTC_ENABLED)
+#include <nrfx_grtc.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_evt_capture Hardware-timestamped event capture layer
+ * @{
+ * @ingroup nrfx_gppi
+ *
+ * @brief Helper layer for timestamping events with a TIMER or GRTC capture channel.
+ *
+ * Every endpoint of the layer owns a single capture/compare channel of the time source.
+ * The event of a hardware endpoint is connected through GPPI to the capture task
+ * of that channel, so the counter value is latched by the hardware at the moment of
+ * the event, without CPU involvement. Captured values are collected by
+ * @ref nrfx_evt_capture_process, which can be called periodically from any context,
+ * and stored as timestamps in a RAM ring. Software endpoints have no event connected
+ * and are captured with @ref nrfx_evt_capture_trigger, for example from an interrupt
+ * handler, to measure the interrupt latency against a hardware endpoint.
+ *
+ * For every timestamp, the delta to the latest timestamp of the reference endpoint
+ * is accumulated in a histogram of the endpoint. If an endpoint is its own reference,
+ * intervals between its consecutive events are measured instead.
+ *
+ * @note A capture channel holds only the latest value, so events of an endpoint that
+ *       occur more than once between two calls to @ref nrfx_evt_capture_process are
+ *       registered once, with the timestamp of the last event.
+ *
+ * @note The time source must be initialized and running before the layer is used.
+ *       As registers are accessed only through the HAL, the layer can also be used
+ *       with a TIMER instance whose registers are modeled in RAM.
+ */
+
+#ifndef NRFX_EVT_CAPTURE_MAX_ENDPOINTS
+/** @brief Maximum number of endpoints of a capture instance. */
+#define NRFX_EVT_CAPTURE_MAX_ENDPOINTS 6
+#endif
+
+#ifndef NRFX_EVT_CAPTURE_HIST_BUCKETS
+/**
+ * @brief Number of delta histogram buckets.
+ *
+ * Bucket 0 counts zero deltas and bucket @p n counts deltas from 2 ^ (n - 1)
+ * to 2 ^ n - 1 ticks. The last bucket also counts all greater deltas.
+ */
+#define NRFX_EVT_CAPTURE_HIST_BUCKETS 24
+#endif
+
+#if NRFX_CHECK(NRFX_GRTC_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Channel of a GRTC endpoint to be allocated by the layer.
+ *
+ * The channel is allocated with @ref nrfx_grtc_channel_alloc when the endpoint is added
+ * and freed by @ref nrfx_evt_capture_uninit.
+ */
+#define NRFX_EVT_CAPTURE_CHANNEL_ALLOC UINT8_MAX
+#endif
+
+/** @brief Time sources of the capture layer. */
+typedef enum
+{
+    NRFX_EVT_CAPTURE_SOURCE_TIMER, ///< TIMER instance.
+#if NRFX_CHECK(NRFX_GRTC_ENABLED) || defined(__NRFX_DOXYGEN__)
+    NRFX_EVT_CAPTURE_SOURCE_GRTC,  ///< GRTC SYSCOUNTER.
+#endif
+} nrfx_evt_capture_source_t;
+
+/** @brief Structure for a timestamp stored in the ring. */
+typedef struct
+{
+    uint64_t timestamp; ///< Captured counter value.
+    uint8_t  endpoint;  ///< Index of the endpoint.
+} nrfx_evt_capture_sample_t;
+
+/** @brief Structure for the delta statistics of an endpoint. */
+typedef struct
+{
+    uint32_t count;                               ///< Number of deltas.
+    uint64_t min;                                 ///< Smallest delta in ticks.
+    uint64_t max;                                 ///< Largest delta in ticks.
+    uint64_t sum;                                 ///< Sum of deltas in ticks.
+    uint32_t hist[NRFX_EVT_CAPTURE_HIST_BUCKETS]; ///< Histogram of deltas.
+} nrfx_evt_capture_stats_t;
+
+/** @brief Endpoint configuration structure. */
+typedef struct
+{
+    uint32_t eep;     ///< Address of the event endpoint. 0 for a software endpoint.
+    uint8_t  channel; ///< Capture/compare channel of the time source owned by the endpoint.
+                      ///< For GRTC, a channel allocated with @ref nrfx_grtc_channel_alloc
+                      ///< or @ref NRFX_EVT_CAPTURE_CHANNEL_ALLOC.
+    uint8_t  ref;     ///< Index of the reference endpoint for deltas.
+                      ///< If it is the index of the added endpoint, intervals are measured.
+} nrfx_evt_capture_endpoint_config_t;
+
+/** @brief Capture instance configuration structure. */
+typedef struct
+{
+    nrfx_evt_capture_source_t   source;    ///< Time source.
+    nrfx_timer_t const *        p_timer;   ///< TIMER instance if @p source is
+                                           ///< @ref NRFX_EVT_CAPTURE_SOURCE_TIMER.
+    uint8_t                     cc_count;  ///< Number of capture/compare channels of @p p_timer,
+                                           ///< that is NRF_TIMER_CC_CHANNEL_COUNT(id).
+                                           ///< Not used for GRTC.
+    nrfx_evt_capture_sample_t * p_ring;    ///< Buffer for the ring of timestamps.
+    uint16_t                    ring_size; ///< Number of timestamps in @p p_ring.
+} nrfx_evt_capture_config_t;
+
+/** @cond Driver internal data. */
+typedef struct
+{
+    nrfx_evt_capture_stats_t stats;
+    uint64_t                 last_cc;
+    uint64_t                 timestamp;
+    uint32_t                 eep;
+    nrfx_gppi_handle_t       handle;
+    uint8_t                  channel;
+    uint8_t                  ref;
+    bool                     captured;
+    bool                     channel_alloc;
+} nrfx_evt_capture_ep_t;
+/** @endcond */
+
+/** @brief Capture instance. */
+typedef struct
+{
+    /** @cond Driver internal data. */
+    nrfx_evt_capture_config_t config;
+    nrfx_evt_capture_ep_t     ep[NRFX_EVT_CAPTURE_MAX_ENDPOINTS];
+    uint64_t                  mask;
+    uint32_t                  overflows;
+    uint16_t                  head;
+    uint16_t                  tail;
+    uint8_t                   ep_count;
+    bool                      enabled;
+    /** @endcond */
+} nrfx_evt_capture_t;
+
+/**
+ * @brief Function for initializing a capture instance.
+ *
+ * @param[out] p_capture Pointer to the capture instance.
+ * @param[in]  p_config  Pointer to the structure with the configuration.
+ *
+ * @retval 0       Initialization was successful.
+ * @retval -EINVAL Invalid configuration.
+ */
+int nrfx_evt_capture_init(nrfx_evt_capture_t *              p_capture,
+                          nrfx_evt_capture_config_t const * p_config);
+
+/**
+ * @brief Function for uninitializing a capture instance.
+ *
+ * GPPI connections of all endpoints and GRTC channels allocated by the layer are freed.
+ *
+ * @param[in] p_capture Pointer to the capture instance.
+ */
+void nrfx_evt_capture_uninit(nrfx_evt_capture_t * p_capture);
+
+/**
+ * @brief Function for adding an endpoint.
+ *
+ * For a hardware endpoint, a GPPI connection between the event and the capture task
+ * of the channel is allocated. The connection is enabled by @ref nrfx_evt_capture_enable.
+ * The capture/compare channel must not be used for anything else. A GRTC channel
+ * is either allocated by the layer or must already be allocated by the user.
+ *
+ * @param[in] p_capture Pointer to the capture instance.
+ * @param[in] p_config  Pointer to the structure with the endpoint configuration.
+ *
+ * @return Index of the added endpoint or a negative error code.
+ *
+ * @retval -ENOMEM No free endpoint, no free GRTC channel or no GPPI resources available.
+ * @retval -EINVAL Invalid channel or reference endpoint, or GRTC channel not allocated.
+ */
+int nrfx_evt_capture_endpoint_add(nrfx_evt_capture_t *                       p_capture,
+                                  nrfx_evt_capture_endpoint_config_t const * p_config);
+
+/**
+ * @brief Function for enabling the GPPI connections of all hardware endpoints.
+ *
+ * @param[in] p_capture Pointer to the capture instance.
+ */
+void nrfx_evt_capture_enable(nrfx_evt_capture_t * p_capture);
+
+/**
+ * @brief Function for disabling the GPPI connections of all hardware endpoints.
+ *
+ * @param[in] p_capture Pointer to the capture instance.
+ */
+void nrfx_evt_capture_disable(nrfx_evt_capture_t * p_capture);
+
+/**
+ * @brief Function for collecting new captures of the hardware endpoints.
+ *
+ * A capture is registered when the value of the capture/compare channel of the endpoint
+ * differs from the previously collected one.
+ *
+ * @param[in] p_capture Pointer to the capture instance.
+ */
+void nrfx_evt_capture_process(nrfx_evt_capture_t * p_capture);
+
+/**
+ * @brief Function for capturing the current time on an endpoint.
+ *
+ * The capture task is triggered by the CPU and the timestamp is registered immediately.
+ *
+ * @param[in] p_capture Pointer to the capture instance.
+ * @param[in] endpoint  Index of the endpoint.
+ *
+ * @return Captured timestamp.
+ */
+uint64_t nrfx_evt_capture_trigger(nrfx_evt_capture_t * p_capture, uint8_t endpoint);
+
+/**
+ * @brief Function for reading timestamps from the ring.
+ *
+ * @param[in]  p_capture Pointer to the capture instance.
+ * @param[out] p_samples Pointer to the buffer for the timestamps.
+ * @param[in]  max_count Maximum number of timestamps to read.
+ *
+ * @return Number of timestamps read.
+ */
+uint16_t nrfx_evt_capture_read(nrfx_evt_capture_t *        p_capture,
+                               nrfx_evt_capture_sample_t * p_samples,
+                               uint16_t                    max_count);
+
+/**
+ * @brief Function for getting the number of timestamps dropped because the ring was full.
+ *
+ * @param[in] p_capture Pointer to the capture instance.
+ *
+ * @return Number of dropped timestamps.
+ */
+uint32_t nrfx_evt_capture_overflows_get(nrfx_evt_capture_t const * p_capture);
+
+/**
+ * @brief Function for getting the delta statistics of an endpoint.
+ *
+ * @param[in] p_capture Pointer to the capture instance.
+ * @param[in] endpoint  Index of the endpoint.
+ *
+ * @return Pointer to the statistics.
+ */
+nrfx_evt_capture_stats_t const * nrfx_evt_capture_stats_get(nrfx_evt_capture_t const * p_capture,
+                                                            uint8_t                    endpoint);
+
+/**
+ * @brief Function for clearing the statistics of all endpoints, the ring and the overflow count.
+ *
+ * @param[in] p_capture Pointer to the capture instance.
+ */
+void nrfx_evt_capture_stats_reset(nrfx_evt_capture_t * p_capture);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_EVT_CAPTURE_H__
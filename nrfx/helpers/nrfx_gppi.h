@@ -586,6 +586,52 @@ NRFX_STATIC_INLINE int nrfx_gppi_ext_conn_alloc(uint32_t producer, uint32_t cons
                                                 nrfx_gppi_resource_t * p_resource);
 #endif
 
+#ifndef NRFX_GPPI_PLAN_CONNS_MAX
+/** @brief Maximum number of connections in a single plan. Up to 32 connections are supported. */
+#define NRFX_GPPI_PLAN_CONNS_MAX 32
+#endif
+
+/** @brief A structure describing a connection requested in a plan. */
+typedef struct {
+    /** Domain that will produce (publish) events. */
+    uint32_t           producer;
+    /** Domain that will consume (subscribe to) events. */
+    uint32_t           consumer;
+    /** Handle of the allocated connection. Set by @ref nrfx_gppi_conn_plan_apply. */
+    nrfx_gppi_handle_t handle;
+} nrfx_gppi_conn_plan_t;
+
+/**
+ * @brief Function for allocating a set of connections at once.
+ *
+ * Connections allocated one by one get the first available channel which may exhaust channels
+ * needed by subsequent connections. Function computes channel assignment for all requested
+ * connections before allocating any resources and then claims the channels in a single critical
+ * section. Assignment is computed with interrupts enabled and it is computed again if channels
+ * were allocated by someone else in the meantime. If the assignment cannot be found or any of
+ * the connections cannot be set up then no resources are left allocated. It is intended to
+ * be called at initialization, before other connections are allocated.
+ *
+ * On systems with fixed connections between DPPI and PPIB (see @ref NRFX_GPPI_FIXED_CONNECTIONS)
+ * the search time grows exponentially in the worst case with the number of connections
+ * which share nodes.
+ *
+ * @note If @ref NRFX_GPPI_CONFIG_EXT_ALLOCATOR then function is not available.
+ *
+ * @param[in,out] p_conns Array of requested connections. Handles are filled on success.
+ * @param[in]     count   Number of connections in the array.
+ *
+ * @retval 0        All connections allocated.
+ * @retval -ENOMEM  There is no channel assignment that satisfies all connections.
+ * @retval -EINVAL  @p count exceeds @ref NRFX_GPPI_PLAN_CONNS_MAX or PPIB configuration failed.
+ * @retval -ENOTSUP Not supported. Supported only on multi domain system.
+ */
+#if NRFX_CHECK(NRFX_GPPI_MULTI_DOMAIN) || defined(__NRFX_DOXYGEN__)
+int nrfx_gppi_conn_plan_apply(nrfx_gppi_conn_plan_t * p_conns, size_t count);
+#else
+NRFX_STATIC_INLINE int nrfx_gppi_conn_plan_apply(nrfx_gppi_conn_plan_t * p_conns, size_t count);
+#endif
+
 #if NRFX_CHECK(NRFX_GPPI_CONFIG_DPPI_PPIB_EXT_FUNC)
 /**
  * @brief Function for writing to a PPIB register.
@@ -604,6 +650,204 @@ NRFX_STATIC_INLINE int nrfx_gppi_ext_conn_alloc(uint32_t producer, uint32_t cons
 int nrfx_gppi_ext_ppib_write(volatile uint32_t *p_addr, uint32_t value);
 #endif
 
+#ifndef NRFX_GPPI_FANOUT_BRANCHES_MAX
+/** @brief Maximum number of connections (branches) that form a single fan-out. */
+#define NRFX_GPPI_FANOUT_BRANCHES_MAX 4
+#endif
+
+/** @brief A structure describing a single connection that is a part of the fan-out. */
+typedef struct {
+    /** Connection handle. */
+    nrfx_gppi_handle_t handle;
+    /** Domain of the task endpoints attached to the connection. */
+    uint16_t           domain_id;
+    /** Number of task endpoints attached to the connection. */
+    uint8_t            tep_cnt;
+} nrfx_gppi_fanout_branch_t;
+
+/**
+ * @brief A structure describing a fan-out of an event to multiple tasks.
+ *
+ * Event is published only once. Task endpoints from the same domain share a connection and
+ * connections to other domains reuse the channel to which the event is published in the producer
+ * domain. Structure shall be initialized with @ref nrfx_gppi_fanout_init and must not be modified
+ * by the user afterwards.
+ */
+typedef struct {
+    /** Event endpoint address. */
+    uint32_t                  eep;
+    /** Connections used by the fan-out. */
+    nrfx_gppi_fanout_branch_t branches[NRFX_GPPI_FANOUT_BRANCHES_MAX];
+    /** Number of used connections. */
+    uint8_t                   branch_cnt;
+    /** Channel to which the event is published by a connection outside the fan-out. */
+    uint8_t                   eep_channel;
+    /** True if the event is published by a connection outside the fan-out. */
+    bool                      eep_shared;
+    /** True if fan-out is enabled. */
+    bool                      enabled;
+} nrfx_gppi_fanout_t;
+
+/**
+ * @brief Function for initializing a fan-out.
+ *
+ * No resources are allocated until the first task endpoint is added.
+ *
+ * @param[out] p_fanout Pointer to the fan-out structure.
+ * @param[in]  eep      Event endpoint address.
+ */
+void nrfx_gppi_fanout_init(nrfx_gppi_fanout_t * p_fanout, uint32_t eep);
+
+/**
+ * @brief Function for adding a task endpoint to the fan-out.
+ *
+ * Endpoint is attached to the existing connection if possible. Otherwise, a new connection is
+ * allocated and, in case of a multi domain DPPI, it reuses the channel to which the event is
+ * already published in the producer domain. If fan-out is enabled then new connection is
+ * enabled as well.
+ *
+ * On DPPI, the event may already be published by a connection which is not a part of
+ * the fan-out when the first task endpoint is added. Then the fan-out uses that channel:
+ * task endpoints in the producer domain are attached directly to it and connections to other
+ * domains reuse it. Such task endpoints follow the state of the channel, which is not changed
+ * by @ref nrfx_gppi_fanout_enable and @ref nrfx_gppi_fanout_disable, and the channel must
+ * remain allocated until all task endpoints are removed from the fan-out. On PPI, an event can
+ * be attached to multiple channels, so the fan-out always uses its own channels.
+ *
+ * @param[in] p_fanout Pointer to the fan-out structure.
+ * @param[in] tep      Task endpoint address.
+ *
+ * @retval 0       Task endpoint added.
+ * @retval -ENOMEM There is not enough resources to add the task endpoint.
+ * @retval -EINVAL @p tep is already configured to be used by the (D)PPI.
+ */
+int nrfx_gppi_fanout_tep_add(nrfx_gppi_fanout_t * p_fanout, uint32_t tep);
+
+/**
+ * @brief Function for removing a task endpoint from the fan-out.
+ *
+ * Connection is freed when the last task endpoint using it is removed. Connection which owns
+ * the channel in the producer domain is freed last.
+ *
+ * @param[in] p_fanout Pointer to the fan-out structure.
+ * @param[in] tep      Task endpoint address.
+ *
+ * @retval 0       Task endpoint removed.
+ * @retval -EINVAL @p tep is not a part of the fan-out.
+ */
+int nrfx_gppi_fanout_tep_remove(nrfx_gppi_fanout_t * p_fanout, uint32_t tep);
+
+/**
+ * @brief Function for enabling all connections of the fan-out.
+ *
+ * @param[in] p_fanout Pointer to the fan-out structure.
+ */
+void nrfx_gppi_fanout_enable(nrfx_gppi_fanout_t * p_fanout);
+
+/**
+ * @brief Function for disabling all connections of the fan-out.
+ *
+ * @param[in] p_fanout Pointer to the fan-out structure.
+ */
+void nrfx_gppi_fanout_disable(nrfx_gppi_fanout_t * p_fanout);
+
+#ifndef NRFX_GPPI_CHAIN_STEPS_MAX
+/** @brief Maximum number of steps in a single chain. */
+#define NRFX_GPPI_CHAIN_STEPS_MAX 8
+#endif
+
+/** @brief A structure describing a single step of the chain. */
+typedef struct {
+    /** Event endpoint address, for example from nrfx_*_event_address_get. */
+    uint32_t eep;
+    /** Task endpoint address, for example from nrfx_*_task_address_get. */
+    uint32_t tep;
+} nrfx_gppi_chain_step_t;
+
+/**
+ * @brief A structure describing a chain of peripherals.
+ *
+ * Chain is a sequence of steps in which an event of one peripheral triggers a task of
+ * the next one, for example TIMER COMPARE triggers SAADC SAMPLE and SAADC END triggers
+ * SPIM START. All steps are allocated and released together and the chain is started
+ * and stopped as a whole, so that peripherals are handing over to each other without
+ * CPU involvement. Structure shall be set up with @ref nrfx_gppi_chain_alloc and must
+ * not be modified by the user afterwards.
+ */
+typedef struct {
+    /** Steps of the chain. */
+    nrfx_gppi_chain_step_t steps[NRFX_GPPI_CHAIN_STEPS_MAX];
+    /** Connection handles of the steps. */
+    nrfx_gppi_handle_t     handles[NRFX_GPPI_CHAIN_STEPS_MAX];
+    /** Number of steps. */
+    uint8_t                step_cnt;
+} nrfx_gppi_chain_t;
+
+/**
+ * @brief Function for allocating connections for all steps of the chain.
+ *
+ * Either all connections are allocated or none. On multi domain systems channels for
+ * all steps are assigned at once (see @ref nrfx_gppi_conn_plan_apply), so that a step
+ * does not take a channel needed by a subsequent one.
+ *
+ * The chain does not change the interrupt settings of the peripherals. Only the driver
+ * of the last peripheral of the chain needs its interrupt to be enabled. Drivers of
+ * the preceding peripherals should be set up so that they do not interrupt the CPU
+ * on every pass of the chain, for example:
+ * - TIMER: @ref nrfx_timer_extended_compare with @p enable_int set to false,
+ * - SPIM: @ref NRFX_SPIM_FLAG_NO_XFER_EVT_HANDLER together with
+ *   @ref NRFX_SPIM_FLAG_HOLD_XFER and @ref NRFX_SPIM_FLAG_REPEATED_XFER,
+ * - TWIM: @ref NRFX_TWIM_FLAG_NO_XFER_EVT_HANDLER together with
+ *   @ref NRFX_TWIM_FLAG_HOLD_XFER and @ref NRFX_TWIM_FLAG_REPEATED_XFER.
+ *
+ * @note Event shared by multiple steps shall be distributed with @ref nrfx_gppi_fanout_t.
+ *       Such a chain is rejected, as is a step whose endpoint is used by another connection,
+ *       on both single and multi domain systems.
+ *
+ * @param[out] p_chain Pointer to the chain structure.
+ * @param[in]  p_steps Array of steps, starting with the head of the chain.
+ * @param[in]  count   Number of steps.
+ *
+ * @retval 0       All connections allocated.
+ * @retval -ENOMEM There is not enough resources to allocate the connections.
+ * @retval -EINVAL @p count exceeds @ref NRFX_GPPI_CHAIN_STEPS_MAX, an endpoint is already
+ *                 configured to be used by the (D)PPI, an event is used by more than one
+ *                 step or an endpoint cannot be attached to the connection.
+ */
+int nrfx_gppi_chain_alloc(nrfx_gppi_chain_t *            p_chain,
+                          nrfx_gppi_chain_step_t const * p_steps,
+                          size_t                         count);
+
+/**
+ * @brief Function for freeing all connections of the chain.
+ *
+ * Chain is disabled before connections are freed.
+ *
+ * @param[in] p_chain Pointer to the chain structure.
+ */
+void nrfx_gppi_chain_free(nrfx_gppi_chain_t * p_chain);
+
+/**
+ * @brief Function for enabling all connections of the chain.
+ *
+ * Connections are enabled in a single critical section, starting from the tail,
+ * so that an event propagating from the head never reaches a step which is
+ * not enabled yet.
+ *
+ * @param[in] p_chain Pointer to the chain structure.
+ */
+void nrfx_gppi_chain_enable(nrfx_gppi_chain_t * p_chain);
+
+/**
+ * @brief Function for disabling all connections of the chain.
+ *
+ * Connections are disabled in a single critical section, starting from the head,
+ * so that no new event enters the chain while the remaining steps are disabled.
+ *
+ * @param[in] p_chain Pointer to the chain structure.
+ */
+void nrfx_gppi_chain_disable(nrfx_gppi_chain_t * p_chain);
+
 #ifndef NRFX_DECLARE_ONLY
 #if !NRFX_CHECK(NRFX_GPPI_MULTI_DOMAIN)
 NRFX_STATIC_INLINE uint32_t nrfx_gppi_group_domain_id_get(nrfx_gppi_group_handle_t handle)
@@ -716,6 +960,13 @@ NRFX_STATIC_INLINE int nrfx_gppi_ext_conn_alloc(uint32_t producer, uint32_t cons
     (void)p_resource;
     return -ENOTSUP;
 }
+
+NRFX_STATIC_INLINE int nrfx_gppi_conn_plan_apply(nrfx_gppi_conn_plan_t * p_conns, size_t count)
+{
+    (void)p_conns;
+    (void)count;
+    return -ENOTSUP;
+}
 #endif
 #endif // NRFX_DECLARE_ONLY
 /** @} */
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if defined(PPI_PRESENT) || defined(DPPIC_PRESENT)
+#include <helpers/nrfx_gppi.h>
+
+static void steps_free(nrfx_gppi_chain_t * p_chain, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        nrfx_gppi_conn_free(p_chain->steps[i].eep, p_chain->steps[i].tep, p_chain->handles[i]);
+    }
+}
+
+/* Endpoints must not be used by other connections, also on PPI, where the connection
+ * allocation does not check it. An event shared by steps requires a fan-out.
+ */
+static int steps_check(nrfx_gppi_chain_t const * p_chain)
+{
+    for (size_t i = 0; i < p_chain->step_cnt; i++)
+    {
+        if ((nrfx_gppi_ep_channel_get(p_chain->steps[i].eep) >= 0) ||
+            (nrfx_gppi_ep_channel_get(p_chain->steps[i].tep) >= 0))
+        {
+            return -EINVAL;
+        }
+
+        for (size_t j = 0; j < i; j++)
+        {
+            if (p_chain->steps[j].eep == p_chain->steps[i].eep)
+            {
+                return -EINVAL;
+            }
+        }
+    }
+
+    return 0;
+}
+
+#if NRFX_CHECK(NRFX_GPPI_MULTI_DOMAIN)
+static int steps_alloc(nrfx_gppi_chain_t * p_chain)
+{
+    nrfx_gppi_conn_plan_t plan[NRFX_GPPI_CHAIN_STEPS_MAX];
+    int rv;
+
+    for (size_t i = 0; i < p_chain->step_cnt; i++)
+    {
+        plan[i].producer = nrfx_gppi_domain_id_get(p_chain->steps[i].eep);
+        plan[i].consumer = nrfx_gppi_domain_id_get(p_chain->steps[i].tep);
+    }
+
+    /* Channels for all steps are assigned together, so the allocation either succeeds
+     * for the whole chain or no resources are taken.
+     */
+    rv = nrfx_gppi_conn_plan_apply(plan, p_chain->step_cnt);
+    if (rv != 0)
+    {
+        return rv;
+    }
+
+    for (size_t i = 0; i < p_chain->step_cnt; i++)
+    {
+        p_chain->handles[i] = plan[i].handle;
+    }
+
+    for (size_t i = 0; i < p_chain->step_cnt; i++)
+    {
+        rv = nrfx_gppi_ep_attach(p_chain->steps[i].eep, plan[i].handle);
+        if (rv == 0)
+        {
+            rv = nrfx_gppi_ep_attach(p_chain->steps[i].tep, plan[i].handle);
+        }
+        if (rv != 0)
+        {
+            /* All connections are already allocated. Endpoints which are not attached yet
+             * were verified to be unused by steps_check(), so clearing them has no effect.
+             */
+            steps_free(p_chain, p_chain->step_cnt);
+            return rv;
+        }
+    }
+
+    return 0;
+}
+#else
+static int steps_alloc(nrfx_gppi_chain_t * p_chain)
+{
+    int rv;
+
+    for (size_t i = 0; i < p_chain->step_cnt; i++)
+    {
+        rv = nrfx_gppi_conn_alloc(p_chain->steps[i].eep, p_chain->steps[i].tep,
+                                  &p_chain->handles[i]);
+        if (rv != 0)
+        {
+            /* Roll back steps allocated so far. */
+            steps_free(p_chain, i);
+            return rv;
+        }
+    }
+
+    return 0;
+}
+#endif
+
+int nrfx_gppi_chain_alloc(nrfx_gppi_chain_t *            p_chain,
+                          nrfx_gppi_chain_step_t const * p_steps,
+                          size_t                         count)
+{
+    int rv;
+
+    NRFX_ASSERT(p_chain);
+    NRFX_ASSERT(p_steps || (count == 0));
+
+    if (count > NRFX_GPPI_CHAIN_STEPS_MAX)
+    {
+        return -EINVAL;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        p_chain->steps[i] = p_steps[i];
+    }
+    p_chain->step_cnt = (uint8_t)count;
+
+    rv = steps_check(p_chain);
+    if (rv == 0)
+    {
+        rv = steps_alloc(p_chain);
+    }
+    if (rv != 0)
+    {
+        p_chain->step_cnt = 0;
+    }
+
+    return rv;
+}
+
+void nrfx_gppi_chain_free(nrfx_gppi_chain_t * p_chain)
+{
+    NRFX_ASSERT(p_chain);
+
+    nrfx_gppi_chain_disable(p_chain);
+    steps_free(p_chain, p_chain->step_cnt);
+    p_chain->step_cnt = 0;
+}
+
+void nrfx_gppi_chain_enable(nrfx_gppi_chain_t * p_chain)
+{
+    NRFX_ASSERT(p_chain);
+
+    /* Head is enabled last so that an event entering the chain passes through all steps. */
+    NRFX_CRITICAL_SECTION_ENTER();
+    for (size_t i = p_chain->step_cnt; i > 0; i--)
+    {
+        nrfx_gppi_conn_enable(p_chain->handles[i - 1]);
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+void nrfx_gppi_chain_disable(nrfx_gppi_chain_t * p_chain)
+{
+    NRFX_ASSERT(p_chain);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    for (size_t i = 0; i < p_chain->step_cnt; i++)
+    {
+        nrfx_gppi_conn_disable(p_chain->handles[i]);
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+#endif // defined(PPI_PRESENT) || defined(DPPIC_PRESENT)
@@ -69,9 +69,10 @@
 #define DPPI_ROUTE_OFF (DPPI_REV_OFF + DPPI_REV_BITS)
 #define DPPI_ROUTE_BITS 6
 
-#define DPPI_RESERVED_BITS 1
+#define DPPI_SHARED_OFF (DPPI_ROUTE_OFF + DPPI_ROUTE_BITS)
+#define DPPI_SHARED_BITS 1
 
-#define DPPI_TOTAL_BITS (DPPI_RESERVED_BITS + DPPI_ROUTE_BITS + DPPI_REV_BITS + \
+#define DPPI_TOTAL_BITS (DPPI_SHARED_BITS + DPPI_ROUTE_BITS + DPPI_REV_BITS + \
                          DPPI_CH_BITS + DPPI_INST_CNT_BITS + DPPI_INST_BITS + DPPI_EXT_BITS)
 NRFX_STATIC_ASSERT(DPPI_TOTAL_BITS == 32);
 
@@ -98,6 +99,14 @@ NRFX_STATIC_ASSERT(DPPI_TOTAL_BITS == 32);
 /* Determine if handle has reversed route. */
 #define HANDLE_IS_REVERSED(handle) (handle & NRFX_BIT(DPPI_REV_OFF))
 
+/* Determine if the channel in the producer domain is owned by another connection. */
+#define HANDLE_IS_SHARED(handle) ((handle) & NRFX_BIT(DPPI_SHARED_OFF))
+
+/* Index of the producer node in the route. */
+#define HANDLE_PRODUCER_IDX(handle, len) (HANDLE_IS_REVERSED(handle) ? ((len) - 1) : 0)
+
+#define HANDLE_SHARED NRFX_BIT(DPPI_SHARED_OFF)
+
 #define HANDLE_INIT(route_id, rev, dppi_cnt, fixed_ch)                \
     ((route_id) << DPPI_ROUTE_OFF) |                    \
     ((rev) ? NRFX_BIT(DPPI_REV_OFF) : 0) |                        \
@@ -136,6 +145,11 @@ NRFX_STATIC_ASSERT(DPPI_TOTAL_BITS == 32);
 #define HANDLE_INIT(route_id, rev, dppi_cnt, fixed_ch)                \
     ((route_id) << DPPI_ROUTE_OFF) | (rev ? NRFX_BIT(DPPI_REV_OFF) : 0)
 
+/* Not used, the shared channel is marked as reserved in the handle. */
+#define HANDLE_IS_SHARED(handle) 0
+#define HANDLE_PRODUCER_IDX(handle, len) 0
+#define HANDLE_SHARED 0
+
 #endif /* NRFX_GPPI_FIXED_CONNECTIONS */
 
 #define GHANDLE_CHAN_OFF 0
@@ -160,11 +174,12 @@ NRFX_STATIC_ASSERT(DPPI_TOTAL_BITS == 32);
  *  There is fixed channel but local domain has no access to routes so need to
  *  know which DPPIC instances belong to route (max 3).
  *
- * ---------------------------------------------------------------------------------------------
- * | Route ID 6b | Reversed 1b | ch 6b | dppi_cnt 3b | dppi2 5b | dppi1 5b | ddpi0 5b | ext 1b |
- * ---------------------------------------------------------------------------------------------
+ * -----------------------------------------------------------------------------------------------------------
+ * | Shared 1b | Route ID 6b | Reversed 1b | ch 5b | dppi_cnt 3b | dppi2 5b | dppi1 5b | ddpi0 5b | ext 1b |
+ * -----------------------------------------------------------------------------------------------------------
  *
- * sec bit indicates whether handle is managed by SDFW
+ * ext bit indicates whether handle is managed by SDFW
+ * shared bit indicates that the channel in the producer DPPIC is owned by another connection
  */
 
 static nrfx_gppi_t * p_gppi;
@@ -202,13 +217,9 @@ static uint32_t alloc_bit_locked(nrfx_atomic_t *mask)
     return rv;
 }
 
-static int alloc_channels(uint8_t * p_channels, const nrfx_gppi_route_t * p_route,
-                          nrfx_gppi_resource_t * p_resource)
+static int alloc_channels_locked(uint8_t * p_channels, const nrfx_gppi_route_t * p_route,
+                                 nrfx_gppi_resource_t * p_resource)
 {
-    int rv = 0;
-
-    NRFX_CRITICAL_SECTION_ENTER();
-
     if (NRFX_IS_ENABLED(NRFX_GPPI_FIXED_CONNECTIONS))
     {
         /* In nRF54H20 connections between channels in DPPI and PPIB are fixed which means that
@@ -219,19 +230,34 @@ static int alloc_channels(uint8_t * p_channels, const nrfx_gppi_route_t * p_rout
 
         for (size_t i = 0; i < p_route->len; i++)
         {
-            mask &= *p_route->p_nodes[i]->generic.p_channels;
+            const nrfx_gppi_node_t * p_node = p_route->p_nodes[i];
+
+            if ((p_resource == NULL) || (p_resource->domain_id != p_node->domain_id))
+            {
+                mask &= *p_node->generic.p_channels;
+            }
+        }
+
+        /* The channel of the external resource must be available in the remaining nodes. */
+        if (p_resource)
+        {
+            mask &= NRFX_BIT(p_resource->channel);
         }
 
         if (!mask)
         {
-            rv = -ENOMEM;
-            goto unlock;
+            return -ENOMEM;
         }
 
         ch = 31 - NRFX_CLZ(mask);
         for (size_t i = 0; i < p_route->len; i++)
         {
-            *p_route->p_nodes[i]->generic.p_channels &= ~NRFX_BIT(ch);
+            const nrfx_gppi_node_t * p_node = p_route->p_nodes[i];
+
+            if ((p_resource == NULL) || (p_resource->domain_id != p_node->domain_id))
+            {
+                *p_node->generic.p_channels &= ~NRFX_BIT(ch);
+            }
         }
 
         p_channels[0] = (uint8_t)ch;
@@ -246,8 +272,7 @@ static int alloc_channels(uint8_t * p_channels, const nrfx_gppi_route_t * p_rout
 
             if (check && (*p_node->generic.p_channels == 0))
             {
-                rv = -ENOMEM;
-                goto unlock;
+                return -ENOMEM;
             }
         }
         for (size_t i = 0; i < p_route->len; i++)
@@ -265,13 +290,32 @@ static int alloc_channels(uint8_t * p_channels, const nrfx_gppi_route_t * p_rout
             }
         }
     }
-unlock:
 
+    return 0;
+}
+
+static int alloc_channels(uint8_t * p_channels, const nrfx_gppi_route_t * p_route,
+                          nrfx_gppi_resource_t * p_resource)
+{
+    int rv;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    rv = alloc_channels_locked(p_channels, p_route, p_resource);
     NRFX_CRITICAL_SECTION_EXIT();
 
     return rv;
 }
 
+static void free_channels_locked(uint8_t const * p_channels, const nrfx_gppi_route_t * p_route)
+{
+    for (size_t i = 0; i < p_route->len; i++)
+    {
+        uint8_t ch = p_channels[NRFX_IS_ENABLED(NRFX_GPPI_FIXED_CONNECTIONS) ? 0 : i];
+
+        *p_route->p_nodes[i]->generic.p_channels |= NRFX_BIT(ch);
+    }
+}
+
 static inline uint32_t get_ppi_ch(bool pub, uint8_t * p_channels, size_t i, bool rev)
 {
     if (NRFX_IS_ENABLED(NRFX_GPPI_FIXED_CONNECTIONS)) {
@@ -365,30 +409,50 @@ void nrfx_gppi_group_channel_free(uint32_t node_id, uint8_t channel)
     flag_free(p_node->dppi.p_group_channels, (uint8_t)channel);
 }
 
-int nrfx_gppi_ext_conn_alloc(uint32_t producer, uint32_t consumer, nrfx_gppi_handle_t * p_handle,
-                             nrfx_gppi_resource_t * p_resource)
+static const nrfx_gppi_route_t * route_get(uint32_t producer, uint32_t consumer, bool * p_rev)
 {
-    NRFX_ASSERT(p_gppi != NULL);
-    uint8_t channels[DPPI_CH_MAX_CNT];
-    const nrfx_gppi_route_t * p_route;
-    uint32_t h;
-    int rv = 0;
-    uint8_t route_idx;
-    bool rev_conn;
-
     if (producer > consumer) {
-        rev_conn = true;
-        p_route = p_gppi->route_map[consumer][producer - consumer];
-    } else {
-        rev_conn = false;
-        p_route = p_gppi->route_map[producer][consumer - producer];
+        *p_rev = true;
+        return p_gppi->route_map[consumer][producer - consumer];
     }
 
-    /* Return is allocation failed. */
-    rv = alloc_channels(channels, p_route, p_resource);
-    if (rv < 0) {
-        return rv;
+    *p_rev = false;
+    return p_gppi->route_map[producer][consumer - producer];
+}
+
+static bool ppib_rev_get(const nrfx_gppi_route_t * p_route, size_t i, bool rev_conn)
+{
+    if (NRFX_IS_ENABLED(NRFX_GPPI_FIXED_CONNECTIONS))
+    {
+        return (p_route->p_nodes[i - 1]->domain_id < p_route->p_nodes[i + 1]->domain_id) ?
+                rev_conn : !rev_conn;
+    }
+
+    return rev_conn;
+}
+
+/* Clear the PPIB channels configured for the first /p count nodes of the route. */
+static void conn_ppib_clear(uint8_t const * channels, const nrfx_gppi_route_t * p_route,
+                            bool rev_conn, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        const nrfx_gppi_node_t * p_node = p_route->p_nodes[i];
+
+        if (p_node->type == NRFX_GPPI_NODE_PPIB) {
+            uint32_t ch = channels[NRFX_IS_ENABLED(NRFX_GPPI_FIXED_CONNECTIONS) ? 0 : i];
+
+            (void)ppib_configure(p_node, ch, 0, 0, ppib_rev_get(p_route, i, rev_conn));
+        }
     }
+}
+
+static int conn_setup(uint32_t producer, uint32_t consumer, uint8_t * channels,
+                      const nrfx_gppi_route_t * p_route, bool rev_conn,
+                      nrfx_gppi_resource_t * p_resource, nrfx_gppi_handle_t * p_handle)
+{
+    uint32_t h;
+    int rv;
+    uint8_t route_idx;
 
     route_idx = (uint8_t)(((uintptr_t)p_route - (uintptr_t)p_gppi->routes) /
                 sizeof(nrfx_gppi_route_t));
@@ -396,29 +460,23 @@ int nrfx_gppi_ext_conn_alloc(uint32_t producer, uint32_t consumer, nrfx_gppi_han
         producer, consumer, route_idx, p_route->len, rev_conn ? "reversed" : "");
 
     h = HANDLE_INIT(route_idx, rev_conn, (uint32_t)NRFX_DIV_ROUND_UP(p_route->len, 2), channels[0]);
+    if (NRFX_IS_ENABLED(NRFX_GPPI_FIXED_CONNECTIONS) && p_resource)
+    {
+        h |= HANDLE_SHARED;
+    }
     for (size_t i = 0; i < p_route->len; i++) {
         const nrfx_gppi_node_t * p_node = p_route->p_nodes[i];
 
         if (p_node->type == NRFX_GPPI_NODE_PPIB) {
             uint32_t ch = channels[NRFX_IS_ENABLED(NRFX_GPPI_FIXED_CONNECTIONS) ? 0 : i];
-            uint32_t sub_ch;
-            uint32_t pub_ch;
-            bool rev;
+            bool rev = ppib_rev_get(p_route, i, rev_conn);
+            uint32_t sub_ch = get_ppi_ch(false, channels, i, rev);
+            uint32_t pub_ch = get_ppi_ch(true, channels, i, rev);
 
-            if (NRFX_IS_ENABLED(NRFX_GPPI_FIXED_CONNECTIONS))
-            {
-                rev = (p_route->p_nodes[i - 1]->domain_id < p_route->p_nodes[i + 1]->domain_id) ?
-                        rev_conn : !rev_conn;
-            }
-            else
-            {
-                rev = rev_conn;
-            }
-
-            sub_ch = get_ppi_ch(false, channels, i, rev);
-            pub_ch = get_ppi_ch(true, channels, i, rev);
             rv = ppib_configure(p_node, ch, EP_ENABLE(sub_ch), EP_ENABLE(pub_ch), rev);
             if (rv != 0) {
+                /* Do not leave a partially configured route behind. */
+                conn_ppib_clear(channels, p_route, rev_conn, i);
                 return rv;
             }
         } else if (NRFX_IS_ENABLED(NRFX_GPPI_FIXED_CONNECTIONS)) {
@@ -440,6 +498,31 @@ int nrfx_gppi_ext_conn_alloc(uint32_t producer, uint32_t consumer, nrfx_gppi_han
     *p_handle = h;
     NRFX_LOG_INFO("Alloc done, handle:%08x route:%d", h, route_idx);
 
+    return 0;
+}
+
+int nrfx_gppi_ext_conn_alloc(uint32_t producer, uint32_t consumer, nrfx_gppi_handle_t * p_handle,
+                             nrfx_gppi_resource_t * p_resource)
+{
+    NRFX_ASSERT(p_gppi != NULL);
+    uint8_t channels[DPPI_CH_MAX_CNT];
+    const nrfx_gppi_route_t * p_route;
+    int rv = 0;
+    bool rev_conn;
+
+    p_route = route_get(producer, consumer, &rev_conn);
+
+    /* Return is allocation failed. */
+    rv = alloc_channels(channels, p_route, p_resource);
+    if (rv < 0) {
+        return rv;
+    }
+
+    rv = conn_setup(producer, consumer, channels, p_route, rev_conn, p_resource, p_handle);
+    if (rv != 0) {
+        return rv;
+    }
+
 #if NRFX_CHECK(NRFX_GPPI_CONFIG_DPPI_PPIB_EXT_FUNC)
     /* Flush external PPIB write operations. */
     return nrfx_gppi_ext_ppib_write(NULL, 0);
@@ -448,6 +531,263 @@ int nrfx_gppi_ext_conn_alloc(uint32_t producer, uint32_t consumer, nrfx_gppi_han
 #endif
 }
 
+#if NRFX_CHECK(NRFX_GPPI_FIXED_CONNECTIONS)
+NRFX_STATIC_ASSERT(NRFX_GPPI_PLAN_CONNS_MAX <= 32);
+
+static uint32_t bits_count(uint32_t mask)
+{
+    uint32_t cnt = 0;
+
+    while (mask)
+    {
+        mask &= mask - 1;
+        cnt++;
+    }
+
+    return cnt;
+}
+
+static bool routes_overlap(const nrfx_gppi_route_t * p_a, const nrfx_gppi_route_t * p_b)
+{
+    for (size_t i = 0; i < p_a->len; i++)
+    {
+        for (size_t j = 0; j < p_b->len; j++)
+        {
+            if (p_a->p_nodes[i] == p_b->p_nodes[j])
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/* With fixed connections a connection needs the same channel in all nodes of its route, so
+ * channel assignment is a coloring of the graph in which connections sharing a node are
+ * adjacent. Depth-first search with backtracking, starting from the most constrained connection.
+ * The search works on a snapshot of the channel masks and does not claim any channel, so it is
+ * done with interrupts enabled.
+ */
+static int plan_solve(const nrfx_gppi_route_t ** pp_routes, size_t count,
+                      uint8_t (*p_channels)[DPPI_CH_MAX_CNT])
+{
+    uint32_t cand[NRFX_GPPI_PLAN_CONNS_MAX];
+    uint32_t conflicts[NRFX_GPPI_PLAN_CONNS_MAX];
+    uint32_t tried[NRFX_GPPI_PLAN_CONNS_MAX];
+    uint8_t order[NRFX_GPPI_PLAN_CONNS_MAX];
+    size_t depth = 0;
+
+    for (size_t k = 0; k < count; k++)
+    {
+        cand[k] = UINT32_MAX;
+        for (size_t i = 0; i < pp_routes[k]->len; i++)
+        {
+            cand[k] &= *pp_routes[k]->p_nodes[i]->generic.p_channels;
+        }
+        if (cand[k] == 0)
+        {
+            return -ENOMEM;
+        }
+
+        conflicts[k] = 0;
+        for (size_t j = 0; j < count; j++)
+        {
+            if ((j != k) && routes_overlap(pp_routes[k], pp_routes[j]))
+            {
+                conflicts[k] |= NRFX_BIT(j);
+            }
+        }
+    }
+
+    /* Order by the number of candidate channels and then by the number of conflicts. */
+    for (size_t k = 0; k < count; k++)
+    {
+        size_t j = k;
+
+        while ((j > 0) &&
+               ((bits_count(cand[order[j - 1]]) > bits_count(cand[k])) ||
+                ((bits_count(cand[order[j - 1]]) == bits_count(cand[k])) &&
+                 (bits_count(conflicts[order[j - 1]]) < bits_count(conflicts[k])))))
+        {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = (uint8_t)k;
+    }
+
+    tried[0] = 0;
+    while (depth < count)
+    {
+        size_t k = order[depth];
+        uint32_t mask = cand[k] & ~tried[depth];
+        uint32_t ch;
+
+        for (size_t d = 0; d < depth; d++)
+        {
+            if (conflicts[k] & NRFX_BIT(order[d]))
+            {
+                mask &= ~NRFX_BIT(p_channels[order[d]][0]);
+            }
+        }
+
+        if (mask == 0)
+        {
+            if (depth == 0)
+            {
+                return -ENOMEM;
+            }
+            depth--;
+            continue;
+        }
+
+        ch = 31 - NRFX_CLZ(mask);
+        p_channels[k][0] = (uint8_t)ch;
+        tried[depth] |= NRFX_BIT(ch);
+        if (++depth < count)
+        {
+            tried[depth] = 0;
+        }
+    }
+
+    return 0;
+}
+
+/* Claim the channels found by plan_solve(). Returns -EAGAIN if any of them was taken
+ * in the meantime, in which case nothing is claimed.
+ */
+static int plan_claim_locked(const nrfx_gppi_route_t ** pp_routes, size_t count,
+                             uint8_t (*p_channels)[DPPI_CH_MAX_CNT])
+{
+    for (size_t k = 0; k < count; k++)
+    {
+        for (size_t i = 0; i < pp_routes[k]->len; i++)
+        {
+            if (!(*pp_routes[k]->p_nodes[i]->generic.p_channels & NRFX_BIT(p_channels[k][0])))
+            {
+                return -EAGAIN;
+            }
+        }
+    }
+
+    for (size_t k = 0; k < count; k++)
+    {
+        for (size_t i = 0; i < pp_routes[k]->len; i++)
+        {
+            *pp_routes[k]->p_nodes[i]->generic.p_channels &= ~NRFX_BIT(p_channels[k][0]);
+        }
+    }
+
+    return 0;
+}
+#else
+/* Channels are allocated independently in each node so the order of allocation does not
+ * matter and no search is needed.
+ */
+static int plan_solve(const nrfx_gppi_route_t ** pp_routes, size_t count,
+                      uint8_t (*p_channels)[DPPI_CH_MAX_CNT])
+{
+    (void)pp_routes;
+    (void)count;
+    (void)p_channels;
+
+    return 0;
+}
+
+/* Allocation is reverted if any of the connections cannot be allocated. */
+static int plan_claim_locked(const nrfx_gppi_route_t ** pp_routes, size_t count,
+                             uint8_t (*p_channels)[DPPI_CH_MAX_CNT])
+{
+    for (size_t k = 0; k < count; k++)
+    {
+        int rv = alloc_channels_locked(p_channels[k], pp_routes[k], NULL);
+
+        if (rv < 0)
+        {
+            while (k-- > 0)
+            {
+                free_channels_locked(p_channels[k], pp_routes[k]);
+            }
+            return rv;
+        }
+    }
+
+    return 0;
+}
+#endif
+
+int nrfx_gppi_conn_plan_apply(nrfx_gppi_conn_plan_t * p_conns, size_t count)
+{
+    NRFX_ASSERT(p_gppi != NULL);
+    NRFX_ASSERT(p_conns);
+    const nrfx_gppi_route_t * routes[NRFX_GPPI_PLAN_CONNS_MAX];
+    uint8_t channels[NRFX_GPPI_PLAN_CONNS_MAX][DPPI_CH_MAX_CNT];
+    bool rev_conn[NRFX_GPPI_PLAN_CONNS_MAX];
+    int rv;
+
+    if (count > NRFX_GPPI_PLAN_CONNS_MAX)
+    {
+        return -EINVAL;
+    }
+
+    for (size_t k = 0; k < count; k++)
+    {
+        routes[k] = route_get(p_conns[k].producer, p_conns[k].consumer, &rev_conn[k]);
+    }
+
+    /* Only claiming the channels is done in the critical section. If channels were taken by
+     * another allocation while the assignment was being computed, it is computed again.
+     */
+    do {
+        rv = plan_solve(routes, count, channels);
+        if (rv < 0)
+        {
+            return rv;
+        }
+
+        NRFX_CRITICAL_SECTION_ENTER();
+        rv = plan_claim_locked(routes, count, channels);
+        NRFX_CRITICAL_SECTION_EXIT();
+    } while (rv == -EAGAIN);
+
+    if (rv < 0)
+    {
+        return rv;
+    }
+
+    for (size_t k = 0; k < count; k++)
+    {
+        rv = conn_setup(p_conns[k].producer, p_conns[k].consumer, channels[k], routes[k],
+                        rev_conn[k], NULL, &p_conns[k].handle);
+        if (rv != 0)
+        {
+            /* Connections set up so far are freed together with their channels and channels
+             * of the remaining connections are released, so that nothing is allocated.
+             */
+            for (size_t j = 0; j < k; j++)
+            {
+                nrfx_gppi_domain_conn_free(p_conns[j].handle);
+            }
+            NRFX_CRITICAL_SECTION_ENTER();
+            for (size_t j = k; j < count; j++)
+            {
+                free_channels_locked(channels[j], routes[j]);
+            }
+            NRFX_CRITICAL_SECTION_EXIT();
+            break;
+        }
+    }
+
+#if NRFX_CHECK(NRFX_GPPI_CONFIG_DPPI_PPIB_EXT_FUNC)
+    /* Flush external PPIB write operations. */
+    int flush_rv = nrfx_gppi_ext_ppib_write(NULL, 0);
+
+    return (rv != 0) ? rv : flush_rv;
+#else
+    return rv;
+#endif
+}
+
 #endif // !NRFX_GPPI_CONFIG_EXT_ALLOCATOR
 
 int nrfx_gppi_domain_conn_alloc(uint32_t producer, uint32_t consumer,
@@ -486,6 +826,11 @@ void nrfx_gppi_domain_conn_free(nrfx_gppi_handle_t handle)
             (void)rv;
             NRFX_ASSERT(rv == 0);
         }
+        if (HANDLE_IS_SHARED(handle) && (i == HANDLE_PRODUCER_IDX(handle, p_route->len)))
+        {
+            /* Channel is owned by another connection. */
+            continue;
+        }
         if (chan != DPPI_CH_RESERVED)
         {
             flag_free(p_node->generic.p_channels, (uint8_t)chan);
@@ -596,7 +941,8 @@ static NRF_DPPIC_Type *dppi_reg_get(uint32_t domain_id)
     _ch = HANDLE_GET_CHAN(_handle, 0);                                                            \
     for (i = 0, _d_id = HANDLE_GET_DPPI_ID(_handle, 0), _reg = dppi_reg_get(d_id);                \
          i < cnt;                                                                                 \
-         i++, _d_id = HANDLE_GET_DPPI_ID(_handle, i), _reg = i < cnt ? dppi_reg_get(_d_id) : NULL)
+         i++, _d_id = HANDLE_GET_DPPI_ID(_handle, i), _reg = i < cnt ? dppi_reg_get(_d_id) : NULL) \
+         if (!HANDLE_IS_SHARED(_handle) || (i != HANDLE_PRODUCER_IDX(_handle, cnt)))
 #elif defined(NRFX_GPPI_MULTI_DOMAIN)
 #define FOR_EACH_DPPI(_gppi, _handle, _ch, _reg, _d_id)                                           \
     const nrfx_gppi_route_t *_route = &_gppi->routes[HANDLE_GET_ROUTE_ID(_handle)];               \
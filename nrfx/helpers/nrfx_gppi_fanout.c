@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+#include <nrfx.h>
+
+#if defined(PPI_PRESENT) || defined(DPPIC_PRESENT)
+#include <helpers/nrfx_gppi.h>
+
+#if defined(PPI_PRESENT)
+/* On PPI an event is attached to each channel used by the fan-out. */
+#define FANOUT_HAS_ROOT 0
+#else
+/* On DPPI an event is published to a single channel owned by the first connection (root). */
+#define FANOUT_HAS_ROOT 1
+#endif
+
+static bool branch_owns_eep(nrfx_gppi_fanout_t const * p_fanout,
+                            nrfx_gppi_fanout_branch_t const * p_branch)
+{
+    return !FANOUT_HAS_ROOT ||
+           (!p_fanout->eep_shared && (p_branch == &p_fanout->branches[0]));
+}
+
+/* Task endpoints in the producer domain are attached directly to the channel of the connection
+ * that publishes the event outside the fan-out, so such a branch has no connection. */
+static bool branch_is_direct(nrfx_gppi_fanout_t const * p_fanout,
+                             nrfx_gppi_fanout_branch_t const * p_branch)
+{
+    return p_fanout->eep_shared &&
+           (p_branch->domain_id == nrfx_gppi_domain_id_get(p_fanout->eep));
+}
+
+static int branch_channel_get(nrfx_gppi_fanout_t const * p_fanout,
+                              nrfx_gppi_fanout_branch_t const * p_branch)
+{
+    if (branch_is_direct(p_fanout, p_branch))
+    {
+        return p_fanout->eep_channel;
+    }
+
+    return nrfx_gppi_domain_channel_get(p_branch->handle, p_branch->domain_id);
+}
+
+static int branch_tep_attach(nrfx_gppi_fanout_t const * p_fanout,
+                             nrfx_gppi_fanout_branch_t const * p_branch,
+                             uint32_t tep)
+{
+    if (branch_is_direct(p_fanout, p_branch))
+    {
+        return nrfx_gppi_ep_to_ch_attach(tep, p_fanout->eep_channel);
+    }
+
+    return nrfx_gppi_ep_attach(tep, p_branch->handle);
+}
+
+static int branch_alloc(nrfx_gppi_fanout_t * p_fanout, uint32_t consumer)
+{
+    uint32_t producer = nrfx_gppi_domain_id_get(p_fanout->eep);
+    nrfx_gppi_fanout_branch_t * p_branch;
+    nrfx_gppi_handle_t handle;
+    int rv;
+
+    if (p_fanout->branch_cnt == NRFX_GPPI_FANOUT_BRANCHES_MAX)
+    {
+        return -ENOMEM;
+    }
+
+    if (p_fanout->eep_shared && (consumer == producer))
+    {
+        /* Channel in the producer domain is used directly. */
+        handle = 0;
+        rv = 0;
+    }
+    else if (FANOUT_HAS_ROOT && (p_fanout->eep_shared || (p_fanout->branch_cnt > 0)))
+    {
+        nrfx_gppi_resource_t resource = {
+            .domain_id = (uint16_t)producer,
+            .channel   = p_fanout->eep_shared ?
+                         p_fanout->eep_channel :
+                         (uint8_t)nrfx_gppi_domain_channel_get(p_fanout->branches[0].handle,
+                                                               producer),
+        };
+
+        rv = nrfx_gppi_ext_conn_alloc(producer, consumer, &handle, &resource);
+    }
+    else
+    {
+        rv = nrfx_gppi_domain_conn_alloc(producer, consumer, &handle);
+        if (rv == 0)
+        {
+            rv = nrfx_gppi_ep_attach(p_fanout->eep, handle);
+            if (rv < 0)
+            {
+                nrfx_gppi_domain_conn_free(handle);
+            }
+        }
+    }
+
+    if (rv < 0)
+    {
+        return rv;
+    }
+
+    p_branch = &p_fanout->branches[p_fanout->branch_cnt++];
+    p_branch->handle    = handle;
+    p_branch->domain_id = (uint16_t)consumer;
+    p_branch->tep_cnt   = 0;
+
+    if (p_fanout->enabled && !branch_is_direct(p_fanout, p_branch))
+    {
+        nrfx_gppi_conn_enable(handle);
+    }
+
+    return 0;
+}
+
+static void branch_free(nrfx_gppi_fanout_t * p_fanout, nrfx_gppi_fanout_branch_t * p_branch)
+{
+    uint32_t producer = nrfx_gppi_domain_id_get(p_fanout->eep);
+
+    if (branch_is_direct(p_fanout, p_branch))
+    {
+        return;
+    }
+
+    nrfx_gppi_conn_disable(p_branch->handle);
+    if (branch_owns_eep(p_fanout, p_branch))
+    {
+        int ch = nrfx_gppi_domain_channel_get(p_branch->handle, producer);
+
+        nrfx_gppi_ep_ch_clear(p_fanout->eep, (uint8_t)ch);
+    }
+    nrfx_gppi_domain_conn_free(p_branch->handle);
+}
+
+/* Free connections without task endpoints. Root is freed only if it is the last connection. */
+static void branches_release(nrfx_gppi_fanout_t * p_fanout)
+{
+    size_t i = p_fanout->branch_cnt;
+
+    while (i-- > 0)
+    {
+        nrfx_gppi_fanout_branch_t * p_branch = &p_fanout->branches[i];
+
+        if ((p_branch->tep_cnt > 0) ||
+            (FANOUT_HAS_ROOT && !p_fanout->eep_shared && (i == 0) &&
+             (p_fanout->branch_cnt > 1)))
+        {
+            continue;
+        }
+
+        branch_free(p_fanout, p_branch);
+        *p_branch = p_fanout->branches[--p_fanout->branch_cnt];
+    }
+}
+
+static nrfx_gppi_fanout_branch_t * branch_find(nrfx_gppi_fanout_t * p_fanout, uint32_t tep)
+{
+    uint32_t domain_id = nrfx_gppi_domain_id_get(tep);
+    int ch = nrfx_gppi_ep_channel_get(tep);
+
+    if (ch < 0)
+    {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < p_fanout->branch_cnt; i++)
+    {
+        nrfx_gppi_fanout_branch_t * p_branch = &p_fanout->branches[i];
+
+        if ((p_branch->domain_id == domain_id) && (p_branch->tep_cnt > 0) &&
+            (branch_channel_get(p_fanout, p_branch) == ch))
+        {
+            return p_branch;
+        }
+    }
+
+    return NULL;
+}
+
+void nrfx_gppi_fanout_init(nrfx_gppi_fanout_t * p_fanout, uint32_t eep)
+{
+    NRFX_ASSERT(p_fanout);
+
+    p_fanout->eep        = eep;
+    p_fanout->branch_cnt  = 0;
+    p_fanout->eep_channel = 0;
+    p_fanout->eep_shared  = false;
+    p_fanout->enabled     = false;
+}
+
+int nrfx_gppi_fanout_tep_add(nrfx_gppi_fanout_t * p_fanout, uint32_t tep)
+{
+    uint32_t consumer = nrfx_gppi_domain_id_get(tep);
+    int rv;
+
+    NRFX_ASSERT(p_fanout);
+
+    if (nrfx_gppi_ep_channel_get(tep) >= 0)
+    {
+        return -EINVAL;
+    }
+
+    if (FANOUT_HAS_ROOT && (p_fanout->branch_cnt == 0))
+    {
+        int ch = nrfx_gppi_ep_channel_get(p_fanout->eep);
+
+        /* If the event is already published by a connection outside the fan-out, its channel
+         * is used instead of a root connection. Otherwise, the root connection publishes
+         * the event in the producer domain. */
+        p_fanout->eep_shared = (ch >= 0);
+        if (p_fanout->eep_shared)
+        {
+            p_fanout->eep_channel = (uint8_t)ch;
+        }
+        else
+        {
+            rv = branch_alloc(p_fanout, nrfx_gppi_domain_id_get(p_fanout->eep));
+            if (rv < 0)
+            {
+                return rv;
+            }
+        }
+    }
+
+    /* Reuse existing connection if task endpoint can be attached to it. */
+    for (size_t i = 0; i < p_fanout->branch_cnt; i++)
+    {
+        nrfx_gppi_fanout_branch_t * p_branch = &p_fanout->branches[i];
+
+        if ((p_branch->domain_id == consumer) &&
+            (branch_tep_attach(p_fanout, p_branch, tep) == 0))
+        {
+            p_branch->tep_cnt++;
+            return 0;
+        }
+    }
+
+    rv = branch_alloc(p_fanout, consumer);
+    if (rv == 0)
+    {
+        nrfx_gppi_fanout_branch_t * p_branch = &p_fanout->branches[p_fanout->branch_cnt - 1];
+
+        rv = branch_tep_attach(p_fanout, p_branch, tep);
+        if (rv == 0)
+        {
+            p_branch->tep_cnt++;
+            return 0;
+        }
+    }
+
+    branches_release(p_fanout);
+    return rv;
+}
+
+int nrfx_gppi_fanout_tep_remove(nrfx_gppi_fanout_t * p_fanout, uint32_t tep)
+{
+    nrfx_gppi_fanout_branch_t * p_branch;
+    int ch;
+
+    NRFX_ASSERT(p_fanout);
+
+    p_branch = branch_find(p_fanout, tep);
+    if (p_branch == NULL)
+    {
+        return -EINVAL;
+    }
+
+    ch = branch_channel_get(p_fanout, p_branch);
+    nrfx_gppi_ep_ch_clear(tep, (uint8_t)ch);
+    p_branch->tep_cnt--;
+    branches_release(p_fanout);
+
+    return 0;
+}
+
+void nrfx_gppi_fanout_enable(nrfx_gppi_fanout_t * p_fanout)
+{
+    NRFX_ASSERT(p_fanout);
+
+    /* Root is enabled last so that the event reaches all domains at once. */
+    for (size_t i = p_fanout->branch_cnt; i > 0; i--)
+    {
+        if (!branch_is_direct(p_fanout, &p_fanout->branches[i - 1]))
+        {
+            nrfx_gppi_conn_enable(p_fanout->branches[i - 1].handle);
+        }
+    }
+    p_fanout->enabled = true;
+}
+
+void nrfx_gppi_fanout_disable(nrfx_gppi_fanout_t * p_fanout)
+{
+    NRFX_ASSERT(p_fanout);
+
+    p_fanout->enabled = false;
+    for (size_t i = 0; i < p_fanout->branch_cnt; i++)
+    {
+        if (!branch_is_direct(p_fanout, &p_fanout->branches[i]))
+        {
+            nrfx_gppi_conn_disable(p_fanout->branches[i].handle);
+        }
+    }
+}
+
+#endif // defined(PPI_PRESENT) || defined(DPPIC_PRESENT)
@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_GRTC_ENABLED)
+
+#include <nrfx_grtc.h>
+#include <helpers/nrfx_grtc_timer.h>
+
+#define WHEEL_SLOT_BITS  5
+#define WHEEL_SLOTS      (1UL << WHEEL_SLOT_BITS)
+#define WHEEL_SLOT_MASK  (WHEEL_SLOTS - 1)
+#define WHEEL_LEVEL_BITS 4
+
+/* Number of bits by which the SYSCOUNTER value is shifted to get the slot number on a level. */
+#define WHEEL_SHIFT(level) ((level) * WHEEL_LEVEL_BITS)
+
+typedef struct
+{
+    nrfx_grtc_timer_t * p_slots[NRFX_GRTC_TIMER_WHEEL_LEVELS][WHEEL_SLOTS];
+    uint32_t            occupied[NRFX_GRTC_TIMER_WHEEL_LEVELS]; ///< Bitmask of non-empty slots.
+    uint64_t            clk;       ///< SYSCOUNTER value up to which the wheel was processed.
+    uint64_t            armed_cc;  ///< Value set in the compare channel.
+    bool                armed;     ///< True if the compare channel is set and did not expire.
+    uint32_t            tolerance;
+    uint8_t             channel;
+    nrfx_drv_state_t    state;
+} grtc_timer_cb_t;
+
+static grtc_timer_cb_t m_cb;
+
+static bool wheel_empty_check(void)
+{
+    for (uint8_t level = 0; level < NRFX_GRTC_TIMER_WHEEL_LEVELS; level++)
+    {
+        if (m_cb.occupied[level])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void timer_link(nrfx_grtc_timer_t * p_timer)
+{
+    uint64_t expiry = NRFX_MAX(p_timer->expiry, m_cb.clk);
+    uint64_t idx;
+    uint8_t  level;
+
+    /* Use the finest level which can hold the expiry time. */
+    for (level = 0; level < NRFX_GRTC_TIMER_WHEEL_LEVELS - 1; level++)
+    {
+        if (((expiry >> WHEEL_SHIFT(level)) - (m_cb.clk >> WHEEL_SHIFT(level))) < WHEEL_SLOTS)
+        {
+            break;
+        }
+    }
+
+    idx = expiry >> WHEEL_SHIFT(level);
+    if ((idx - (m_cb.clk >> WHEEL_SHIFT(level))) >= WHEEL_SLOTS)
+    {
+        /* Beyond the wheel range. Timer is moved again when the last slot is reached. */
+        idx = (m_cb.clk >> WHEEL_SHIFT(level)) + WHEEL_SLOTS - 1;
+    }
+
+    uint8_t              slot   = (uint8_t)(idx & WHEEL_SLOT_MASK);
+    nrfx_grtc_timer_t ** pp_head = &m_cb.p_slots[level][slot];
+
+    p_timer->slot    = (uint16_t)(level * WHEEL_SLOTS + slot);
+    p_timer->p_next  = *pp_head;
+    p_timer->pp_prev = pp_head;
+    if (*pp_head)
+    {
+        (*pp_head)->pp_prev = &p_timer->p_next;
+    }
+    *pp_head = p_timer;
+    m_cb.occupied[level] |= NRFX_BIT(slot);
+}
+
+static void timer_unlink(nrfx_grtc_timer_t * p_timer)
+{
+    uint8_t level = (uint8_t)(p_timer->slot / WHEEL_SLOTS);
+    uint8_t slot  = (uint8_t)(p_timer->slot % WHEEL_SLOTS);
+
+    *p_timer->pp_prev = p_timer->p_next;
+    if (p_timer->p_next)
+    {
+        p_timer->p_next->pp_prev = p_timer->pp_prev;
+    }
+    if (!m_cb.p_slots[level][slot])
+    {
+        m_cb.occupied[level] &= ~NRFX_BIT(slot);
+    }
+    p_timer->pp_prev = NULL;
+}
+
+/* Find the earliest non-empty slot. Returns false if the wheel is empty. */
+static bool next_slot_get(uint64_t * p_time, uint8_t * p_level)
+{
+    bool found = false;
+
+    for (uint8_t level = 0; level < NRFX_GRTC_TIMER_WHEEL_LEVELS; level++)
+    {
+        uint32_t occupied = m_cb.occupied[level];
+
+        if (!occupied)
+        {
+            continue;
+        }
+
+        uint64_t base = m_cb.clk >> WHEEL_SHIFT(level);
+        uint32_t pos  = (uint32_t)(base & WHEEL_SLOT_MASK);
+        uint32_t rot  = pos ? ((occupied >> pos) | (occupied << (WHEEL_SLOTS - pos))) : occupied;
+        uint64_t time = (base + NRFX_CTZ(rot)) << WHEEL_SHIFT(level);
+
+        if (!found || (time < *p_time))
+        {
+            *p_time  = time;
+            *p_level = level;
+            found    = true;
+        }
+    }
+
+    return found;
+}
+
+/* Advance the wheel up to @p limit and detach the first expired timer. */
+static nrfx_grtc_timer_t * expired_timer_get(uint64_t limit)
+{
+    uint64_t time;
+    uint8_t  level;
+
+    while (next_slot_get(&time, &level) && (time <= limit))
+    {
+        uint8_t              slot    = (uint8_t)((time >> WHEEL_SHIFT(level)) & WHEEL_SLOT_MASK);
+        nrfx_grtc_timer_t *  p_timer = m_cb.p_slots[level][slot];
+
+        m_cb.clk = NRFX_MAX(m_cb.clk, time);
+
+        if (level == 0)
+        {
+            /* All timers in a level 0 slot are due. */
+            timer_unlink(p_timer);
+            return p_timer;
+        }
+
+        /* Move the timers to the lower levels. */
+        m_cb.p_slots[level][slot] = NULL;
+        m_cb.occupied[level] &= ~NRFX_BIT(slot);
+        while (p_timer)
+        {
+            nrfx_grtc_timer_t * p_next = p_timer->p_next;
+
+            timer_link(p_timer);
+            p_timer = p_next;
+        }
+    }
+
+    return NULL;
+}
+
+static void channel_arm(void)
+{
+    uint64_t time;
+    uint8_t  level;
+
+    if (!next_slot_get(&time, &level) || (m_cb.armed && (m_cb.armed_cc == time)))
+    {
+        return;
+    }
+
+    /* Compare value in the past triggers the event immediately. */
+    nrfx_grtc_syscounter_cc_abs_set(m_cb.channel, time, m_cb.armed);
+    m_cb.armed_cc = time;
+    m_cb.armed    = true;
+}
+
+static void cc_handler(int32_t id, uint64_t cc_value, void * p_context)
+{
+    (void)id;
+    (void)cc_value;
+    (void)p_context;
+
+    for (;;)
+    {
+        nrfx_grtc_timer_t * p_timer;
+
+        NRFX_CRITICAL_SECTION_ENTER();
+        m_cb.armed = false;
+        p_timer = expired_timer_get(nrfx_grtc_syscounter_get() + m_cb.tolerance);
+        if (!p_timer)
+        {
+            channel_arm();
+        }
+        NRFX_CRITICAL_SECTION_EXIT();
+
+        if (!p_timer)
+        {
+            break;
+        }
+        p_timer->handler(p_timer, p_timer->p_context);
+    }
+}
+
+int nrfx_grtc_timer_init(nrfx_grtc_timer_config_t const * p_config)
+{
+    NRFX_ASSERT(p_config);
+    int err_code;
+
+    if (m_cb.state != NRFX_DRV_STATE_UNINITIALIZED)
+    {
+        return -EALREADY;
+    }
+
+    err_code = nrfx_grtc_channel_alloc(&m_cb.channel);
+    if (err_code < 0)
+    {
+        return err_code;
+    }
+
+    memset(m_cb.p_slots, 0, sizeof(m_cb.p_slots));
+    memset(m_cb.occupied, 0, sizeof(m_cb.occupied));
+    m_cb.tolerance = p_config->tolerance;
+    m_cb.armed     = false;
+    m_cb.clk       = nrfx_grtc_syscounter_get();
+    nrfx_grtc_channel_callback_set(m_cb.channel, cc_handler, NULL);
+    m_cb.state = NRFX_DRV_STATE_INITIALIZED;
+
+    return 0;
+}
+
+void nrfx_grtc_timer_uninit(void)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_DRV_STATE_UNINITIALIZED);
+
+    (void)nrfx_grtc_syscounter_cc_int_disable(m_cb.channel);
+    (void)nrfx_grtc_channel_free(m_cb.channel);
+
+    /* Stop the running timers, so that they can be started again after the next init. */
+    NRFX_CRITICAL_SECTION_ENTER();
+    for (uint8_t level = 0; level < NRFX_GRTC_TIMER_WHEEL_LEVELS; level++)
+    {
+        for (uint8_t slot = 0; slot < WHEEL_SLOTS; slot++)
+        {
+            while (m_cb.p_slots[level][slot])
+            {
+                timer_unlink(m_cb.p_slots[level][slot]);
+            }
+        }
+    }
+    m_cb.armed = false;
+    m_cb.state = NRFX_DRV_STATE_UNINITIALIZED;
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+void nrfx_grtc_timer_setup(nrfx_grtc_timer_t *       p_timer,
+                           nrfx_grtc_timer_handler_t handler,
+                           void *                    p_context)
+{
+    NRFX_ASSERT(p_timer);
+    NRFX_ASSERT(handler);
+
+    p_timer->handler   = handler;
+    p_timer->p_context = p_context;
+    p_timer->p_next    = NULL;
+    p_timer->pp_prev   = NULL;
+}
+
+void nrfx_grtc_timer_start(nrfx_grtc_timer_t * p_timer, uint64_t expiry)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_DRV_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_timer);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (p_timer->pp_prev)
+    {
+        timer_unlink(p_timer);
+    }
+    if (wheel_empty_check())
+    {
+        /* Catch up with the SYSCOUNTER to avoid moving the timer through the levels. */
+        m_cb.clk = NRFX_MAX(m_cb.clk, nrfx_grtc_syscounter_get());
+    }
+    p_timer->expiry = expiry;
+    timer_link(p_timer);
+    channel_arm();
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+void nrfx_grtc_timer_stop(nrfx_grtc_timer_t * p_timer)
+{
+    NRFX_ASSERT(p_timer);
+
+    /* Compare channel is left armed. The resulting wakeup finds no expired timers. */
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (p_timer->pp_prev)
+    {
+        timer_unlink(p_timer);
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+bool nrfx_grtc_timer_running_check(nrfx_grtc_timer_t const * p_timer)
+{
+    NRFX_ASSERT(p_timer);
+
+    return p_timer->pp_prev != NULL;
+}
+
+#endif // NRFX_CHECK(NRFX_GRTC_ENABLED)
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_GRTC_TIMER_H__
+#define NRFX_GRTC_TIMER_H__
+
+#include <nrfx.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_grtc_timer GRTC timer multiplexing layer
+ * @{
+ * @ingroup nrfx_grtc
+ *
+ * @brief Helper layer that multiplexes any number of software timers onto a single
+ *        SYSCOUNTER capture/compare channel.
+ *
+ * Timers are kept in a hierarchical timing wheel with @ref NRFX_GRTC_TIMER_WHEEL_LEVELS
+ * levels of 32 slots. Slots of level 0 span a single SYSCOUNTER tick and slots of every
+ * next level span 16 times more. Starting and stopping a timer takes constant time.
+ * Timers of the higher levels are moved to the lower ones as their expiry approaches,
+ * which requires an additional compare event per level.
+ *
+ * Only the earliest slot is armed on the compare channel. When the channel expires,
+ * all timers that expire within @ref nrfx_grtc_timer_config_t.tolerance ticks from the
+ * current SYSCOUNTER value are expired together, so that close timeouts share a wakeup.
+ * A timer therefore expires up to the tolerance before its expiry time whenever the channel
+ * expires within that window for another reason, for example an earlier timer or a move of
+ * timers between the levels. A timer never expires before its expiry time when the tolerance
+ * is 0. Timer handlers are called from the GRTC interrupt context.
+ *
+ * @note The GRTC driver must be initialized and the SYSCOUNTER must be running before
+ *       this layer is used.
+ */
+
+#ifndef NRFX_GRTC_TIMER_WHEEL_LEVELS
+/**
+ * @brief Number of timing wheel levels.
+ *
+ * Timers with expiry beyond the wheel range (2 ^ (5 + 4 * (levels - 1)) ticks) are
+ * placed in the last slot and moved again when the slot is reached.
+ */
+#define NRFX_GRTC_TIMER_WHEEL_LEVELS 6
+#endif
+
+/** @brief GRTC timer. */
+typedef struct nrfx_grtc_timer_s nrfx_grtc_timer_t;
+
+/**
+ * @brief GRTC timer expiry handler type.
+ *
+ * The timer can be started again from within the handler.
+ *
+ * @param[in] p_timer   Pointer to the expired timer.
+ * @param[in] p_context Context passed to @ref nrfx_grtc_timer_setup.
+ */
+typedef void (* nrfx_grtc_timer_handler_t)(nrfx_grtc_timer_t * p_timer, void * p_context);
+
+/** @brief Structure for the GRTC timer. */
+struct nrfx_grtc_timer_s
+{
+    nrfx_grtc_timer_handler_t handler;   ///< Expiry handler.
+    void *                    p_context; ///< Context passed to the handler.
+    /** @cond Driver internal data. */
+    uint64_t                  expiry;
+    nrfx_grtc_timer_t *       p_next;
+    nrfx_grtc_timer_t **      pp_prev;
+    uint16_t                  slot;
+    /** @endcond */
+};
+
+/** @brief GRTC timer layer configuration structure. */
+typedef struct
+{
+    uint32_t tolerance; ///< Number of SYSCOUNTER ticks by which a timer may expire before
+                        ///< its expiry time to share a wakeup of the channel.
+} nrfx_grtc_timer_config_t;
+
+/**
+ * @brief GRTC timer layer default configuration.
+ *
+ * This configuration sets up the layer with the following options:
+ * - no tolerance, timers never expire before their expiry time
+ */
+#define NRFX_GRTC_TIMER_DEFAULT_CONFIG \
+{                                      \
+    .tolerance = 0,                    \
+}
+
+/**
+ * @brief Function for initializing the GRTC timer layer.
+ *
+ * The function allocates a SYSCOUNTER capture/compare channel.
+ *
+ * @param[in] p_config Pointer to the structure with the configuration.
+ *
+ * @retval 0         Initialization was successful.
+ * @retval -EALREADY The layer is already initialized.
+ * @retval -ENOMEM   No capture/compare channel available.
+ */
+int nrfx_grtc_timer_init(nrfx_grtc_timer_config_t const * p_config);
+
+/**
+ * @brief Function for uninitializing the GRTC timer layer.
+ *
+ * Running timers are stopped without calling their handlers and the capture/compare
+ * channel is freed.
+ */
+void nrfx_grtc_timer_uninit(void);
+
+/**
+ * @brief Function for setting up a timer.
+ *
+ * @param[out] p_timer   Pointer to the timer.
+ * @param[in]  handler   Expiry handler. Cannot be NULL.
+ * @param[in]  p_context Context passed to @p handler.
+ */
+void nrfx_grtc_timer_setup(nrfx_grtc_timer_t *       p_timer,
+                           nrfx_grtc_timer_handler_t handler,
+                           void *                    p_context);
+
+/**
+ * @brief Function for starting a timer.
+ *
+ * If the timer is already running, it is restarted with the new expiry time.
+ * A timer with expiry time in the past expires as soon as possible.
+ *
+ * @param[in] p_timer Pointer to the timer.
+ * @param[in] expiry  Absolute SYSCOUNTER value at which the timer expires.
+ */
+void nrfx_grtc_timer_start(nrfx_grtc_timer_t * p_timer, uint64_t expiry);
+
+/**
+ * @brief Function for stopping a timer.
+ *
+ * Stopping a timer which is not running has no effect.
+ *
+ * @param[in] p_timer Pointer to the timer.
+ */
+void nrfx_grtc_timer_stop(nrfx_grtc_timer_t * p_timer);
+
+/**
+ * @brief Function for checking whether a timer is running.
+ *
+ * @param[in] p_timer Pointer to the timer.
+ *
+ * @retval true  The timer is running.
+ * @retval false The timer is not running.
+ */
+bool nrfx_grtc_timer_running_check(nrfx_grtc_timer_t const * p_timer);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_GRTC_TIMER_H__
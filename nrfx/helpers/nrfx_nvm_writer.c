@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <nrfx.h>
+#include <helpers/nrfx_nvm_writer.h>
+
+#if defined(NVMC_PRESENT)
+#include <nrfx_nvmc.h>
+#elif defined(RRAMC_PRESENT)
+#include <nrfx_rramc.h>
+#else
+#error "Unsupported."
+#endif
+
+/** @brief Value of the erased 32-bit word. */
+#define NVM_WRITER_ERASED_WORD 0xFFFFFFFFUL
+
+/** @brief NVM writer control block. */
+typedef struct
+{
+    nrfx_nvm_writer_handler_t handler;        /**< Job completion handler. */
+    void *                    p_context;      /**< Context passed to the completion handler. */
+    nrfx_nvm_writer_job_t *   p_head;         /**< First pending job. */
+    nrfx_nvm_writer_job_t *   p_tail;         /**< Last pending job. */
+    uint32_t                  chunk_size;     /**< Maximum number of bytes written in one step. */
+    uint32_t                  erase_slice_ms; /**< Duration of a part of the page erase. */
+    bool                      erase_started;  /**< Flag indicating an ongoing partial erase of a page. */
+} nvm_writer_cb_t;
+
+static nvm_writer_cb_t m_cb;
+
+#if defined(NVMC_PRESENT)
+static uint32_t nvm_erase_unit_get(void)
+{
+    return nrfx_nvmc_flash_page_size_get();
+}
+
+static int nvm_erase_step(uint32_t address, uint32_t * p_erased)
+{
+#if NRF_NVMC_HAS_PARTIAL_ERASE
+    if (m_cb.erase_slice_ms)
+    {
+        if (!m_cb.erase_started)
+        {
+            int err = nrfx_nvmc_page_partial_erase_init(address, m_cb.erase_slice_ms);
+
+            if (err < 0)
+            {
+                return err;
+            }
+            m_cb.erase_started = true;
+        }
+
+        if (!nrfx_nvmc_page_partial_erase_continue())
+        {
+            *p_erased = 0;
+            return 0;
+        }
+
+        m_cb.erase_started = false;
+        *p_erased = nrfx_nvmc_flash_page_size_get();
+        return 0;
+    }
+#endif
+
+    *p_erased = nrfx_nvmc_flash_page_size_get();
+    return nrfx_nvmc_page_erase(address);
+}
+
+static void nvm_write_step(uint32_t address, void const * p_src, uint32_t size)
+{
+    if (nrfx_is_word_aligned((void const *)address) &&
+        nrfx_is_word_aligned(p_src) &&
+        !(size & 0x3UL))
+    {
+        nrfx_nvmc_words_write(address, p_src, size / sizeof(uint32_t));
+    }
+    else
+    {
+        nrfx_nvmc_bytes_write(address, p_src, size);
+    }
+
+    while (!nrfx_nvmc_write_done_check())
+    {}
+}
+#elif defined(RRAMC_PRESENT)
+static uint32_t nvm_erase_unit_get(void)
+{
+    return sizeof(uint32_t);
+}
+
+static int nvm_erase_step(uint32_t address, uint32_t * p_erased)
+{
+    uint32_t size = *p_erased;
+
+    for (uint32_t i = 0; i < size; i += sizeof(uint32_t))
+    {
+        nrfx_rramc_word_write(address + i, NVM_WRITER_ERASED_WORD);
+    }
+    nrfx_rramc_write_buffer_commit();
+
+    return 0;
+}
+
+static void nvm_write_step(uint32_t address, void const * p_src, uint32_t size)
+{
+    if (nrfx_is_word_aligned((void const *)address) &&
+        nrfx_is_word_aligned(p_src) &&
+        !(size & 0x3UL))
+    {
+        nrfx_rramc_words_write(address, p_src, size / sizeof(uint32_t));
+    }
+    else
+    {
+        nrfx_rramc_bytes_write(address, p_src, size);
+    }
+    nrfx_rramc_write_buffer_commit();
+}
+#endif
+
+static void job_complete(int result)
+{
+    nrfx_nvm_writer_job_t * p_job;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    p_job = m_cb.p_head;
+    m_cb.p_head = p_job->p_next;
+    if (!m_cb.p_head)
+    {
+        m_cb.p_tail = NULL;
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    p_job->result = result;
+    m_cb.handler(p_job, m_cb.p_context);
+}
+
+int nrfx_nvm_writer_init(nrfx_nvm_writer_config_t const * p_config,
+                         nrfx_nvm_writer_handler_t        handler,
+                         void *                           p_context)
+{
+    NRFX_ASSERT(p_config && handler);
+
+    if (m_cb.handler)
+    {
+        return -EALREADY;
+    }
+
+    if ((p_config->chunk_size == 0) || (p_config->chunk_size & 0x3UL))
+    {
+        return -EINVAL;
+    }
+
+    m_cb.p_context      = p_context;
+    m_cb.p_head         = NULL;
+    m_cb.p_tail         = NULL;
+    m_cb.chunk_size     = p_config->chunk_size;
+    m_cb.erase_slice_ms = p_config->erase_slice_ms;
+    m_cb.erase_started  = false;
+    m_cb.handler        = handler;
+
+    return 0;
+}
+
+int nrfx_nvm_writer_uninit(void)
+{
+    NRFX_ASSERT(m_cb.handler);
+
+    if (m_cb.p_head)
+    {
+        return -EBUSY;
+    }
+
+    m_cb.handler = NULL;
+    return 0;
+}
+
+int nrfx_nvm_writer_submit(nrfx_nvm_writer_job_t * p_job)
+{
+    NRFX_ASSERT(m_cb.handler);
+    NRFX_ASSERT(p_job);
+
+    if (p_job->size == 0)
+    {
+        return -EINVAL;
+    }
+
+    if (p_job->type == NRFX_NVM_WRITER_JOB_ERASE)
+    {
+        uint32_t unit = nvm_erase_unit_get();
+
+        if ((p_job->address % unit) || (p_job->size % unit))
+        {
+            return -EACCES;
+        }
+    }
+    else if ((p_job->type != NRFX_NVM_WRITER_JOB_WRITE) || !p_job->p_data)
+    {
+        return -EINVAL;
+    }
+
+    p_job->p_next = NULL;
+    p_job->offset = 0;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (m_cb.p_tail)
+    {
+        m_cb.p_tail->p_next = p_job;
+    }
+    else
+    {
+        m_cb.p_head = p_job;
+    }
+    m_cb.p_tail = p_job;
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return 0;
+}
+
+bool nrfx_nvm_writer_process(void)
+{
+    NRFX_ASSERT(m_cb.handler);
+
+    nrfx_nvm_writer_job_t * p_job = m_cb.p_head;
+
+    if (!p_job)
+    {
+        return false;
+    }
+
+    uint32_t address = p_job->address + p_job->offset;
+    uint32_t length  = NRFX_MIN(p_job->size - p_job->offset, m_cb.chunk_size);
+
+    if (p_job->type == NRFX_NVM_WRITER_JOB_ERASE)
+    {
+        int err = nvm_erase_step(address, &length);
+
+        if (err < 0)
+        {
+            job_complete(err);
+            return nrfx_nvm_writer_pending_check();
+        }
+    }
+    else
+    {
+        nvm_write_step(address, (uint8_t const *)p_job->p_data + p_job->offset, length);
+    }
+
+    p_job->offset += length;
+    if (p_job->offset == p_job->size)
+    {
+        job_complete(0);
+    }
+
+    return nrfx_nvm_writer_pending_check();
+}
+
+bool nrfx_nvm_writer_pending_check(void)
+{
+    return (m_cb.p_head != NULL);
+}
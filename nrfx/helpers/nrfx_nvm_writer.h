@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef NRFX_NVM_WRITER_H__
+#define NRFX_NVM_WRITER_H__
+
+#include <nrfx.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_nvm_writer Generic NVM writer layer
+ * @{
+ * @ingroup nrfx
+ *
+ * @brief Helper layer that performs queued non-volatile memory erase and write jobs
+ *        in short steps, using the NVMC or RRAMC driver, depending on the SoC.
+ *
+ * Erasing and writing of the non-volatile memory is blocking and, depending on the source
+ * of the code being executed, the CPU may be halted during the operation. The nrfx_nvm_writer
+ * layer splits submitted jobs into steps of a bounded duration. Each call to
+ * @ref nrfx_nvm_writer_process performs a single step and returns, so that the caller
+ * can interleave the processing with time-critical work, for example by calling it
+ * from a low-priority thread or from the idle loop.
+ *
+ * The layer is polled. It uses neither interrupts nor timers, so the jobs progress only
+ * while @ref nrfx_nvm_writer_process is called. The application must keep calling it
+ * as long as it returns true or @ref nrfx_nvm_writer_pending_check indicates pending jobs.
+ *
+ * A single step is one of the following:
+ * - on NVMC, a part of the page erase if partial erase is supported by the SoC,
+ *   or an erase of a single page otherwise,
+ * - on RRAMC, a write of @ref nrfx_nvm_writer_config_t.chunk_size bytes of the erased
+ *   value, followed by a write buffer commit,
+ * - a write of @ref nrfx_nvm_writer_config_t.chunk_size bytes of data, followed on RRAMC
+ *   by a write buffer commit.
+ *
+ * @note On RRAMC the RRAMC driver must be initialized before this layer is used.
+ */
+
+/** @brief NVM writer job types. */
+typedef enum
+{
+    NRFX_NVM_WRITER_JOB_ERASE, ///< Erase the memory area.
+    NRFX_NVM_WRITER_JOB_WRITE, ///< Write data to the memory area.
+} nrfx_nvm_writer_job_type_t;
+
+/** @brief NVM writer job. */
+typedef struct nrfx_nvm_writer_job_s nrfx_nvm_writer_job_t;
+
+/** @brief Structure for the NVM writer job. */
+struct nrfx_nvm_writer_job_s
+{
+    nrfx_nvm_writer_job_type_t type;    ///< Job type.
+    uint32_t                   address; ///< Start address of the memory area.
+    void const *               p_data;  ///< Data to be written. Ignored for erase jobs.
+    uint32_t                   size;    ///< Size of the memory area in bytes.
+    int                        result;  ///< Result of the job, valid when the job is completed.
+                                        /**< 0 on success, or the negative error code
+                                         *   returned by the NVMC driver for the erase. */
+    /** @cond Driver internal data. */
+    nrfx_nvm_writer_job_t *    p_next;
+    uint32_t                   offset;
+    /** @endcond */
+};
+
+/**
+ * @brief NVM writer job completion handler type.
+ *
+ * @param[in] p_job     Pointer to the completed job.
+ * @param[in] p_context Context passed to @ref nrfx_nvm_writer_init.
+ */
+typedef void (* nrfx_nvm_writer_handler_t)(nrfx_nvm_writer_job_t * p_job, void * p_context);
+
+/** @brief NVM writer configuration structure. */
+typedef struct
+{
+    uint32_t chunk_size;     ///< Maximum number of bytes written in a single step. Must be a multiple of 4.
+    uint32_t erase_slice_ms; ///< Duration of a single part of the page erase in milliseconds.
+                             /**< Used only on NVMC with partial erase support. If set to 0,
+                              *   a whole page is erased in a single step. */
+} nrfx_nvm_writer_config_t;
+
+/**
+ * @brief NVM writer default configuration.
+ *
+ * This configuration sets up the NVM writer with the following options:
+ * - 256 bytes written in a single step
+ * - 2 ms partial erase duration
+ */
+#define NRFX_NVM_WRITER_DEFAULT_CONFIG \
+{                                      \
+    .chunk_size     = 256,             \
+    .erase_slice_ms = 2,               \
+}
+
+/**
+ * @brief Function for initializing the NVM writer.
+ *
+ * @param[in] p_config  Pointer to the structure with the configuration.
+ * @param[in] handler   Job completion handler. Cannot be NULL.
+ * @param[in] p_context Context passed to @p handler.
+ *
+ * @retval 0         Initialization was successful.
+ * @retval -EALREADY The NVM writer is already initialized.
+ * @retval -EINVAL   The configuration is invalid.
+ */
+int nrfx_nvm_writer_init(nrfx_nvm_writer_config_t const * p_config,
+                         nrfx_nvm_writer_handler_t        handler,
+                         void *                           p_context);
+
+/**
+ * @brief Function for uninitializing the NVM writer.
+ *
+ * @retval 0      Uninitialization was successful.
+ * @retval -EBUSY There are still pending jobs.
+ */
+int nrfx_nvm_writer_uninit(void);
+
+/**
+ * @brief Function for submitting a job to the NVM writer.
+ *
+ * The job structure and the data it refers to are owned by the NVM writer until
+ * @ref nrfx_nvm_writer_handler_t is called for it.
+ *
+ * @note On NVMC, the address and size of erase jobs must be aligned to the page size.
+ *       On RRAMC, they must be aligned to a 32-bit word.
+ *
+ * @param[in] p_job Pointer to the job.
+ *
+ * @retval 0       The job has been queued.
+ * @retval -EACCES The memory area is not properly aligned.
+ * @retval -EINVAL The job parameters are invalid.
+ */
+int nrfx_nvm_writer_submit(nrfx_nvm_writer_job_t * p_job);
+
+/**
+ * @brief Function for performing a single step of the pending jobs.
+ *
+ * If the step completes a job, the job completion handler is called from within this function.
+ * If the erase of a page cannot be started, the job is completed with the error
+ * and the processing continues with the next job.
+ *
+ * @retval true  There are still pending jobs. Call the function again to process the next step.
+ * @retval false All jobs have been completed.
+ */
+bool nrfx_nvm_writer_process(void);
+
+/**
+ * @brief Function for checking whether there are any pending jobs.
+ *
+ * @retval true  At least one job is pending.
+ * @retval false All jobs have been completed.
+ */
+bool nrfx_nvm_writer_pending_check(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_NVM_WRITER_H__
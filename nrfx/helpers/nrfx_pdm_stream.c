@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <nrfx.h>
+#include <helpers/nrfx_pdm_stream.h>
+#include <helpers/nrfx_flag32_allocator.h>
+#include <string.h>
+
+/** @brief Built-in anti-aliasing filter for decimation by 2, cut-off at 0.225 of the input rate. */
+static const int16_t m_fir_decim2[] =
+{
+      -103,     45,    440,     73,  -1709,  -1233,   5423,  13448,
+     13448,   5423,  -1233,  -1709,     73,    440,     45,   -103,
+};
+
+/** @brief Built-in anti-aliasing filter for decimation by 4, cut-off at 0.1125 of the input rate. */
+static const int16_t m_fir_decim4[] =
+{
+       -54,    -47,    -11,     75,    195,    268,    175,   -157,
+      -652,  -1046,   -958,    -75,   1643,   3862,   5949,   7217,
+      7217,   5949,   3862,   1643,    -75,   -958,  -1046,   -652,
+      -157,    175,    268,    195,     75,    -11,    -47,    -54,
+};
+
+// Fractional bits of the DC removal filter output kept in its state. Without them,
+// the truncated feedback would accumulate into an offset of up to 1 / (2 * (1 - alpha)).
+#define DC_STATE_FRAC_BITS 8
+
+static int16_t sat16(int32_t value)
+{
+    if (value > INT16_MAX)
+    {
+        return INT16_MAX;
+    }
+    if (value < INT16_MIN)
+    {
+        return INT16_MIN;
+    }
+    return (int16_t)value;
+}
+
+static int32_t fir_dot(int16_t const * p_x, int16_t const * p_h, uint8_t taps)
+{
+    int32_t acc = 0;
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+    // Number of taps is always even, process two samples at once.
+    for (uint8_t i = 0; i < taps; i += 2)
+    {
+        uint32_t x;
+        uint32_t h;
+
+        memcpy(&x, &p_x[i], sizeof(x));
+        memcpy(&h, &p_h[i], sizeof(h));
+        acc = (int32_t)__SMLAD(x, h, (uint32_t)acc);
+    }
+#else
+    for (uint8_t i = 0; i < taps; i++)
+    {
+        acc += (int32_t)p_x[i] * p_h[i];
+    }
+#endif
+
+    return acc;
+}
+
+static int16_t dc_step(nrfx_pdm_stream_channel_t * p_ch, uint16_t alpha, int16_t x)
+{
+    int32_t limit = (int32_t)INT16_MAX * (1 << DC_STATE_FRAC_BITS);
+    int32_t y     = ((int32_t)x - p_ch->dc_x_prev) * (1 << DC_STATE_FRAC_BITS) +
+                    (int32_t)(((int64_t)alpha * p_ch->dc_y_prev) >> 15);
+
+    if (y > limit)
+    {
+        y = limit;
+    }
+    else if (y < -limit)
+    {
+        y = -limit;
+    }
+
+    p_ch->dc_x_prev = x;
+    p_ch->dc_y_prev = y;
+
+    return sat16((y + (1 << (DC_STATE_FRAC_BITS - 1))) >> DC_STATE_FRAC_BITS);
+}
+
+static bool fir_step(nrfx_pdm_stream_t *         p_stream,
+                     nrfx_pdm_stream_channel_t * p_ch,
+                     int16_t                     x,
+                     int16_t *                   p_y)
+{
+    uint8_t taps = p_stream->fir_taps;
+
+    // Each sample is stored twice, so that the last taps samples are always
+    // available in a contiguous part of the delay line, from the oldest to the newest.
+    p_ch->fir_delay[p_ch->fir_idx]        = x;
+    p_ch->fir_delay[p_ch->fir_idx + taps] = x;
+    p_ch->fir_idx = (uint8_t)((p_ch->fir_idx + 1 == taps) ? 0 : p_ch->fir_idx + 1);
+
+    if (++p_ch->fir_phase < p_stream->config.decimation)
+    {
+        return false;
+    }
+    p_ch->fir_phase = 0;
+
+    int32_t acc = fir_dot(&p_ch->fir_delay[p_ch->fir_idx], p_stream->fir_coeffs, taps);
+    *p_y = sat16((acc + (1L << 14)) >> 15);
+    return true;
+}
+
+static size_t block_process(nrfx_pdm_stream_t * p_stream, int16_t * p_buf, size_t length)
+{
+    nrfx_pdm_stream_config_t const * p_config = &p_stream->config;
+
+    if (p_config->stereo && p_config->mixdown)
+    {
+        length /= 2;
+        for (size_t i = 0; i < length; i++)
+        {
+            p_buf[i] = (int16_t)(((int32_t)p_buf[2 * i] + p_buf[2 * i + 1]) / 2);
+        }
+    }
+
+    if ((p_config->dc_alpha == 0) &&
+        (p_config->gain == NRFX_PDM_STREAM_GAIN_UNITY) &&
+        (p_config->decimation == 1))
+    {
+        return length;
+    }
+
+    // Output never gets ahead of input, so the block can be processed in place.
+    size_t out = 0;
+    for (size_t i = 0; i < length; i++)
+    {
+        nrfx_pdm_stream_channel_t * p_ch = &p_stream->channel[i % p_stream->channels];
+        int16_t x = p_buf[i];
+
+        if (p_config->dc_alpha)
+        {
+            x = dc_step(p_ch, p_config->dc_alpha, x);
+        }
+        if (p_config->gain != NRFX_PDM_STREAM_GAIN_UNITY)
+        {
+            x = sat16(((int32_t)x * p_config->gain) >> 8);
+        }
+        if ((p_config->decimation > 1) && !fir_step(p_stream, p_ch, x, &x))
+        {
+            continue;
+        }
+        p_buf[out++] = x;
+    }
+
+    return out;
+}
+
+static int fir_setup(nrfx_pdm_stream_t * p_stream, nrfx_pdm_stream_config_t const * p_config)
+{
+    int16_t const * p_fir = p_config->p_fir;
+    uint8_t         taps  = p_config->fir_taps;
+
+    if (p_fir == NULL)
+    {
+        p_fir = (p_config->decimation == 2) ? m_fir_decim2 : m_fir_decim4;
+        taps  = (uint8_t)((p_config->decimation == 2) ? NRFX_ARRAY_SIZE(m_fir_decim2)
+                                                      : NRFX_ARRAY_SIZE(m_fir_decim4));
+    }
+
+    if ((taps == 0) || (taps > NRFX_PDM_STREAM_FIR_TAPS_MAX))
+    {
+        return -EINVAL;
+    }
+
+    uint32_t abs_sum = 0;
+    for (uint8_t i = 0; i < taps; i++)
+    {
+        abs_sum += (uint32_t)((p_fir[i] < 0) ? -p_fir[i] : p_fir[i]);
+    }
+    // Keep the accumulator within 32 bits for any input.
+    if (abs_sum > 0x10000UL)
+    {
+        return -EINVAL;
+    }
+
+    // Coefficients are stored in reversed order to match the order of the delay line.
+    // An odd number of taps is padded with a leading zero to allow pairwise processing.
+    uint8_t padded = (uint8_t)((taps + 1) & ~1U);
+    memset(p_stream->fir_coeffs, 0, sizeof(p_stream->fir_coeffs));
+    for (uint8_t i = 0; i < taps; i++)
+    {
+        p_stream->fir_coeffs[padded - 1 - i] = p_fir[i];
+    }
+    p_stream->fir_taps = padded;
+
+    return 0;
+}
+
+/* Supplies the pool buffer to the PDM driver. The buffer goes back to the pool if the driver
+ * does not take it, for example because it is being stopped. */
+static void buffer_supply(nrfx_pdm_stream_t * p_stream, uint8_t idx)
+{
+    uint16_t length   = p_stream->config.buffer_length;
+    int      err_code = nrfx_pdm_buffer_set(p_stream->p_pdm,
+                                            &p_stream->config.p_pool[idx * length],
+                                            length);
+
+    if (err_code < 0)
+    {
+        NRFX_CRITICAL_SECTION_ENTER();
+        (void)nrfx_flag32_free(&p_stream->free_mask, idx);
+        p_stream->stats.buffer_set_error_count++;
+        NRFX_CRITICAL_SECTION_EXIT();
+    }
+}
+
+int nrfx_pdm_stream_init(nrfx_pdm_stream_t *              p_stream,
+                         nrfx_pdm_t *                     p_pdm,
+                         nrfx_pdm_stream_config_t const * p_config,
+                         nrfx_pdm_stream_handler_t        handler,
+                         void *                           p_context)
+{
+    NRFX_ASSERT(p_stream);
+    NRFX_ASSERT(p_pdm);
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(p_config->p_pool);
+    NRFX_ASSERT(handler);
+
+    uint8_t in_channels = p_config->stereo ? 2 : 1;
+
+    if ((p_config->buffer_count < 3) ||
+        (p_config->buffer_count > NRFX_PDM_STREAM_POOL_SIZE_MAX) ||
+        ((p_config->decimation != 1) &&
+         (p_config->decimation != 2) &&
+         (p_config->decimation != 4)) ||
+        (p_config->buffer_length == 0) ||
+        (p_config->buffer_length > NRFX_PDM_MAX_BUFFER_SIZE) ||
+        ((p_config->buffer_length % 2) != 0) ||
+        ((p_config->buffer_length % (in_channels * p_config->decimation)) != 0))
+    {
+        return -EINVAL;
+    }
+
+    memset(p_stream, 0, sizeof(*p_stream));
+
+    if (p_config->decimation > 1)
+    {
+        int err_code = fir_setup(p_stream, p_config);
+        if (err_code < 0)
+        {
+            return err_code;
+        }
+    }
+
+    p_stream->p_pdm     = p_pdm;
+    p_stream->handler   = handler;
+    p_stream->p_context = p_context;
+    p_stream->config    = *p_config;
+    p_stream->channels  = (p_config->stereo && !p_config->mixdown) ? 2 : 1;
+    p_stream->free_mask = NRFX_BIT_MASK(p_config->buffer_count);
+
+    return 0;
+}
+
+void nrfx_pdm_stream_evt_handle(nrfx_pdm_stream_t *    p_stream,
+                                nrfx_pdm_evt_t const * p_evt)
+{
+    NRFX_ASSERT(p_stream);
+    NRFX_ASSERT(p_evt);
+
+    if (p_evt->error == NRFX_PDM_ERROR_OVERFLOW)
+    {
+        p_stream->stats.overflow_count++;
+    }
+
+    // Serve the buffer request first, as the PDM driver has a deadline for it.
+    if (p_evt->buffer_requested)
+    {
+        int idx;
+
+        NRFX_CRITICAL_SECTION_ENTER();
+        idx = nrfx_flag32_alloc(&p_stream->free_mask);
+        if (idx < 0)
+        {
+            p_stream->request_pending = true;
+            p_stream->stats.starved_count++;
+        }
+        NRFX_CRITICAL_SECTION_EXIT();
+
+        if (idx >= 0)
+        {
+            buffer_supply(p_stream, (uint8_t)idx);
+        }
+    }
+
+    if (p_evt->buffer_released)
+    {
+        size_t length = block_process(p_stream,
+                                      p_evt->buffer_released,
+                                      p_stream->config.buffer_length);
+
+        p_stream->handler(p_evt->buffer_released, length, p_stream->p_context);
+    }
+}
+
+int nrfx_pdm_stream_block_free(nrfx_pdm_stream_t * p_stream, int16_t * p_block)
+{
+    NRFX_ASSERT(p_stream);
+
+    int16_t * p_pool = p_stream->config.p_pool;
+    uint16_t  length = p_stream->config.buffer_length;
+
+    if ((p_block < p_pool) ||
+        (p_block >= &p_pool[p_stream->config.buffer_count * length]) ||
+        (((size_t)(p_block - p_pool) % length) != 0))
+    {
+        return -EINVAL;
+    }
+
+    uint8_t idx = (uint8_t)((size_t)(p_block - p_pool) / length);
+    bool    pending;
+    int     err_code = 0;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    pending = p_stream->request_pending;
+    if (!nrfx_flag32_is_allocated(p_stream->free_mask, idx))
+    {
+        err_code = -EINVAL;
+    }
+    else if (pending)
+    {
+        // Hand the block over to the PDM driver directly, it stays allocated.
+        p_stream->request_pending = false;
+    }
+    else
+    {
+        err_code = nrfx_flag32_free(&p_stream->free_mask, idx);
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if ((err_code == 0) && pending)
+    {
+        buffer_supply(p_stream, idx);
+    }
+
+    return err_code;
+}
+
+void nrfx_pdm_stream_stats_get(nrfx_pdm_stream_t const * p_stream,
+                               nrfx_pdm_stream_stats_t * p_stats)
+{
+    NRFX_ASSERT(p_stream);
+    NRFX_ASSERT(p_stats);
+
+    *p_stats = p_stream->stats;
+}
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef NRFX_PDM_STREAM_H__
+#define NRFX_PDM_STREAM_H__
+
+#include <nrfx.h>
+#include <nrfx_pdm.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_pdm_stream Generic PDM streaming layer
+ * @{
+ * @ingroup nrfx
+ *
+ * @brief Helper layer that supplies the PDM driver with buffers from a pool
+ *        and post-processes completed buffers before passing them to the user.
+ *
+ * The layer takes over the buffer handling from the application. Buffers requested
+ * by the PDM driver are taken from a pool provided during the initialization.
+ * Each released buffer is processed in place by an optional block-processing stage
+ * and only the resulting block is passed to the user handler. The block is owned by
+ * the user until it is given back with @ref nrfx_pdm_stream_block_free.
+ *
+ * The block-processing stage consists of the following steps, performed in that order:
+ * - mono mixdown of interleaved stereo samples (average of the left and right channel),
+ * - DC removal with a first-order high-pass filter,
+ * - gain,
+ * - decimation by 2 or 4 with an FIR anti-aliasing filter.
+ *
+ * Performing the mixdown first halves the cost of the following steps. As all steps are
+ * linear, the result is the same as when the mixdown is done last, except for saturation.
+ * The FIR filter uses the DSP extension dual 16-bit multiply-accumulate instruction
+ * when the CPU supports it.
+ *
+ * The application must forward all events of the PDM driver to
+ * @ref nrfx_pdm_stream_evt_handle. Processing is performed in that context,
+ * that is, usually in the PDM interrupt.
+ */
+
+/** @brief Maximum number of buffers in the pool. */
+#define NRFX_PDM_STREAM_POOL_SIZE_MAX 32
+
+/** @brief Maximum number of FIR filter taps. */
+#define NRFX_PDM_STREAM_FIR_TAPS_MAX  32
+
+/** @brief Gain value that leaves the samples unchanged. */
+#define NRFX_PDM_STREAM_GAIN_UNITY    256
+
+/**
+ * @brief PDM stream block handler type.
+ *
+ * @param[in] p_block   Pointer to the processed block. The block is placed at
+ *                      the beginning of one of the pool buffers and must be given
+ *                      back with @ref nrfx_pdm_stream_block_free.
+ * @param[in] length    Number of 16-bit samples in the block.
+ * @param[in] p_context Context passed to @ref nrfx_pdm_stream_init.
+ */
+typedef void (* nrfx_pdm_stream_handler_t)(int16_t * p_block, size_t length, void * p_context);
+
+/** @brief PDM stream configuration structure. */
+typedef struct
+{
+    int16_t *       p_pool;        ///< Pool memory of @p buffer_count times @p buffer_length samples.
+    uint16_t        buffer_length; ///< Length of a single pool buffer in 16-bit words.
+                                   /**< Must be even, at most @ref NRFX_PDM_MAX_BUFFER_SIZE
+                                    *   and a multiple of the number of channels
+                                    *   multiplied by @p decimation. */
+    uint8_t         buffer_count;  ///< Number of buffers in the pool.
+                                   /**< At least 3, so that one block can be processed
+                                    *   by the user while the PDM driver fills the other two. */
+    bool            stereo;        ///< PDM driver works in stereo mode, samples are L/R interleaved.
+    bool            mixdown;       ///< Mix stereo samples down to mono. Ignored in mono mode.
+    uint16_t        dc_alpha;      ///< DC removal filter pole in Q15 format, 0 to disable.
+                                   /**< Values closer to 32768 give a lower cut-off frequency. */
+    uint16_t        gain;          ///< Gain in Q8 format. Use @ref NRFX_PDM_STREAM_GAIN_UNITY to disable.
+    uint8_t         decimation;    ///< Decimation factor, 1, 2 or 4.
+    int16_t const * p_fir;         ///< FIR filter coefficients in Q15 format.
+                                   /**< If NULL, built-in anti-aliasing filter for the selected
+                                    *   decimation factor is used. */
+    uint8_t         fir_taps;      ///< Number of FIR filter coefficients. Ignored if @p p_fir is NULL.
+                                   /**< At most @ref NRFX_PDM_STREAM_FIR_TAPS_MAX. The sum of
+                                    *   absolute values of the coefficients must not exceed 2.0. */
+} nrfx_pdm_stream_config_t;
+
+/**
+ * @brief PDM stream default configuration.
+ *
+ * This configuration sets up the PDM stream with the following options:
+ * - mono mode
+ * - DC removal with the cut-off frequency of about 0.0003 of the sampling rate
+ * - unity gain
+ * - no decimation
+ *
+ * @param[in] _p_pool        Pool memory.
+ * @param[in] _buffer_length Length of a single pool buffer in 16-bit words.
+ * @param[in] _buffer_count  Number of buffers in the pool.
+ */
+#define NRFX_PDM_STREAM_DEFAULT_CONFIG(_p_pool, _buffer_length, _buffer_count) \
+{                                                                              \
+    .p_pool        = _p_pool,                                                  \
+    .buffer_length = _buffer_length,                                           \
+    .buffer_count  = _buffer_count,                                            \
+    .stereo        = false,                                                    \
+    .mixdown       = false,                                                    \
+    .dc_alpha      = 32700,                                                    \
+    .gain          = NRFX_PDM_STREAM_GAIN_UNITY,                               \
+    .decimation    = 1,                                                        \
+    .p_fir         = NULL,                                                     \
+    .fir_taps      = 0,                                                        \
+}
+
+/** @brief Structure for PDM stream statistics. */
+typedef struct
+{
+    uint32_t overflow_count;         ///< Number of overflow errors reported by the PDM driver.
+    uint32_t starved_count;          ///< Number of buffer requests that found the pool empty.
+    uint32_t buffer_set_error_count; /**< Number of pool buffers not taken by the PDM driver.
+                                      *   Such a buffer goes back to the pool. */
+} nrfx_pdm_stream_stats_t;
+
+/** @cond Driver internal data. */
+typedef struct
+{
+    int32_t dc_x_prev;
+    int32_t dc_y_prev;
+    uint8_t fir_idx;
+    uint8_t fir_phase;
+    int16_t fir_delay[2 * NRFX_PDM_STREAM_FIR_TAPS_MAX];
+} nrfx_pdm_stream_channel_t;
+
+typedef struct
+{
+    nrfx_pdm_t *              p_pdm;
+    nrfx_pdm_stream_handler_t handler;
+    void *                    p_context;
+    nrfx_pdm_stream_config_t  config;
+    uint8_t                   channels;
+    uint8_t                   fir_taps;
+    int16_t                   fir_coeffs[NRFX_PDM_STREAM_FIR_TAPS_MAX];
+    nrfx_atomic_t             free_mask;
+    bool                      request_pending;
+    nrfx_pdm_stream_stats_t   stats;
+    nrfx_pdm_stream_channel_t channel[2];
+} nrfx_pdm_stream_t;
+/** @endcond */
+
+/**
+ * @brief Function for initializing the PDM stream.
+ *
+ * The PDM driver instance must be initialized before it is started, with the mode
+ * matching @ref nrfx_pdm_stream_config_t.stereo, and its event handler must
+ * forward all events to @ref nrfx_pdm_stream_evt_handle.
+ *
+ * @param[out] p_stream  Pointer to the PDM stream structure.
+ * @param[in]  p_pdm     Pointer to the PDM driver instance.
+ * @param[in]  p_config  Pointer to the structure with the configuration.
+ * @param[in]  handler   Block handler. Cannot be NULL.
+ * @param[in]  p_context Context passed to @p handler.
+ *
+ * @retval 0       Initialization was successful.
+ * @retval -EINVAL The configuration is invalid.
+ */
+int nrfx_pdm_stream_init(nrfx_pdm_stream_t *              p_stream,
+                         nrfx_pdm_t *                     p_pdm,
+                         nrfx_pdm_stream_config_t const * p_config,
+                         nrfx_pdm_stream_handler_t        handler,
+                         void *                           p_context);
+
+/**
+ * @brief Function for handling the PDM driver event.
+ *
+ * Must be called from the PDM driver event handler for every event.
+ *
+ * @param[in] p_stream Pointer to the PDM stream structure.
+ * @param[in] p_evt    Pointer to the PDM event structure.
+ */
+void nrfx_pdm_stream_evt_handle(nrfx_pdm_stream_t *    p_stream,
+                                nrfx_pdm_evt_t const * p_evt);
+
+/**
+ * @brief Function for giving the processed block back to the pool.
+ *
+ * If the PDM driver is waiting for a buffer, the block is supplied to it immediately.
+ *
+ * @param[in] p_stream Pointer to the PDM stream structure.
+ * @param[in] p_block  Pointer to the block passed to the block handler.
+ *
+ * @retval 0       The block was given back.
+ * @retval -EINVAL The block does not belong to the pool or is already free.
+ */
+int nrfx_pdm_stream_block_free(nrfx_pdm_stream_t * p_stream, int16_t * p_block);
+
+/**
+ * @brief Function for getting the PDM stream statistics.
+ *
+ * @param[in]  p_stream Pointer to the PDM stream structure.
+ * @param[out] p_stats  Pointer to the structure to be filled with statistics.
+ */
+void nrfx_pdm_stream_stats_get(nrfx_pdm_stream_t const * p_stream,
+                               nrfx_pdm_stream_stats_t * p_stats);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_PDM_STREAM_H__
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+#include <nrfx.h>
+#include <helpers/nrfx_trace.h>
+
+#if NRFX_CHECK(NRFX_TRACE_ENABLED) && !NRFX_TRACE_BACKEND_STM
+
+#if !defined(NRFX_TRACE_TIMESTAMP_GET)
+#error "NRFX_TRACE_TIMESTAMP_GET must be defined for the RAM backend."
+#endif
+
+typedef struct
+{
+    nrfx_trace_record_t * p_records;
+    uint32_t              mask;
+    nrfx_atomic_t         wr_idx;   /* Number of records reserved so far. */
+    uint32_t              rd_idx;   /* Number of records consumed by the reader. */
+} trace_ring_t;
+
+static trace_ring_t m_ring;
+
+int nrfx_trace_ring_init(nrfx_trace_record_t * p_records, uint32_t count)
+{
+    NRFX_ASSERT(p_records);
+
+    if ((count == 0) || (count & (count - 1)))
+    {
+        return -EINVAL;
+    }
+
+    memset(p_records, 0, count * sizeof(nrfx_trace_record_t));
+    m_ring.p_records = p_records;
+    m_ring.mask      = count - 1;
+    m_ring.wr_idx    = 0;
+    m_ring.rd_idx    = 0;
+
+#if defined(DWT_CTRL_CYCCNTENA_Msk)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    return 0;
+}
+
+void nrfx_trace_ring_put(uint16_t id, nrfx_trace_type_t type, uint32_t data)
+{
+    uint32_t timestamp = NRFX_TRACE_TIMESTAMP_GET();
+
+    if (m_ring.p_records == NULL)
+    {
+        return;
+    }
+
+    uint32_t              idx      = NRFX_ATOMIC_FETCH_ADD(&m_ring.wr_idx, 1);
+    nrfx_trace_record_t * p_record = &m_ring.p_records[idx & m_ring.mask];
+
+    /* Invalidate the slot first, so the reader does not take a partially written record
+     * for the one that is being overwritten. */
+    p_record->seq = 0;
+    __DMB();
+    p_record->timestamp = timestamp;
+    p_record->data      = data;
+    p_record->id        = id;
+    p_record->type      = (uint8_t)type;
+    __DMB();
+    p_record->seq = idx + 1;
+}
+
+uint32_t nrfx_trace_ring_read(nrfx_trace_record_t * p_records,
+                              uint32_t              max_count,
+                              uint32_t *            p_dropped)
+{
+    NRFX_ASSERT(p_records);
+    NRFX_ASSERT(m_ring.p_records);
+
+    uint32_t wr_idx  = m_ring.wr_idx;
+    uint32_t dropped = 0;
+    uint32_t count   = 0;
+
+    if (wr_idx - m_ring.rd_idx > m_ring.mask + 1)
+    {
+        dropped = wr_idx - m_ring.rd_idx - (m_ring.mask + 1);
+        m_ring.rd_idx += dropped;
+    }
+
+    while ((count < max_count) && (m_ring.rd_idx != wr_idx))
+    {
+        nrfx_trace_record_t const * p_record = &m_ring.p_records[m_ring.rd_idx & m_ring.mask];
+
+        p_records[count] = *p_record;
+        __DMB();
+        if ((p_records[count].seq != m_ring.rd_idx + 1) || (p_record->seq != m_ring.rd_idx + 1))
+        {
+            /* The record is being written or was overwritten while being copied. */
+            break;
+        }
+        m_ring.rd_idx++;
+        count++;
+    }
+
+    if (p_dropped)
+    {
+        *p_dropped = dropped;
+    }
+    return count;
+}
+
+#endif // NRFX_CHECK(NRFX_TRACE_ENABLED) && !NRFX_TRACE_BACKEND_STM
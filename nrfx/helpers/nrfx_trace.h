@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#ifndef NRFX_TRACE_H__
+#define NRFX_TRACE_H__
+
+#include <nrfx.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_trace Generic event tracing layer
+ * @{
+ * @ingroup nrfx
+ *
+ * @brief Helper layer for low-overhead tracing of events identified by numeric IDs.
+ *
+ * Each event is emitted with one of the @ref NRFX_TRACE_BEGIN, @ref NRFX_TRACE_END or
+ * @ref NRFX_TRACE_POINT macros. The begin and end events of the same ID delimit
+ * an interval, for example the time from an interrupt to the processing of its data,
+ * so a decoder can reconstruct the latency distribution of each event ID.
+ *
+ * Two backends are available:
+ * - STM backend, used on devices with the System Trace Macrocell extended stimulus ports.
+ *   Every event is a single store to the stimulus port @ref NRFX_TRACE_CONFIG_STM_PORT_BASE
+ *   + ID, which the STM timestamps and emits as an STPv2 packet. Begin events are
+ *   marked data packets, end events are data packets and point events are flag packets.
+ *   The invariant timing stimulus port variants are used, so the CPU is never stalled.
+ *   The STM and the trace sink must be set up by the debug infrastructure.
+ * - RAM backend, used on the other devices, on host builds or when
+ *   @ref NRFX_TRACE_CONFIG_RAM_BACKEND is set. Events are stored as
+ *   @ref nrfx_trace_record_t records in a ring buffer that overwrites the oldest records.
+ *   Timestamps are taken with @ref NRFX_TRACE_TIMESTAMP_GET.
+ *
+ * The macros expand to nothing unless NRFX_TRACE_ENABLED is set.
+ */
+
+#ifndef NRFX_TRACE_CONFIG_STM_PORT_BASE
+/** @brief First STM stimulus port used for the events. */
+#define NRFX_TRACE_CONFIG_STM_PORT_BASE 0
+#endif
+
+#if (defined(NRF_STMESP) && !NRFX_CHECK(NRFX_TRACE_CONFIG_RAM_BACKEND)) || \
+    defined(__NRFX_DOXYGEN__)
+/** @brief Symbol indicating whether the STM backend is used. */
+#define NRFX_TRACE_BACKEND_STM 1
+#else
+#define NRFX_TRACE_BACKEND_STM 0
+#endif
+
+/** @brief Event types. */
+typedef enum
+{
+    NRFX_TRACE_TYPE_BEGIN = 1, ///< Beginning of an interval.
+    NRFX_TRACE_TYPE_END   = 2, ///< End of an interval.
+    NRFX_TRACE_TYPE_POINT = 3, ///< Single point in time.
+} nrfx_trace_type_t;
+
+/**
+ * @brief Structure of the event record stored by the RAM backend.
+ *
+ * The records are also the input of the decoder, see @ref nrfx_trace_decode.
+ */
+typedef struct
+{
+    uint32_t seq;       ///< Sequence number of the record, starting from 1. 0 means never written.
+    uint32_t timestamp; ///< Timestamp of the event.
+    uint32_t data;      ///< Data of the event. 0 for point events.
+    uint16_t id;        ///< Event ID.
+    uint8_t  type;      ///< Event type, one of @ref nrfx_trace_type_t.
+    uint8_t  reserved;  ///< Reserved.
+} nrfx_trace_record_t;
+
+#if !NRFX_TRACE_BACKEND_STM || defined(__NRFX_DOXYGEN__)
+
+#if !defined(NRFX_TRACE_TIMESTAMP_GET) && defined(DWT_CTRL_CYCCNTENA_Msk)
+/**
+ * @brief Macro for getting the timestamp of an event stored by the RAM backend.
+ *
+ * By default, the DWT cycle counter is used where available. It is enabled by
+ * @ref nrfx_trace_ring_init. Other builds must define this macro.
+ */
+#define NRFX_TRACE_TIMESTAMP_GET() (DWT->CYCCNT)
+#endif
+
+/**
+ * @brief Function for initializing the RAM backend.
+ *
+ * The RAM backend functions are available only when NRFX_TRACE_ENABLED is set.
+ *
+ * @param[in] p_records Pointer to the memory for the records.
+ * @param[in] count     Number of records in @p p_records. Must be a power of 2.
+ *
+ * @retval 0       Initialization was successful.
+ * @retval -EINVAL The number of records is not a power of 2.
+ */
+int nrfx_trace_ring_init(nrfx_trace_record_t * p_records, uint32_t count);
+
+/**
+ * @brief Function for reading the records stored since the previous read.
+ *
+ * The records are copied in the order in which they were stored. Reading stops at
+ * a record that is still being written by an interrupted context.
+ *
+ * @param[out] p_records Pointer to the buffer for the records.
+ * @param[in]  max_count Maximum number of records to read.
+ * @param[out] p_dropped Number of records overwritten before they could be read.
+ *                       Can be NULL.
+ *
+ * @return Number of records read.
+ */
+uint32_t nrfx_trace_ring_read(nrfx_trace_record_t * p_records,
+                              uint32_t              max_count,
+                              uint32_t *            p_dropped);
+
+/**
+ * @brief Function for storing an event in the RAM backend.
+ *
+ * The function is safe to be called from any context. Use the event macros instead
+ * of calling it directly.
+ *
+ * @param[in] id   Event ID.
+ * @param[in] type Event type.
+ * @param[in] data Event data.
+ */
+void nrfx_trace_ring_put(uint16_t id, nrfx_trace_type_t type, uint32_t data);
+
+#endif // !NRFX_TRACE_BACKEND_STM || defined(__NRFX_DOXYGEN__)
+
+#if NRFX_CHECK(NRFX_TRACE_ENABLED) || defined(__NRFX_DOXYGEN__)
+#if NRFX_TRACE_BACKEND_STM || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Macro for emitting the beginning of an interval.
+ *
+ * @param[in] id   Event ID.
+ * @param[in] data 32-bit event data.
+ */
+#define NRFX_TRACE_BEGIN(id, data) \
+    (NRF_STMESP[NRFX_TRACE_CONFIG_STM_PORT_BASE + (id)].I_DMTS[0] = (uint32_t)(data))
+
+/**
+ * @brief Macro for emitting the end of an interval.
+ *
+ * @param[in] id   Event ID.
+ * @param[in] data 32-bit event data.
+ */
+#define NRFX_TRACE_END(id, data) \
+    (NRF_STMESP[NRFX_TRACE_CONFIG_STM_PORT_BASE + (id)].I_DTS[0] = (uint32_t)(data))
+
+/**
+ * @brief Macro for emitting a point event.
+ *
+ * @param[in] id Event ID.
+ */
+#define NRFX_TRACE_POINT(id) \
+    (NRF_STMESP[NRFX_TRACE_CONFIG_STM_PORT_BASE + (id)].I_FLAGTS[0] = 0)
+#else
+#define NRFX_TRACE_BEGIN(id, data) \
+    nrfx_trace_ring_put((id), NRFX_TRACE_TYPE_BEGIN, (uint32_t)(data))
+#define NRFX_TRACE_END(id, data) \
+    nrfx_trace_ring_put((id), NRFX_TRACE_TYPE_END, (uint32_t)(data))
+#define NRFX_TRACE_POINT(id) \
+    nrfx_trace_ring_put((id), NRFX_TRACE_TYPE_POINT, 0)
+#endif
+#else
+#define NRFX_TRACE_BEGIN(id, data)
+#define NRFX_TRACE_END(id, data)
+#define NRFX_TRACE_POINT(id)
+#endif // NRFX_CHECK(NRFX_TRACE_ENABLED) || defined(__NRFX_DOXYGEN__)
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_TRACE_H__
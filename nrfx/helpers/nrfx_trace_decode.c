@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+#include <helpers/nrfx_trace_decode.h>
+
+static uint32_t bucket_get(uint32_t length)
+{
+    return (length == 0) ? 0 : (32 - NRFX_CLZ(length));
+}
+
+static uint32_t bucket_limit_get(uint32_t bucket)
+{
+    return (bucket == 0) ? 0 : (uint32_t)((1ULL << bucket) - 1);
+}
+
+static void interval_add(nrfx_trace_decode_stat_t * p_stat, uint32_t length)
+{
+    if ((p_stat->count == 0) || (length < p_stat->min))
+    {
+        p_stat->min = length;
+    }
+    if (length > p_stat->max)
+    {
+        p_stat->max = length;
+    }
+    p_stat->sum += length;
+    p_stat->count++;
+    p_stat->buckets[bucket_get(length)]++;
+}
+
+/* Discards the intervals which may have lost their end events. */
+static void open_intervals_drop(nrfx_trace_decode_t * p_decode)
+{
+    for (uint16_t id = 0; id < p_decode->id_count; id++)
+    {
+        p_decode->p_stats[id].open = false;
+    }
+}
+
+void nrfx_trace_decode_init(nrfx_trace_decode_t *      p_decode,
+                            nrfx_trace_decode_stat_t * p_stats,
+                            uint16_t                   id_count)
+{
+    NRFX_ASSERT(p_decode);
+    NRFX_ASSERT(p_stats || (id_count == 0));
+
+    memset(p_decode, 0, sizeof(*p_decode));
+    memset(p_stats, 0, id_count * sizeof(nrfx_trace_decode_stat_t));
+    p_decode->p_stats  = p_stats;
+    p_decode->id_count = id_count;
+}
+
+void nrfx_trace_decode_feed(nrfx_trace_decode_t *       p_decode,
+                            nrfx_trace_record_t const * p_records,
+                            uint32_t                    count)
+{
+    NRFX_ASSERT(p_decode);
+    NRFX_ASSERT(p_records || (count == 0));
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        nrfx_trace_record_t const * p_record = &p_records[i];
+
+        if ((p_decode->next_seq != 0) && (p_record->seq != p_decode->next_seq))
+        {
+            p_decode->dropped += p_record->seq - p_decode->next_seq;
+            open_intervals_drop(p_decode);
+        }
+        p_decode->next_seq = p_record->seq + 1;
+        p_decode->records++;
+
+        if (p_record->id >= p_decode->id_count)
+        {
+            p_decode->ignored++;
+            continue;
+        }
+
+        nrfx_trace_decode_stat_t * p_stat = &p_decode->p_stats[p_record->id];
+
+        switch (p_record->type)
+        {
+            case NRFX_TRACE_TYPE_BEGIN:
+                if (p_stat->open)
+                {
+                    p_stat->unmatched++;
+                }
+                p_stat->begin_timestamp = p_record->timestamp;
+                p_stat->open            = true;
+                break;
+
+            case NRFX_TRACE_TYPE_END:
+                if (p_stat->open)
+                {
+                    /* Unsigned subtraction handles the wrap of the timestamp. */
+                    interval_add(p_stat, p_record->timestamp - p_stat->begin_timestamp);
+                    p_stat->open = false;
+                }
+                else
+                {
+                    p_stat->unmatched++;
+                }
+                break;
+
+            case NRFX_TRACE_TYPE_POINT:
+                p_stat->points++;
+                break;
+
+            default:
+                p_decode->ignored++;
+                break;
+        }
+    }
+}
+
+uint32_t nrfx_trace_decode_percentile_get(nrfx_trace_decode_stat_t const * p_stat,
+                                          uint8_t                         percent)
+{
+    NRFX_ASSERT(p_stat);
+    NRFX_ASSERT((percent > 0) && (percent <= 100));
+
+    if (p_stat->count == 0)
+    {
+        return 0;
+    }
+
+    uint64_t rank  = NRFX_CEIL_DIV((uint64_t)p_stat->count * percent, 100);
+    uint64_t total = 0;
+
+    for (uint32_t bucket = 0; bucket < NRFX_TRACE_DECODE_BUCKETS; bucket++)
+    {
+        total += p_stat->buckets[bucket];
+        if (total >= rank)
+        {
+            uint32_t limit = bucket_limit_get(bucket);
+
+            return NRFX_MIN(limit, p_stat->max);
+        }
+    }
+
+    return p_stat->max;
+}
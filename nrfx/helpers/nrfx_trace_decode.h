@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_TRACE_DECODE_H__
+#define NRFX_TRACE_DECODE_H__
+
+#include <nrfx.h>
+#include <helpers/nrfx_trace.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_trace_decode Trace decoder
+ * @{
+ * @ingroup nrfx_trace
+ *
+ * @brief Decoder of the trace records reconstructing the latency distribution of each event ID.
+ *
+ * The records read from the RAM backend are fed to the decoder in the order of their sequence
+ * numbers, in chunks of any size. The begin and end events of the same ID are matched into
+ * intervals, and the length of each interval, in timestamp units, is added to a histogram
+ * with logarithmic buckets together with its minimum, maximum and sum. Point events are
+ * counted. The decoder uses no hardware, so it can run on the device or on a host that
+ * received the records. Events captured with the STM backend can be decoded after their
+ * STPv2 packets are converted to records by the trace tooling.
+ *
+ * A gap in the sequence numbers means that records were overwritten before being read.
+ * The intervals open at that time are discarded, as their end events may have been lost,
+ * so that the lost records never produce a wrong interval length.
+ */
+
+/** @brief Number of histogram buckets. Bucket n holds the lengths from 2^(n-1) to 2^n - 1. */
+#define NRFX_TRACE_DECODE_BUCKETS 33
+
+/** @brief Structure of the statistics of a single event ID. */
+typedef struct
+{
+    uint32_t count;                               ///< Number of intervals.
+    uint32_t min;                                 ///< Shortest interval.
+    uint32_t max;                                 ///< Longest interval.
+    uint64_t sum;                                 ///< Sum of the interval lengths.
+    uint32_t points;                              ///< Number of point events.
+    uint32_t unmatched;                           /**< Number of begin events without an end
+                                                   *   and end events without a begin. */
+    uint32_t buckets[NRFX_TRACE_DECODE_BUCKETS];  ///< Histogram of the interval lengths.
+    /** @cond Driver internal data. */
+    uint32_t begin_timestamp;
+    bool     open;
+    /** @endcond */
+} nrfx_trace_decode_stat_t;
+
+/** @brief Structure of the decoder. */
+typedef struct
+{
+    nrfx_trace_decode_stat_t * p_stats;  ///< Statistics, indexed by the event ID.
+    uint16_t                   id_count; ///< Number of elements in @p p_stats.
+    uint32_t                   records;  ///< Number of decoded records.
+    uint32_t                   dropped;  ///< Number of records lost before decoding.
+    uint32_t                   ignored;  ///< Number of records with an ID out of range.
+    /** @cond Driver internal data. */
+    uint32_t                   next_seq;
+    /** @endcond */
+} nrfx_trace_decode_t;
+
+/**
+ * @brief Function for initializing the decoder.
+ *
+ * @param[out] p_decode Pointer to the decoder.
+ * @param[in]  p_stats  Pointer to the statistics of the event IDs from 0 to @p id_count - 1.
+ * @param[in]  id_count Number of elements in @p p_stats.
+ */
+void nrfx_trace_decode_init(nrfx_trace_decode_t *      p_decode,
+                            nrfx_trace_decode_stat_t * p_stats,
+                            uint16_t                   id_count);
+
+/**
+ * @brief Function for decoding the records.
+ *
+ * @param[in,out] p_decode  Pointer to the decoder.
+ * @param[in]     p_records Pointer to the records, in the order of their sequence numbers.
+ * @param[in]     count     Number of records.
+ */
+void nrfx_trace_decode_feed(nrfx_trace_decode_t *       p_decode,
+                            nrfx_trace_record_t const * p_records,
+                            uint32_t                    count);
+
+/**
+ * @brief Function for getting the upper bound of a percentile of the interval lengths.
+ *
+ * The result is the upper limit of the histogram bucket holding the percentile, limited
+ * to the longest interval.
+ *
+ * @param[in] p_stat  Pointer to the statistics of the event ID.
+ * @param[in] percent Percentile, from 1 to 100.
+ *
+ * @return Upper bound of the percentile, or 0 if there are no intervals.
+ */
+uint32_t nrfx_trace_decode_percentile_get(nrfx_trace_decode_stat_t const * p_stat,
+                                          uint8_t                         percent);
+
+/**
+ * @brief Function for getting the mean interval length.
+ *
+ * @param[in] p_stat Pointer to the statistics of the event ID.
+ *
+ * @return Mean interval length, rounded down, or 0 if there are no intervals.
+ */
+NRFX_STATIC_INLINE uint32_t nrfx_trace_decode_mean_get(nrfx_trace_decode_stat_t const * p_stat);
+
+#ifndef NRFX_DECLARE_ONLY
+NRFX_STATIC_INLINE uint32_t nrfx_trace_decode_mean_get(nrfx_trace_decode_stat_t const * p_stat)
+{
+    return p_stat->count ? (uint32_t)(p_stat->sum / p_stat->count) : 0;
+}
+#endif // NRFX_DECLARE_ONLY
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_TRACE_DECODE_H__
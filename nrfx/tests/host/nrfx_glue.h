@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_GLUE_H__
+#define NRFX_GLUE_H__
+
+/*
+ * nrfx integration for the host test. Interrupts are not preempting, the test calls
+ * the interrupt handlers of the drivers itself, so the critical sections are empty.
+ * The interrupt controller is modeled by the test, see nrfx_host_test.h.
+ */
+
+#include <assert.h>
+#include "nrfx_host_cmsis.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NRFX_ASSERT(expression) assert(expression)
+
+#define NRFX_STATIC_ASSERT(expression) _Static_assert(expression, "unspecified message")
+
+#define NRFX_IRQ_PRIORITY_SET(irq_number, priority) \
+    nrfx_host_irq_priority_set((int)(irq_number), (uint8_t)(priority))
+
+#define NRFX_IRQ_ENABLE(irq_number)         nrfx_host_irq_enable((int)(irq_number))
+
+#define NRFX_IRQ_IS_ENABLED(irq_number)     nrfx_host_irq_enable_check((int)(irq_number))
+
+#define NRFX_IRQ_DISABLE(irq_number)        nrfx_host_irq_disable((int)(irq_number))
+
+#define NRFX_IRQ_PENDING_SET(irq_number)    nrfx_host_irq_pending_set((int)(irq_number))
+
+#define NRFX_IRQ_PENDING_CLEAR(irq_number)  nrfx_host_irq_pending_clear((int)(irq_number))
+
+#define NRFX_IRQ_IS_PENDING(irq_number)     nrfx_host_irq_pending_check((int)(irq_number))
+
+#define NRFX_CRITICAL_SECTION_ENTER() do {
+
+#define NRFX_CRITICAL_SECTION_EXIT()  } while (0)
+
+#define NRFX_COREDEP_DELAY_DWT_BASED    0
+
+#define NRFX_DELAY_US(us_time) (void)(us_time)
+
+#define nrfx_atomic_t uint32_t
+
+#define NRFX_ATOMIC_FETCH_STORE(p_data, value) \
+    __atomic_exchange_n((p_data), (value), __ATOMIC_SEQ_CST)
+
+#define NRFX_ATOMIC_FETCH_OR(p_data, value)  __atomic_fetch_or((p_data), (value), __ATOMIC_SEQ_CST)
+
+#define NRFX_ATOMIC_FETCH_AND(p_data, value) __atomic_fetch_and((p_data), (value), __ATOMIC_SEQ_CST)
+
+#define NRFX_ATOMIC_FETCH_XOR(p_data, value) __atomic_fetch_xor((p_data), (value), __ATOMIC_SEQ_CST)
+
+#define NRFX_ATOMIC_FETCH_ADD(p_data, value) __atomic_fetch_add((p_data), (value), __ATOMIC_SEQ_CST)
+
+#define NRFX_ATOMIC_FETCH_SUB(p_data, value) __atomic_fetch_sub((p_data), (value), __ATOMIC_SEQ_CST)
+
+#define NRFX_ATOMIC_CAS(p_data, old_value, new_value)                               \
+    ({                                                                              \
+        uint32_t _old = (old_value);                                                \
+        __atomic_compare_exchange_n((p_data), &_old, (new_value), false,            \
+                                    __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);            \
+    })
+
+#define NRFX_CLZ(value) (uint32_t)__builtin_clz(value)
+
+#define NRFX_CTZ(value) (uint32_t)__builtin_ctz(value)
+
+#define NRFX_EVENT_READBACK_ENABLED 1
+
+#define NRFY_CACHE_WB(p_buffer, size)    do { (void)(p_buffer); (void)(size); } while (0)
+
+#define NRFY_CACHE_INV(p_buffer, size)   do { (void)(p_buffer); (void)(size); } while (0)
+
+#define NRFY_CACHE_WBINV(p_buffer, size) do { (void)(p_buffer); (void)(size); } while (0)
+
+#define NRFX_DPPI_CHANNELS_USED   0
+
+#define NRFX_DPPI_GROUPS_USED     0
+
+#define NRFX_PPI_CHANNELS_USED    0
+
+#define NRFX_PPI_GROUPS_USED      0
+
+#define NRFX_GPIOTE_CHANNELS_USED 0
+
+#define NRFX_EGUS_USED            0
+
+#define NRFX_TIMERS_USED          0
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_GLUE_H__
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_HOST_CMSIS_H__
+#define NRFX_HOST_CMSIS_H__
+
+/*
+ * Stand-in of the CMSIS core header for the host test. It provides the compiler
+ * qualifiers, intrinsics and core peripherals that are referenced by the MDK and nrfx.
+ * Barriers and hint instructions have no effect on the host, the core peripherals are
+ * plain memory owned by the test.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define __I     volatile const
+#define __O     volatile
+#define __IO    volatile
+#define __IM    volatile const
+#define __OM    volatile
+#define __IOM   volatile
+
+#ifndef __ASM
+#define __ASM                   __asm
+#endif
+#ifndef __INLINE
+#define __INLINE                inline
+#endif
+#ifndef __STATIC_INLINE
+#define __STATIC_INLINE         static inline
+#endif
+#ifndef __STATIC_FORCEINLINE
+#define __STATIC_FORCEINLINE    __attribute__((always_inline)) static inline
+#endif
+#ifndef __ALIGNED
+#define __ALIGNED(x)            __attribute__((aligned(x)))
+#endif
+#ifndef __PACKED
+#define __PACKED                __attribute__((packed))
+#endif
+#ifndef __WEAK
+#define __WEAK                  __attribute__((weak))
+#endif
+#ifndef __UNUSED
+#define __UNUSED                __attribute__((unused))
+#endif
+
+#define __NOP() do { } while (0)
+#define __WFE() do { } while (0)
+#define __WFI() do { } while (0)
+#define __SEV() do { } while (0)
+#define __ISB() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __DSB() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __DMB() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+#define __CLZ(value)  (uint8_t)(((value) == 0) ? 32 : __builtin_clz(value))
+#define __REV(value)  __builtin_bswap32(value)
+#define __RBIT(value) nrfx_host_rbit(value)
+
+__STATIC_INLINE uint32_t nrfx_host_rbit(uint32_t value)
+{
+    uint32_t result = 0;
+
+    for (uint32_t i = 0; i < 32; i++)
+    {
+        result = (result << 1) | ((value >> i) & 1);
+    }
+    return result;
+}
+
+#define __get_PRIMASK()       0u
+#define __set_PRIMASK(value)  (void)(value)
+#define __get_IPSR()          0u
+#define __disable_irq()       do { } while (0)
+#define __enable_irq()        do { } while (0)
+
+typedef struct
+{
+    __IOM uint32_t CTRL;
+    __IOM uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+    __IOM uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct
+{
+    __IOM uint32_t CPACR;
+    __IOM uint32_t ICSR;
+    __IOM uint32_t AIRCR;
+    __IOM uint32_t SCR;
+    __IOM uint32_t CCR;
+    __IOM uint32_t NSACR;
+} SCB_Type;
+
+typedef struct
+{
+    __IOM uint32_t CTRL;
+    __IOM uint32_t LOAD;
+    __IOM uint32_t VAL;
+    __IM  uint32_t CALIB;
+} SysTick_Type;
+
+extern DWT_Type *       DWT;
+extern CoreDebug_Type * CoreDebug;
+extern SCB_Type *       SCB;
+extern SysTick_Type *   SysTick;
+
+#define DWT_CTRL_CYCCNTENA_Msk      (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk  (1UL << 24)
+
+#define SysTick_CTRL_ENABLE_Pos     0
+#define SysTick_CTRL_ENABLE_Msk     (1UL << SysTick_CTRL_ENABLE_Pos)
+#define SysTick_CTRL_TICKINT_Pos    1
+#define SysTick_CTRL_TICKINT_Msk    (1UL << SysTick_CTRL_TICKINT_Pos)
+#define SysTick_CTRL_CLKSOURCE_Pos  2
+#define SysTick_CTRL_CLKSOURCE_Msk  (1UL << SysTick_CTRL_CLKSOURCE_Pos)
+#define SysTick_CTRL_COUNTFLAG_Pos  16
+#define SysTick_CTRL_COUNTFLAG_Msk  (1UL << SysTick_CTRL_COUNTFLAG_Pos)
+#define SysTick_LOAD_RELOAD_Msk     0xFFFFFFUL
+#define SysTick_VAL_CURRENT_Msk     0xFFFFFFUL
+#define SysTick_CALIB_NOREF_Msk     (1UL << 31)
+#define SysTick_CALIB_SKEW_Msk      (1UL << 30)
+#define SysTick_CALIB_TENMS_Msk     0xFFFFFFUL
+
+/* The interrupt controller is modeled by the test, see nrfx_glue.h. */
+void     nrfx_host_irq_priority_set(int irq_number, uint8_t priority);
+void     nrfx_host_irq_enable(int irq_number);
+bool     nrfx_host_irq_enable_check(int irq_number);
+void     nrfx_host_irq_disable(int irq_number);
+void     nrfx_host_irq_pending_set(int irq_number);
+void     nrfx_host_irq_pending_clear(int irq_number);
+bool     nrfx_host_irq_pending_check(int irq_number);
+
+#define NVIC_SetPriority(irq_number, priority) \
+    nrfx_host_irq_priority_set((int)(irq_number), (uint8_t)(priority))
+#define NVIC_EnableIRQ(irq_number)       nrfx_host_irq_enable((int)(irq_number))
+#define NVIC_GetEnableIRQ(irq_number)    (uint32_t)nrfx_host_irq_enable_check((int)(irq_number))
+#define NVIC_DisableIRQ(irq_number)      nrfx_host_irq_disable((int)(irq_number))
+#define NVIC_SetPendingIRQ(irq_number)   nrfx_host_irq_pending_set((int)(irq_number))
+#define NVIC_ClearPendingIRQ(irq_number) nrfx_host_irq_pending_clear((int)(irq_number))
+#define NVIC_GetPendingIRQ(irq_number)   (uint32_t)nrfx_host_irq_pending_check((int)(irq_number))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_HOST_CMSIS_H__
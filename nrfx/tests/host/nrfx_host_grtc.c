@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Model of the GRTC driver with a simulated SYSCOUNTER.
+ *
+ * Layers built on top of the GRTC driver use its channel allocation, the SYSCOUNTER and
+ * the compare and capture functions. The model replaces the driver with these functions,
+ * keeping the compare and capture values in the CC registers of the register model, and lets
+ * the test advance the SYSCOUNTER and dispatch the compare callbacks as the interrupt would.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_GRTC_ENABLED)
+#include <nrfx_grtc.h>
+#include "nrfx_host_test.h"
+
+static struct
+{
+    uint64_t               now;
+    uint32_t               alloc_mask;
+    uint32_t               armed_mask;
+    nrfx_grtc_cc_handler_t handlers[NRF_GRTC_SYSCOUNTER_CC_COUNT];
+    void *                 p_contexts[NRF_GRTC_SYSCOUNTER_CC_COUNT];
+} m_grtc;
+
+void nrfx_host_grtc_reset(uint64_t now)
+{
+    memset(&m_grtc, 0, sizeof(m_grtc));
+    nrfx_host_reg_reset(NRF_GRTC, sizeof(*NRF_GRTC));
+    m_grtc.now = now;
+}
+
+uint32_t nrfx_host_grtc_run(uint64_t until)
+{
+    uint32_t wakeups = 0;
+
+    for (;;)
+    {
+        uint64_t earliest = UINT64_MAX;
+        uint8_t  channel  = 0;
+
+        for (uint8_t i = 0; i < NRF_GRTC_SYSCOUNTER_CC_COUNT; i++)
+        {
+            uint64_t cc = nrf_grtc_sys_counter_cc_get(NRF_GRTC, i);
+
+            if ((m_grtc.armed_mask & NRFX_BIT(i)) && (cc < earliest))
+            {
+                earliest = cc;
+                channel  = i;
+            }
+        }
+
+        if (earliest > until)
+        {
+            break;
+        }
+
+        /* Compare value in the past expires at once. */
+        m_grtc.now         = NRFX_MAX(m_grtc.now, earliest);
+        m_grtc.armed_mask &= ~NRFX_BIT(channel);
+        wakeups++;
+        if (m_grtc.handlers[channel])
+        {
+            m_grtc.handlers[channel]((int32_t)channel, earliest, m_grtc.p_contexts[channel]);
+        }
+    }
+
+    m_grtc.now = NRFX_MAX(m_grtc.now, until);
+    return wakeups;
+}
+
+bool nrfx_host_grtc_next_get(uint64_t * p_time)
+{
+    bool found = false;
+
+    for (uint8_t i = 0; i < NRF_GRTC_SYSCOUNTER_CC_COUNT; i++)
+    {
+        uint64_t cc = nrf_grtc_sys_counter_cc_get(NRF_GRTC, i);
+
+        if ((m_grtc.armed_mask & NRFX_BIT(i)) && (!found || (cc < *p_time)))
+        {
+            *p_time = cc;
+            found   = true;
+        }
+    }
+
+    return found;
+}
+
+uint32_t nrfx_host_grtc_alloc_mask_get(void)
+{
+    return m_grtc.alloc_mask;
+}
+
+int nrfx_grtc_channel_alloc(uint8_t * p_channel)
+{
+    for (uint8_t i = 0; i < NRF_GRTC_SYSCOUNTER_CC_COUNT; i++)
+    {
+        if (!(m_grtc.alloc_mask & NRFX_BIT(i)))
+        {
+            m_grtc.alloc_mask |= NRFX_BIT(i);
+            *p_channel = i;
+            return 0;
+        }
+    }
+
+    return -ENOMEM;
+}
+
+int nrfx_grtc_channel_free(uint8_t channel)
+{
+    if (!(m_grtc.alloc_mask & NRFX_BIT(channel)))
+    {
+        return -EINVAL;
+    }
+
+    m_grtc.alloc_mask &= ~NRFX_BIT(channel);
+    m_grtc.armed_mask &= ~NRFX_BIT(channel);
+    m_grtc.handlers[channel] = NULL;
+    return 0;
+}
+
+void nrfx_grtc_channel_callback_set(uint8_t                channel,
+                                    nrfx_grtc_cc_handler_t handler,
+                                    void *                 p_context)
+{
+    CHECK(m_grtc.alloc_mask & NRFX_BIT(channel));
+    m_grtc.handlers[channel]   = handler;
+    m_grtc.p_contexts[channel] = p_context;
+}
+
+uint64_t nrfx_grtc_syscounter_get(void)
+{
+    return m_grtc.now;
+}
+
+void nrfx_grtc_syscounter_cc_abs_set(uint8_t channel, uint64_t val, bool safe_setting)
+{
+    (void)safe_setting;
+    CHECK(m_grtc.alloc_mask & NRFX_BIT(channel));
+    nrf_grtc_sys_counter_cc_set(NRF_GRTC, channel, val);
+    nrf_grtc_sys_counter_compare_event_enable(NRF_GRTC, channel);
+    m_grtc.armed_mask |= NRFX_BIT(channel);
+}
+
+int nrfx_grtc_syscounter_cc_int_disable(uint8_t channel)
+{
+    if (!(m_grtc.alloc_mask & NRFX_BIT(channel)))
+    {
+        return -EINVAL;
+    }
+
+    m_grtc.armed_mask &= ~NRFX_BIT(channel);
+    return 0;
+}
+
+int nrfx_grtc_syscounter_capture(uint8_t channel)
+{
+    if (!(m_grtc.alloc_mask & NRFX_BIT(channel)))
+    {
+        return -EINVAL;
+    }
+
+    nrf_grtc_sys_counter_cc_set(NRF_GRTC, channel, m_grtc.now);
+    return 0;
+}
+
+#endif // NRFX_CHECK(NRFX_GRTC_ENABLED)
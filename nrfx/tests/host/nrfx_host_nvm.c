@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Model of the NVMC and RRAMC drivers with a simulated non-volatile memory.
+ *
+ * Layers built on top of the controller drivers use their write and erase functions.
+ * The model replaces the drivers with these functions, keeps the memory content in a buffer
+ * and accounts the time for which the CPU is blocked by each operation, so that the test
+ * can check the duration of the steps of a layer.
+ *
+ * On NVMC, a write can only clear bits, so a write to memory that was not erased is
+ * reported as a failed check. A page is erased after the accumulated duration of its partial
+ * erases reaches the duration of the page erase. On RRAMC, written data is accounted when
+ * the write buffer is committed.
+ *
+ * The durations are approximate values for comparing the steps, not the maximum ones
+ * from the Product Specification.
+ */
+
+#include <nrfx.h>
+#include "nrfx_host_test.h"
+
+#if defined(NVMC_PRESENT)
+#include <nrfx_nvmc.h>
+
+/* Page size and durations of the nRF52840 NVMC operations. */
+#define NVM_PAGE_SIZE     4096UL
+#define NVM_WORD_WRITE_US 41UL
+#define NVM_PAGE_ERASE_US 85000UL
+#elif defined(RRAMC_PRESENT)
+#include <nrfx_rramc.h>
+
+/* Write buffer line and duration of its write. */
+#define NVM_LINE_SIZE     16UL
+#define NVM_LINE_WRITE_US 22UL
+#endif
+
+#if defined(NVM_PAGE_SIZE) || defined(NVM_LINE_SIZE)
+
+static struct
+{
+    uint8_t  mem[NRFX_HOST_NVM_SIZE];
+    uint64_t busy_us;
+    int      erase_error;
+#if defined(NVMC_PRESENT)
+    uint32_t partial_address;
+    uint32_t partial_us;
+    uint32_t partial_done_us;
+#else
+    uint32_t uncommitted;
+#endif
+} m_nvm;
+
+static uint8_t * nvm_get(uint32_t address, uint32_t size)
+{
+    CHECK((address >= NRFX_HOST_NVM_BASE) &&
+          (address + size <= NRFX_HOST_NVM_BASE + NRFX_HOST_NVM_SIZE));
+    return &m_nvm.mem[(address - NRFX_HOST_NVM_BASE) % NRFX_HOST_NVM_SIZE];
+}
+
+void nrfx_host_nvm_reset(uint8_t fill)
+{
+    memset(&m_nvm, 0, sizeof(m_nvm));
+    memset(m_nvm.mem, fill, sizeof(m_nvm.mem));
+#if defined(NVMC_PRESENT)
+    nrfx_host_reg_reset(NRF_NVMC, sizeof(*NRF_NVMC));
+    NRFX_HOST_REG_SET(NRF_NVMC->READY, NVMC_READY_READY_Msk);
+#endif
+}
+
+uint8_t const * nrfx_host_nvm_content_get(uint32_t address)
+{
+    return nvm_get(address, 1);
+}
+
+uint64_t nrfx_host_nvm_busy_us_get(void)
+{
+    return m_nvm.busy_us;
+}
+
+void nrfx_host_nvm_erase_error_set(int error)
+{
+    m_nvm.erase_error = error;
+}
+
+uint32_t nrfx_host_nvm_uncommitted_get(void)
+{
+#if defined(RRAMC_PRESENT)
+    return m_nvm.uncommitted;
+#else
+    return 0;
+#endif
+}
+
+#if defined(NVMC_PRESENT)
+static void nvm_write(uint32_t address, void const * src, uint32_t num_bytes)
+{
+    uint8_t *       p_mem = nvm_get(address, num_bytes);
+    uint8_t const * p_src = (uint8_t const *)src;
+
+    for (uint32_t i = 0; i < num_bytes; i++)
+    {
+        /* Bits can only be cleared by a write. */
+        CHECK((p_mem[i] & p_src[i]) == p_src[i]);
+        p_mem[i] &= p_src[i];
+    }
+
+    m_nvm.busy_us += NRFX_CEIL_DIV(num_bytes, sizeof(uint32_t)) * NVM_WORD_WRITE_US;
+}
+
+uint32_t nrfx_nvmc_flash_page_size_get(void)
+{
+    return NVM_PAGE_SIZE;
+}
+
+int nrfx_nvmc_page_erase(uint32_t address)
+{
+    int err = m_nvm.erase_error;
+
+    m_nvm.erase_error = 0;
+    if (err < 0)
+    {
+        return err;
+    }
+
+    if (address % NVM_PAGE_SIZE)
+    {
+        return -EACCES;
+    }
+
+    memset(nvm_get(address, NVM_PAGE_SIZE), 0xFF, NVM_PAGE_SIZE);
+    m_nvm.busy_us += NVM_PAGE_ERASE_US;
+    return 0;
+}
+
+#if NRF_NVMC_HAS_PARTIAL_ERASE
+int nrfx_nvmc_page_partial_erase_init(uint32_t address, uint32_t duration_ms)
+{
+    int err = m_nvm.erase_error;
+
+    m_nvm.erase_error = 0;
+    if (err < 0)
+    {
+        return err;
+    }
+
+    if (address % NVM_PAGE_SIZE)
+    {
+        return -EACCES;
+    }
+
+    m_nvm.partial_address = address;
+    m_nvm.partial_us      = duration_ms * 1000UL;
+    m_nvm.partial_done_us = 0;
+    return 0;
+}
+
+bool nrfx_nvmc_page_partial_erase_continue(void)
+{
+    CHECK(m_nvm.partial_us);
+
+    m_nvm.busy_us         += m_nvm.partial_us;
+    m_nvm.partial_done_us += m_nvm.partial_us;
+    if (m_nvm.partial_done_us < NVM_PAGE_ERASE_US)
+    {
+        return false;
+    }
+
+    memset(nvm_get(m_nvm.partial_address, NVM_PAGE_SIZE), 0xFF, NVM_PAGE_SIZE);
+    m_nvm.partial_us = 0;
+    return true;
+}
+#endif // NRF_NVMC_HAS_PARTIAL_ERASE
+
+void nrfx_nvmc_bytes_write(uint32_t address, void const * src, uint32_t num_bytes)
+{
+    nvm_write(address, src, num_bytes);
+}
+
+void nrfx_nvmc_words_write(uint32_t address, void const * src, uint32_t num_words)
+{
+    CHECK(nrfx_is_word_aligned((void const *)address) && nrfx_is_word_aligned(src));
+    nvm_write(address, src, num_words * sizeof(uint32_t));
+}
+#elif defined(RRAMC_PRESENT)
+static void nvm_write(uint32_t address, void const * src, uint32_t num_bytes)
+{
+    memcpy(nvm_get(address, num_bytes), src, num_bytes);
+    m_nvm.uncommitted += num_bytes;
+}
+
+void nrfx_rramc_word_write(uint32_t address, uint32_t value)
+{
+    CHECK(nrfx_is_word_aligned((void const *)address));
+    nvm_write(address, &value, sizeof(value));
+}
+
+void nrfx_rramc_bytes_write(uint32_t address, void const * src, uint32_t num_bytes)
+{
+    nvm_write(address, src, num_bytes);
+}
+
+void nrfx_rramc_words_write(uint32_t address, void const * src, uint32_t num_words)
+{
+    CHECK(nrfx_is_word_aligned((void const *)address) && nrfx_is_word_aligned(src));
+    nvm_write(address, src, num_words * sizeof(uint32_t));
+}
+
+void nrfx_rramc_write_buffer_commit(void)
+{
+    m_nvm.busy_us    += NRFX_CEIL_DIV(m_nvm.uncommitted, NVM_LINE_SIZE) * NVM_LINE_WRITE_US;
+    m_nvm.uncommitted = 0;
+}
+#endif
+
+#endif // defined(NVM_PAGE_SIZE) || defined(NVM_LINE_SIZE)
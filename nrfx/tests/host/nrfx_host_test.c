@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Host test of nrfx drivers and helpers.
+ *
+ * The drivers are built for a device and run against a model of its registers. The Data RAM
+ * and peripheral address ranges of the device are mapped as plain memory at their real
+ * addresses, so the register accesses of the drivers and the HAL are not changed. The test
+ * takes the role of the hardware: it reads the tasks and the configuration written by
+ * the driver, writes the results and the events, and calls the interrupt handler.
+ *
+ * The drivers write addresses of their buffers to 32-bit registers, so the test must be
+ * linked as a position-dependent executable, which places its data in the low 4 GB.
+ * For the same reason, the casts between pointers and 32-bit integers in nrfx are expected
+ * and their warnings are disabled. Build and run from the nrfx directory, for each
+ * supported device:
+ *
+ *   cc -O2 -no-pie -Wno-pointer-to-int-cast -Wno-int-to-pointer-cast \
+ *      -DNRF54LC10A_XXAA -DNRF_APPLICATION \
+ *      -Itests/host -I. -Idrivers -Idrivers/include -Ihal -Ihaly -Ihelpers -Itemplates \
+ *      -Ibsp/stable -Ibsp/stable/templates -Ibsp/stable/mdk -Ibsp/stable/soc \
+ *      tests/host/nrfx_*.c drivers/src/nrfx_aar.c drivers/src/nrfx_ecb.c \
+ *      helpers/nrfx_trace.c helpers/nrfx_trace_decode.c helpers/nrfx_flag32_allocator.c \
+ *      helpers/nrfx_gppi_dppi.c helpers/nrfx_gppi_fanout.c \
+ *      bsp/stable/soc/interconnect/nrfx_gppi_d2ppi.c helpers/nrfx_grtc_timer.c \
+ *      helpers/nrfx_evt_capture.c helpers/nrfx_nvm_writer.c -lm -o nrfx_host_test && \
+ *      ./nrfx_host_test
+ *
+ * The same for nRF54LC10A with -DNRFX_GPPI_FIXED_CONNECTIONS=1 added, which tests the GPPI
+ * allocator for fixed connections between DPPI and PPIB on synthetic route graphs.
+ *
+ *   cc -O2 -no-pie -Wno-pointer-to-int-cast -Wno-int-to-pointer-cast \
+ *      -DNRF52840_XXAA \
+ *      -Itests/host -I. -Idrivers -Idrivers/include -Ihal -Ihaly -Ihelpers -Itemplates \
+ *      -Ibsp/stable -Ibsp/stable/templates -Ibsp/stable/mdk -Ibsp/stable/soc \
+ *      tests/host/nrfx_*.c drivers/src/nrfx_aar.c drivers/src/nrfx_ecb.c \
+ *      helpers/nrfx_trace.c helpers/nrfx_trace_decode.c \
+ *      helpers/nrfx_pdm_stream.c helpers/nrfx_flag32_allocator.c \
+ *      helpers/nrfx_gppi_ppi.c helpers/nrfx_gppi_fanout.c helpers/nrfx_evt_capture.c \
+ *      helpers/nrfx_nvm_writer.c drivers/src/nrfx_qspi.c -lm -o nrfx_host_test && \
+ *      ./nrfx_host_test
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/mman.h>
+#include "nrfx_host_test.h"
+
+/* Address ranges of the device mapped by the test. */
+#define RAM_BASE        0x20000000UL
+#define RAM_SIZE        0x00100000UL
+#define PERIPH_BASE     0x40000000UL
+#define PERIPH_SIZE     0x20000000UL
+#if defined(NRF52_SERIES)
+/* FICR is read by the dynamic errata checks. Zeroed FICR matches no errata. */
+#define FICR_BASE       0x10000000UL
+#define FICR_SIZE       0x00001000UL
+#endif
+
+#define IRQ_COUNT       512
+
+uint32_t nrfx_host_test_failures;
+
+static DWT_Type       m_dwt;
+static CoreDebug_Type m_core_debug;
+static SCB_Type       m_scb;
+static SysTick_Type   m_systick;
+
+DWT_Type *       DWT       = &m_dwt;
+CoreDebug_Type * CoreDebug = &m_core_debug;
+SCB_Type *       SCB       = &m_scb;
+SysTick_Type *   SysTick   = &m_systick;
+
+static size_t m_ram_used;
+
+static struct
+{
+    bool    enabled[IRQ_COUNT];
+    bool    pending[IRQ_COUNT];
+    uint8_t priority[IRQ_COUNT];
+} m_irq;
+
+static void region_map(uintptr_t base, size_t size)
+{
+    void * p_region = mmap((void *)base, size, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+    if (p_region != (void *)base)
+    {
+        printf("Cannot map the device memory at 0x%08lx.\n", (unsigned long)base);
+        exit(2);
+    }
+}
+
+void * nrfx_host_ram_alloc(size_t size)
+{
+    size_t offset = NRFX_CEIL_DIV(m_ram_used, 8) * 8;
+
+    if (offset + size > RAM_SIZE)
+    {
+        printf("Data RAM model exhausted.\n");
+        exit(2);
+    }
+
+    m_ram_used = offset + size;
+    memset((void *)(RAM_BASE + offset), 0, size);
+    return (void *)(RAM_BASE + offset);
+}
+
+void nrfx_host_ram_free_all(void)
+{
+    m_ram_used = 0;
+}
+
+void nrfx_host_reg_reset(void * p_reg, size_t size)
+{
+    memset(p_reg, 0, size);
+}
+
+uint64_t nrfx_host_time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+void nrfx_host_irq_priority_set(int irq_number, uint8_t priority)
+{
+    m_irq.priority[irq_number] = priority;
+}
+
+void nrfx_host_irq_enable(int irq_number)
+{
+    m_irq.enabled[irq_number] = true;
+}
+
+bool nrfx_host_irq_enable_check(int irq_number)
+{
+    return m_irq.enabled[irq_number];
+}
+
+void nrfx_host_irq_disable(int irq_number)
+{
+    m_irq.enabled[irq_number] = false;
+}
+
+void nrfx_host_irq_pending_set(int irq_number)
+{
+    m_irq.pending[irq_number] = true;
+}
+
+void nrfx_host_irq_pending_clear(int irq_number)
+{
+    m_irq.pending[irq_number] = false;
+}
+
+bool nrfx_host_irq_pending_check(int irq_number)
+{
+    return m_irq.pending[irq_number];
+}
+
+int main(void)
+{
+    if ((uintptr_t)&nrfx_host_test_failures > UINT32_MAX)
+    {
+        printf("Data of the test is not in the low 4 GB, link with -no-pie.\n");
+        return 2;
+    }
+
+    region_map(RAM_BASE, RAM_SIZE);
+    region_map(PERIPH_BASE, PERIPH_SIZE);
+#if defined(FICR_BASE)
+    region_map(FICR_BASE, FICR_SIZE);
+#endif
+
+    nrfx_host_test_aar();
+    nrfx_host_test_ecb();
+    nrfx_host_test_gppi();
+    nrfx_host_test_grtc_timer();
+    nrfx_host_test_evt_capture();
+    nrfx_host_test_gpiote();
+    nrfx_host_test_nvm_writer();
+    nrfx_host_test_qspi();
+    nrfx_host_test_trace();
+    nrfx_host_test_pdm_stream();
+
+    printf("%s: %u failure(s)\n", nrfx_host_test_failures ? "FAILED" : "PASSED",
+           nrfx_host_test_failures);
+    return nrfx_host_test_failures ? 1 : 0;
+}
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_HOST_TEST_H__
+#define NRFX_HOST_TEST_H__
+
+#include <nrfx.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Number of failed checks. */
+extern uint32_t nrfx_host_test_failures;
+
+/** @brief Macro for checking a condition. Failure is reported and counted. */
+#define CHECK(cond)                                                                 \
+    do                                                                              \
+    {                                                                               \
+        if (!(cond))                                                                \
+        {                                                                           \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);        \
+            nrfx_host_test_failures++;                                              \
+        }                                                                           \
+    } while (0)
+
+/**
+ * @brief Macro for writing a register of the model, also the one that is read-only for the driver.
+ *
+ * @param[in] reg   Register.
+ * @param[in] value Value to be written.
+ */
+#define NRFX_HOST_REG_SET(reg, value) (*(volatile uint32_t *)(uintptr_t)&(reg) = (uint32_t)(value))
+
+/**
+ * @brief Function for allocating memory in the modeled Data RAM region.
+ *
+ * Buffers passed to EasyDMA must be allocated with this function, as the drivers
+ * check that they are placed in the Data RAM region. The memory is zeroed.
+ *
+ * @param[in] size Size of the memory, in bytes.
+ *
+ * @return Pointer to the memory, aligned to 8 bytes.
+ */
+void * nrfx_host_ram_alloc(size_t size);
+
+/** @brief Function for releasing all the memory allocated in the modeled Data RAM region. */
+void nrfx_host_ram_free_all(void);
+
+/**
+ * @brief Function for clearing the registers of a peripheral.
+ *
+ * @param[in] p_reg Pointer to the structure of registers of the peripheral.
+ * @param[in] size  Size of the structure.
+ */
+void nrfx_host_reg_reset(void * p_reg, size_t size);
+
+/** @brief Function for getting the time of the host, in nanoseconds. */
+uint64_t nrfx_host_time_ns(void);
+
+/**
+ * @brief Function for resetting the GRTC model, on devices with GRTC.
+ *
+ * All channels are freed and disarmed.
+ *
+ * @param[in] now Initial SYSCOUNTER value.
+ */
+void nrfx_host_grtc_reset(uint64_t now);
+
+/**
+ * @brief Function for advancing the simulated SYSCOUNTER.
+ *
+ * Armed compare channels are expired in the order of their values, each with a call of its
+ * callback at the SYSCOUNTER value equal to the compare value, or later if the compare value
+ * was set in the past.
+ *
+ * @param[in] until SYSCOUNTER value at which the simulation stops.
+ *
+ * @return Number of compare callbacks, that is of wakeups.
+ */
+uint32_t nrfx_host_grtc_run(uint64_t until);
+
+/**
+ * @brief Function for getting the earliest compare value of the armed channels.
+ *
+ * @param[out] p_time Earliest compare value.
+ *
+ * @retval true  A channel is armed.
+ * @retval false No channel is armed.
+ */
+bool nrfx_host_grtc_next_get(uint64_t * p_time);
+
+/** @brief Function for getting the mask of allocated GRTC channels. */
+uint32_t nrfx_host_grtc_alloc_mask_get(void);
+
+/** @brief Start address of the memory simulated by the NVM controller model. */
+#define NRFX_HOST_NVM_BASE 0x00010000UL
+
+/** @brief Size of the memory simulated by the NVM controller model. */
+#define NRFX_HOST_NVM_SIZE 0x00010000UL
+
+/**
+ * @brief Function for resetting the model of the NVMC or RRAMC driver.
+ *
+ * @param[in] fill Value of every byte of the simulated memory.
+ */
+void nrfx_host_nvm_reset(uint8_t fill);
+
+/**
+ * @brief Function for getting the content of the simulated memory.
+ *
+ * @param[in] address Address in the simulated memory.
+ *
+ * @return Pointer to the content at @p address.
+ */
+uint8_t const * nrfx_host_nvm_content_get(uint32_t address);
+
+/** @brief Function for getting the time of the CPU blocked by the NVM operations, in microseconds. */
+uint64_t nrfx_host_nvm_busy_us_get(void);
+
+/**
+ * @brief Function for making the next start of a page erase fail, on NVMC.
+ *
+ * @param[in] error Negative error code returned by the next start of a page erase.
+ */
+void nrfx_host_nvm_erase_error_set(int error);
+
+/** @brief Function for getting the number of bytes in the RRAMC write buffer not committed yet. */
+uint32_t nrfx_host_nvm_uncommitted_get(void);
+
+/** @brief Function for running the AAR test and the software resolution benchmark. */
+void nrfx_host_test_aar(void);
+
+/** @brief Function for running the ECB driver test and the throughput benchmark. */
+void nrfx_host_test_ecb(void);
+
+/** @brief Function for running the test of the NVM writer layer and the step duration benchmark. */
+void nrfx_host_test_nvm_writer(void);
+
+/** @brief Function for running the test of the QSPI request queue, on nRF52840. */
+void nrfx_host_test_qspi(void);
+
+/** @brief Function for running the test of the GPIOTE PORT event, on nRF52840 without LATCH. */
+void nrfx_host_test_gpiote(void);
+
+/** @brief Function for running the test of the event capture layer. */
+void nrfx_host_test_evt_capture(void);
+
+/** @brief Function for running the test of the GRTC timer layer, on devices with GRTC. */
+void nrfx_host_test_grtc_timer(void);
+
+/** @brief Function for running the test of the GPPI fan-out allocation. */
+void nrfx_host_test_gppi(void);
+
+/** @brief Function for running the test of the trace RAM backend and decoder. */
+void nrfx_host_test_trace(void);
+
+/** @brief Function for running the test of the PDM stream helper, on devices with PDM. */
+void nrfx_host_test_pdm_stream(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_HOST_TEST_H__
@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Test of the AAR driver and benchmark of the software address resolution.
+ *
+ * The hardware model resolves the address found through the registers and the job lists
+ * written by the driver, using the software resolution of the driver as the reference.
+ * The benchmark sweeps the size of the IRK list, with the matching IRK at its end as the
+ * worst case of a resolvable address, and with an address that is not resolved.
+ */
+
+#include <nrfx_aar.h>
+#include "nrfx_host_test.h"
+
+#if defined(NRF_AAR00)
+#define AAR_REG NRF_AAR00
+#else
+#define AAR_REG NRF_AAR
+#endif
+
+#define AAR_IRQN nrfx_get_irq_number(AAR_REG)
+
+#define IRK_COUNT_MAX   1024
+#define BENCH_NS_MIN    20000000ULL
+#define CACHE_SIZE      4
+
+/* Test vector of the random address hash function ah() from the Bluetooth Core
+ * Specification, Vol 3, Part H, D.7. IRK is in the byte order of the AES core. */
+static const uint8_t m_vector_irk[NRFX_AAR_IRK_SIZE] =
+{
+    0xec, 0x02, 0x34, 0xa3, 0x57, 0xc8, 0xad, 0x05,
+    0x34, 0x10, 0x10, 0xa6, 0x0a, 0x39, 0x7d, 0x9b,
+};
+
+/* Address with prand 0x708194 and hash 0x0dfbaa, in on-air byte order. */
+static const uint8_t m_vector_addr[NRFX_AAR_ADDR_SIZE] = { 0xaa, 0xfb, 0x0d, 0x94, 0x81, 0x70 };
+
+static uint32_t m_seed = 1;
+
+static struct
+{
+    uint32_t runs;
+    uint32_t completed;
+    int      result;
+} m_hw;
+
+static uint8_t rand_byte(void)
+{
+    m_seed = m_seed * 1103515245UL + 12345UL;
+    return (uint8_t)(m_seed >> 16);
+}
+
+/* Table of random IRKs with the test vector IRK at the given index. */
+static void irks_fill(uint8_t * p_irks, uint16_t count, uint16_t vector_idx)
+{
+    for (size_t i = 0; i < (size_t)count * NRFX_AAR_IRK_SIZE; i++)
+    {
+        p_irks[i] = rand_byte();
+    }
+    memcpy(&p_irks[vector_idx * NRFX_AAR_IRK_SIZE], m_vector_irk, NRFX_AAR_IRK_SIZE);
+}
+
+/* Hardware model of a single resolution run. */
+static void hw_resolve(void)
+{
+    nrfx_aar_irk_table_t table;
+    uint8_t              addr[NRFX_AAR_ADDR_SIZE];
+
+    CHECK(AAR_REG->ENABLE != 0);
+
+#if NRF_AAR_HAS_IN_PTR
+    nrf_vdma_job_t const * p_in  = (nrf_vdma_job_t const *)(uintptr_t)AAR_REG->IN.PTR;
+    nrf_vdma_job_t const * p_out = (nrf_vdma_job_t const *)(uintptr_t)AAR_REG->OUT.PTR;
+    uint16_t               count = 0;
+
+    /* Hash and prand are followed by the IRKs, placed back to back. */
+    CHECK((p_in[0].size == 3) && (p_in[1].size == 3));
+    memcpy(&addr[0], p_in[0].p_buffer, 3);
+    memcpy(&addr[3], p_in[1].p_buffer, 3);
+    while (p_in[2 + count].p_buffer)
+    {
+        CHECK(p_in[2 + count].p_buffer == p_in[2].p_buffer + count * NRFX_AAR_IRK_SIZE);
+        count++;
+    }
+    table.p_irks    = p_in[2].p_buffer;
+    table.irk_count = count;
+    table.p_jobs    = NULL;
+
+    int16_t idx = nrfx_aar_sw_resolve(&table, addr);
+
+    if (idx != NRFX_AAR_NOT_RESOLVED)
+    {
+        uint32_t out_idx = (uint32_t)idx;
+
+        memcpy(p_out[0].p_buffer, &out_idx, p_out[0].size);
+    }
+#else
+    uint8_t const * p_packet = (uint8_t const *)(uintptr_t)AAR_REG->ADDRPTR;
+
+    /* Address follows the S0, LENGTH and S1 fields of the radio packet. */
+    memcpy(addr, &p_packet[3], NRFX_AAR_ADDR_SIZE);
+    table.p_irks    = (uint8_t const *)(uintptr_t)AAR_REG->IRKPTR;
+    table.irk_count = (uint16_t)AAR_REG->NIRK;
+    CHECK((table.irk_count > 0) && (table.irk_count <= 16));
+
+    int16_t idx = nrfx_aar_sw_resolve(&table, addr);
+
+    NRFX_HOST_REG_SET(AAR_REG->STATUS, idx);
+#endif
+
+    if (idx != NRFX_AAR_NOT_RESOLVED)
+    {
+        AAR_REG->EVENTS_RESOLVED = 1;
+    }
+    else
+    {
+        AAR_REG->EVENTS_NOTRESOLVED = 1;
+    }
+    AAR_REG->EVENTS_END = 1;
+    m_hw.runs++;
+}
+
+/* Runs the hardware model and the interrupt handler until nothing is pending. */
+static void hw_process(void)
+{
+    for (;;)
+    {
+        if (AAR_REG->TASKS_START)
+        {
+            AAR_REG->TASKS_START = 0;
+            hw_resolve();
+            nrfx_aar_irq_handler();
+        }
+        else if (nrfx_host_irq_pending_check(AAR_IRQN))
+        {
+            nrfx_host_irq_pending_clear(AAR_IRQN);
+            nrfx_aar_irq_handler();
+        }
+        else
+        {
+            break;
+        }
+    }
+}
+
+static void batch_handler(nrfx_aar_batch_t * p_batch, int result, void * p_context)
+{
+    (void)p_batch;
+    (void)p_context;
+    m_hw.completed++;
+    m_hw.result = result;
+}
+
+/* Known answer of ah() through the software resolution. */
+static void test_sw_vector(void)
+{
+    nrfx_aar_irk_table_t table = { .p_irks = m_vector_irk, .irk_count = 1 };
+    uint8_t              addr[NRFX_AAR_ADDR_SIZE];
+
+    CHECK(nrfx_aar_sw_resolve(&table, m_vector_addr) == 0);
+
+    /* Any bit of the hash or of the prand breaks the match. */
+    for (size_t i = 0; i < NRFX_AAR_ADDR_SIZE * 8; i++)
+    {
+        memcpy(addr, m_vector_addr, sizeof(addr));
+        addr[i / 8] ^= (uint8_t)(1 << (i % 8));
+        CHECK(nrfx_aar_sw_resolve(&table, addr) == NRFX_AAR_NOT_RESOLVED);
+    }
+}
+
+/* Batch resolved by the driver matches the software resolution, also with the cache. */
+static void test_batch(void)
+{
+    const uint16_t           irk_count = 20;
+    nrfx_aar_config_t        config    = NRFX_AAR_DEFAULT_CONFIG;
+    nrfx_aar_cache_entry_t   cache[CACHE_SIZE];
+    nrfx_aar_irk_table_t     table;
+    nrfx_aar_batch_t         batch;
+    uint8_t *                p_irks    = nrfx_host_ram_alloc(irk_count * NRFX_AAR_IRK_SIZE);
+    uint8_t *                p_addrs   = nrfx_host_ram_alloc(3 * NRFX_AAR_ADDR_SIZE);
+    int16_t                  results[3];
+
+    nrfx_host_reg_reset(AAR_REG, sizeof(*AAR_REG));
+    irks_fill(p_irks, irk_count, 18);
+
+    /* Resolvable address, an address that is not resolved and the first one again. */
+    memcpy(&p_addrs[0], m_vector_addr, NRFX_AAR_ADDR_SIZE);
+    memcpy(&p_addrs[NRFX_AAR_ADDR_SIZE], m_vector_addr, NRFX_AAR_ADDR_SIZE);
+    p_addrs[NRFX_AAR_ADDR_SIZE] ^= 1;
+    memcpy(&p_addrs[2 * NRFX_AAR_ADDR_SIZE], m_vector_addr, NRFX_AAR_ADDR_SIZE);
+
+    table.p_irks    = p_irks;
+    table.irk_count = irk_count;
+#if NRF_AAR_HAS_IN_PTR
+    table.p_jobs    = nrfx_host_ram_alloc(NRFX_AAR_JOB_LIST_SIZE(irk_count) *
+                                          sizeof(nrf_vdma_job_t));
+#endif
+
+    batch.p_addrs   = p_addrs;
+    batch.count     = 3;
+    batch.p_results = results;
+
+    for (size_t use_cache = 0; use_cache < 2; use_cache++)
+    {
+        config.p_cache    = use_cache ? cache : NULL;
+        config.cache_size = use_cache ? CACHE_SIZE : 0;
+        memset(&m_hw, 0, sizeof(m_hw));
+        memset(results, 0, sizeof(results));
+
+        CHECK(nrfx_aar_init(&config) == 0);
+        CHECK(nrfx_aar_irk_table_set(&table) == 0);
+        CHECK(nrfx_aar_batch_resolve(&batch, batch_handler, NULL) == 0);
+        CHECK(nrfx_aar_batch_resolve(&batch, batch_handler, NULL) == -EBUSY);
+        hw_process();
+
+        CHECK((m_hw.completed == 1) && (m_hw.result == 0));
+        CHECK((results[0] == 18) && (results[1] == NRFX_AAR_NOT_RESOLVED) && (results[2] == 18));
+#if NRF_AAR_HAS_IN_PTR
+        CHECK(m_hw.runs == (use_cache ? 2 : 3));
+#else
+        /* Runs are split into windows of 16 IRKs. The cached address is not resolved again. */
+        CHECK(m_hw.runs == (use_cache ? 4 : 6));
+#endif
+        CHECK(AAR_REG->ENABLE == 0);
+
+        /* Batch found completely in the cache is completed from the interrupt. */
+        if (use_cache)
+        {
+            batch.count = 1;
+            m_hw.runs   = 0;
+            CHECK(nrfx_aar_batch_resolve(&batch, batch_handler, NULL) == 0);
+            CHECK(nrfx_host_irq_pending_check(AAR_IRQN));
+            hw_process();
+            CHECK((m_hw.completed == 2) && (m_hw.runs == 0) && (results[0] == 18));
+            batch.count = 3;
+        }
+
+        nrfx_aar_uninit();
+    }
+
+    nrfx_host_ram_free_all();
+}
+
+static double bench_resolve(nrfx_aar_irk_table_t const * p_table,
+                            uint8_t const *              p_addr,
+                            int16_t                      expected)
+{
+    uint64_t start = nrfx_host_time_ns();
+    uint64_t elapsed;
+    uint32_t runs  = 0;
+
+    do
+    {
+        for (uint32_t i = 0; i < 16; i++)
+        {
+            CHECK(nrfx_aar_sw_resolve(p_table, p_addr) == expected);
+        }
+        runs += 16;
+        elapsed = nrfx_host_time_ns() - start;
+    } while (elapsed < BENCH_NS_MIN);
+
+    return (double)elapsed / runs;
+}
+
+/* Software resolution time for a growing IRK list. */
+static void bench_sw_resolve(void)
+{
+    static uint8_t irks[IRK_COUNT_MAX * NRFX_AAR_IRK_SIZE];
+    uint8_t        addr[NRFX_AAR_ADDR_SIZE];
+
+    memcpy(addr, m_vector_addr, sizeof(addr));
+    addr[0] ^= 1;
+
+    printf("Software address resolution:\n");
+    printf("  %6s %16s %16s %10s\n", "IRKs", "resolved [ns]", "unresolved [ns]", "ns/IRK");
+
+    for (uint16_t count = 1; count <= IRK_COUNT_MAX; count *= 4)
+    {
+        nrfx_aar_irk_table_t table = { .p_irks = irks, .irk_count = count };
+
+        irks_fill(irks, count, (uint16_t)(count - 1));
+
+        double hit  = bench_resolve(&table, m_vector_addr, (int16_t)(count - 1));
+        double miss = bench_resolve(&table, addr, NRFX_AAR_NOT_RESOLVED);
+
+        printf("  %6u %16.0f %16.0f %10.1f\n", count, hit, miss, miss / count);
+    }
+}
+
+void nrfx_host_test_aar(void)
+{
+    test_sw_vector();
+    test_batch();
+    bench_sw_resolve();
+}
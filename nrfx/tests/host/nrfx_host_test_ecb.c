@@ -0,0 +1,372 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Test of the ECB driver queue and benchmark of its throughput.
+ *
+ * The hardware model reads the key and the cleartext through the registers and the job
+ * lists written by the driver, and writes a stand-in transform of the block instead of
+ * the AES encryption, which is enough to check that each block reaches the right buffer
+ * with the right key. Aborted encryptions are injected with the ERROR event.
+ * The benchmark measures the time spent by the driver and the model per block, which is
+ * the overhead that adds to the encryption time of the peripheral.
+ */
+
+#include <nrfx_ecb.h>
+#include "nrfx_host_test.h"
+
+#if defined(NRF_ECB00)
+#define ECB_REG NRF_ECB00
+#else
+#define ECB_REG NRF_ECB
+#endif
+
+#if NRF_ECB_HAS_TASK_STARTECB
+#define ECB_TASKS_START  TASKS_STARTECB
+#define ECB_EVENTS_END   EVENTS_ENDECB
+#define ECB_EVENTS_ERROR EVENTS_ERRORECB
+#else
+#define ECB_TASKS_START  TASKS_START
+#define ECB_EVENTS_END   EVENTS_END
+#define ECB_EVENTS_ERROR EVENTS_ERROR
+#endif
+
+#define JOB_COUNT       4
+#define BLOCK_COUNT_MAX 16
+#define BENCH_NS_MIN    20000000ULL
+
+static struct
+{
+    uint32_t starts;
+    uint32_t errors;    /* Number of ERROR events to be generated before the next END. */
+    uint32_t completed;
+    uint32_t resubmits; /* Number of jobs to be resubmitted by the benchmark handler. */
+    int      results[JOB_COUNT];
+    size_t   order[JOB_COUNT];
+} m_hw;
+
+static void transform(uint8_t const * p_key, uint8_t const * p_in, uint8_t * p_out)
+{
+    for (size_t i = 0; i < NRFX_ECB_BLOCK_SIZE; i++)
+    {
+        p_out[i] = (uint8_t)((p_in[i] ^ p_key[i]) + i);
+    }
+}
+
+/* Hardware model of a single block encryption. */
+static void hw_encrypt(void)
+{
+    m_hw.starts++;
+
+    if (m_hw.errors)
+    {
+        m_hw.errors--;
+        ECB_REG->ECB_EVENTS_ERROR = 1;
+        return;
+    }
+
+#if NRF_ECB_HAS_IN_PTR
+    nrf_vdma_job_t const * p_in  = (nrf_vdma_job_t const *)(uintptr_t)ECB_REG->IN.PTR;
+    nrf_vdma_job_t const * p_out = (nrf_vdma_job_t const *)(uintptr_t)ECB_REG->OUT.PTR;
+    uint8_t                key[NRFX_ECB_BLOCK_SIZE];
+
+    CHECK((p_in[0].size == NRFX_ECB_BLOCK_SIZE) && (p_in[1].p_buffer == NULL));
+    CHECK((p_out[0].size == NRFX_ECB_BLOCK_SIZE) && (p_out[1].p_buffer == NULL));
+    memcpy(key, (void const *)(uintptr_t)ECB_REG->KEY.VALUE, sizeof(key));
+    transform(key, p_in[0].p_buffer, p_out[0].p_buffer);
+#else
+    uint8_t * p_data = (uint8_t *)(uintptr_t)ECB_REG->ECBDATAPTR;
+
+    /* Key, cleartext and ciphertext are placed back to back. */
+    transform(&p_data[0], &p_data[NRFX_ECB_BLOCK_SIZE], &p_data[2 * NRFX_ECB_BLOCK_SIZE]);
+#endif
+
+    ECB_REG->ECB_EVENTS_END = 1;
+}
+
+/* Runs the hardware model and the interrupt handler until the peripheral is idle. */
+static void hw_process(void)
+{
+    while (ECB_REG->ECB_TASKS_START)
+    {
+        ECB_REG->ECB_TASKS_START = 0;
+        hw_encrypt();
+        nrfx_ecb_irq_handler();
+    }
+}
+
+static void job_handler(nrfx_ecb_job_t * p_job, int result, void * p_context)
+{
+    (void)p_job;
+    size_t idx = (size_t)(uintptr_t)p_context;
+
+    m_hw.results[idx] = result;
+    m_hw.order[m_hw.completed++] = idx;
+}
+
+/* Jobs with blocks of different keys, the buffers allocated in the Data RAM. */
+static void jobs_prepare(nrfx_ecb_job_t *   p_jobs,
+                         nrfx_ecb_block_t * p_blocks,
+                         size_t             blocks_per_job)
+{
+    uint8_t * p_keys = nrfx_host_ram_alloc(2 * NRFX_ECB_BLOCK_SIZE);
+    uint8_t * p_data = nrfx_host_ram_alloc(JOB_COUNT * blocks_per_job *
+                                           2 * NRFX_ECB_BLOCK_SIZE);
+
+    for (size_t i = 0; i < 2 * NRFX_ECB_BLOCK_SIZE; i++)
+    {
+        p_keys[i] = (uint8_t)(0x11 * i);
+    }
+
+    for (size_t i = 0; i < JOB_COUNT * blocks_per_job; i++)
+    {
+        uint8_t * p_cleartext = &p_data[2 * i * NRFX_ECB_BLOCK_SIZE];
+
+        for (size_t j = 0; j < NRFX_ECB_BLOCK_SIZE; j++)
+        {
+            p_cleartext[j] = (uint8_t)(i * 7 + j);
+        }
+
+        /* Key changes every third block. */
+        p_blocks[i].p_key        = &p_keys[((i / 3) % 2) * NRFX_ECB_BLOCK_SIZE];
+        p_blocks[i].p_cleartext  = p_cleartext;
+        p_blocks[i].p_ciphertext = p_cleartext + NRFX_ECB_BLOCK_SIZE;
+    }
+
+    for (size_t i = 0; i < JOB_COUNT; i++)
+    {
+        p_jobs[i].p_blocks = &p_blocks[i * blocks_per_job];
+        p_jobs[i].count    = blocks_per_job;
+    }
+}
+
+static bool block_check(nrfx_ecb_block_t const * p_block)
+{
+    uint8_t expected[NRFX_ECB_BLOCK_SIZE];
+
+    transform(p_block->p_key, p_block->p_cleartext, expected);
+    return (memcmp(expected, p_block->p_ciphertext, NRFX_ECB_BLOCK_SIZE) == 0);
+}
+
+/* Queued jobs are completed in order, each block encrypted with its own key. */
+static void test_queue(void)
+{
+    const size_t      blocks_per_job = 5;
+    nrfx_ecb_config_t config         = NRFX_ECB_DEFAULT_CONFIG;
+    nrfx_ecb_job_t    jobs[JOB_COUNT];
+    nrfx_ecb_block_t  blocks[JOB_COUNT * BLOCK_COUNT_MAX];
+
+    nrfx_host_reg_reset(ECB_REG, sizeof(*ECB_REG));
+    memset(&m_hw, 0, sizeof(m_hw));
+    jobs_prepare(jobs, blocks, blocks_per_job);
+
+    CHECK(nrfx_ecb_init(&config) == 0);
+    CHECK(nrfx_ecb_init(&config) == -EALREADY);
+
+    jobs[0].count = 0;
+    CHECK(nrfx_ecb_job_submit(&jobs[0], job_handler, NULL) == -EINVAL);
+    CHECK(!nrfx_ecb_busy_check());
+    jobs[0].count = blocks_per_job;
+
+    for (size_t i = 0; i < JOB_COUNT; i++)
+    {
+        CHECK(nrfx_ecb_job_submit(&jobs[i], job_handler, (void *)(uintptr_t)i) == 0);
+    }
+    CHECK(nrfx_ecb_busy_check());
+
+    /* Only the first job is started. */
+    CHECK(ECB_REG->ECB_TASKS_START == 1);
+    hw_process();
+
+    CHECK(m_hw.completed == JOB_COUNT);
+    CHECK(m_hw.starts == JOB_COUNT * blocks_per_job);
+    for (size_t i = 0; i < JOB_COUNT; i++)
+    {
+        CHECK((m_hw.order[i] == i) && (m_hw.results[i] == 0));
+    }
+    for (size_t i = 0; i < JOB_COUNT * blocks_per_job; i++)
+    {
+        CHECK(block_check(&blocks[i]));
+    }
+    CHECK(!nrfx_ecb_busy_check());
+
+    nrfx_ecb_uninit();
+    nrfx_host_ram_free_all();
+}
+
+/* Aborted block is restarted a limited number of times, then the job fails. */
+static void test_error_retry(void)
+{
+    nrfx_ecb_config_t config = NRFX_ECB_DEFAULT_CONFIG;
+    nrfx_ecb_job_t    jobs[JOB_COUNT];
+    nrfx_ecb_block_t  blocks[JOB_COUNT * 2];
+
+    nrfx_host_reg_reset(ECB_REG, sizeof(*ECB_REG));
+    memset(&m_hw, 0, sizeof(m_hw));
+    jobs_prepare(jobs, blocks, 2);
+    CHECK(nrfx_ecb_init(&config) == 0);
+
+    /* Last allowed restart still completes the job. */
+    m_hw.errors = NRFX_ECB_ERROR_RETRY_MAX - 1;
+    CHECK(nrfx_ecb_job_submit(&jobs[0], job_handler, (void *)0) == 0);
+    hw_process();
+    CHECK((m_hw.completed == 1) && (m_hw.results[0] == 0));
+    CHECK(m_hw.starts == NRFX_ECB_ERROR_RETRY_MAX - 1 + 2);
+    CHECK(block_check(&blocks[0]) && block_check(&blocks[1]));
+
+    /* Block that keeps failing completes its job with an error, the next job runs. */
+    m_hw.errors = NRFX_ECB_ERROR_RETRY_MAX;
+    m_hw.starts = 0;
+    CHECK(nrfx_ecb_job_submit(&jobs[1], job_handler, (void *)1) == 0);
+    CHECK(nrfx_ecb_job_submit(&jobs[2], job_handler, (void *)2) == 0);
+    hw_process();
+    CHECK((m_hw.completed == 3) && (m_hw.results[1] == -EIO) && (m_hw.results[2] == 0));
+    CHECK(m_hw.starts == NRFX_ECB_ERROR_RETRY_MAX + 2);
+    CHECK(block_check(&blocks[4]) && block_check(&blocks[5]));
+    CHECK(!nrfx_ecb_busy_check());
+
+    nrfx_ecb_uninit();
+    nrfx_host_ram_free_all();
+}
+
+/* Uninitialization completes the job in progress and the queued ones. */
+static void test_uninit_cancel(void)
+{
+    nrfx_ecb_config_t config = NRFX_ECB_DEFAULT_CONFIG;
+    nrfx_ecb_job_t    jobs[JOB_COUNT];
+    nrfx_ecb_block_t  blocks[JOB_COUNT];
+
+    nrfx_host_reg_reset(ECB_REG, sizeof(*ECB_REG));
+    memset(&m_hw, 0, sizeof(m_hw));
+    jobs_prepare(jobs, blocks, 1);
+    CHECK(nrfx_ecb_init(&config) == 0);
+
+    for (size_t i = 0; i < JOB_COUNT; i++)
+    {
+        CHECK(nrfx_ecb_job_submit(&jobs[i], job_handler, (void *)(uintptr_t)i) == 0);
+    }
+    ECB_REG->ECB_TASKS_START = 0;
+    nrfx_ecb_uninit();
+
+    CHECK(!nrfx_ecb_init_check());
+    CHECK(m_hw.completed == JOB_COUNT);
+    for (size_t i = 0; i < JOB_COUNT; i++)
+    {
+        CHECK((m_hw.order[i] == i) && (m_hw.results[i] == -ECANCELED));
+    }
+
+    /* Driver can be initialized again with an empty queue. */
+    CHECK(nrfx_ecb_init(&config) == 0);
+    CHECK(!nrfx_ecb_busy_check());
+    nrfx_ecb_uninit();
+    nrfx_host_ram_free_all();
+}
+
+static void bench_handler(nrfx_ecb_job_t * p_job, int result, void * p_context)
+{
+    (void)p_context;
+    CHECK(result == 0);
+    m_hw.completed++;
+
+    /* Resubmit at once, as a producer that keeps the queue non-empty would. */
+    if (m_hw.resubmits)
+    {
+        m_hw.resubmits--;
+        CHECK(nrfx_ecb_job_submit(p_job, bench_handler, NULL) == 0);
+    }
+}
+
+/* Time per block of the driver and the model for a job size and a key change period. */
+static double bench_run(size_t blocks_per_job, bool key_change)
+{
+    nrfx_ecb_config_t config = NRFX_ECB_DEFAULT_CONFIG;
+    nrfx_ecb_job_t    jobs[JOB_COUNT];
+    nrfx_ecb_block_t  blocks[JOB_COUNT * BLOCK_COUNT_MAX];
+    uint64_t          start;
+    uint64_t          elapsed;
+    uint64_t          block_count = 0;
+
+    nrfx_host_reg_reset(ECB_REG, sizeof(*ECB_REG));
+    memset(&m_hw, 0, sizeof(m_hw));
+    jobs_prepare(jobs, blocks, blocks_per_job);
+    if (!key_change)
+    {
+        for (size_t i = 0; i < JOB_COUNT * blocks_per_job; i++)
+        {
+            blocks[i].p_key = blocks[0].p_key;
+        }
+    }
+    CHECK(nrfx_ecb_init(&config) == 0);
+
+    start = nrfx_host_time_ns();
+    do
+    {
+        m_hw.completed = 0;
+        m_hw.resubmits = 4 * JOB_COUNT;
+        for (size_t i = 0; i < JOB_COUNT; i++)
+        {
+            CHECK(nrfx_ecb_job_submit(&jobs[i], bench_handler, NULL) == 0);
+        }
+        hw_process();
+        block_count += (uint64_t)m_hw.completed * blocks_per_job;
+        elapsed = nrfx_host_time_ns() - start;
+    } while (elapsed < BENCH_NS_MIN);
+
+    nrfx_ecb_uninit();
+    nrfx_host_ram_free_all();
+
+    return (double)elapsed / (double)block_count;
+}
+
+static void bench_throughput(void)
+{
+    printf("ECB driver throughput, without the encryption time:\n");
+    printf("  %6s %14s %16s %10s\n", "blocks", "same key [ns]", "key change [ns]",
+           "Mblocks/s");
+
+    for (size_t count = 1; count <= BLOCK_COUNT_MAX; count *= 4)
+    {
+        double same   = bench_run(count, false);
+        double change = bench_run(count, true);
+
+        printf("  %6u %14.1f %16.1f %10.2f\n", (unsigned)count, same, change, 1000.0 / same);
+    }
+}
+
+void nrfx_host_test_ecb(void)
+{
+    test_queue();
+    test_error_retry();
+    test_uninit_cancel();
+    bench_throughput();
+}
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Test of the event capture layer against the register model.
+ *
+ * The test takes the role of the time source: it writes the values latched by the capture
+ * tasks to the capture/compare registers of the TIMER, or advances the simulated SYSCOUNTER
+ * of the GRTC model, and checks the timestamps, the deltas and the channels and GPPI
+ * connections owned by the endpoints.
+ */
+
+#include <nrfx.h>
+#include "nrfx_host_test.h"
+
+#if (defined(PPI_PRESENT) || defined(DPPIC_PRESENT)) && \
+    !NRFX_CHECK(NRFX_GPPI_FIXED_CONNECTIONS)
+#include <helpers/nrfx_evt_capture.h>
+#include <hal/nrf_egu.h>
+#if defined(DPPIC_PRESENT)
+#include <interconnect/nrfx_gppi_d2ppi.h>
+#endif
+
+#define RING_SIZE 8
+
+#if defined(NRF_TIMER00)
+#define TIMER_REG      NRF_TIMER00
+#define TIMER_CC_COUNT NRF_TIMER_CC_CHANNEL_COUNT(00)
+#define EGU_REG        NRF_EGU00
+#else
+#define TIMER_REG      NRF_TIMER0
+#define TIMER_CC_COUNT NRF_TIMER_CC_CHANNEL_COUNT(0)
+#define EGU_REG        NRF_EGU0
+#endif
+
+static nrfx_gppi_t               m_gppi;
+static nrfx_evt_capture_sample_t m_ring[RING_SIZE];
+
+static void gppi_reset(uint32_t channels)
+{
+#if defined(DPPIC_PRESENT)
+    static NRF_DPPIC_Type * const dppics[] = { NRF_DPPIC00, NRF_DPPIC10, NRF_DPPIC20,
+                                               NRF_DPPIC30 };
+    static NRF_PPIB_Type * const  ppibs[]  = { NRF_PPIB00, NRF_PPIB01, NRF_PPIB10, NRF_PPIB11,
+                                               NRF_PPIB20, NRF_PPIB21, NRF_PPIB22, NRF_PPIB30 };
+
+    for (size_t i = 0; i < NRFX_ARRAY_SIZE(dppics); i++)
+    {
+        nrfx_host_reg_reset(dppics[i], sizeof(*dppics[i]));
+    }
+    for (size_t i = 0; i < NRFX_ARRAY_SIZE(ppibs); i++)
+    {
+        nrfx_host_reg_reset(ppibs[i], sizeof(*ppibs[i]));
+    }
+
+    m_gppi.routes    = nrfx_gppi_routes_get();
+    m_gppi.route_map = nrfx_gppi_route_map_get();
+    m_gppi.nodes     = nrfx_gppi_nodes_get();
+    nrfx_gppi_init(&m_gppi);
+    for (uint32_t i = 0; i < NRFX_GPPI_NODE_COUNT; i++)
+    {
+        nrfx_gppi_channel_init((nrfx_gppi_node_id_t)i, channels);
+    }
+#else
+    nrfx_host_reg_reset(NRF_PPI, sizeof(*NRF_PPI));
+    m_gppi.ch_mask    = channels;
+    m_gppi.group_mask = NRFX_BIT_MASK(4);
+    nrfx_gppi_init(&m_gppi);
+#endif
+}
+
+static uint32_t egu_eep(uint8_t idx)
+{
+    return nrf_egu_event_address_get(EGU_REG, nrf_egu_triggered_event_get(idx));
+}
+
+/* Hardware captures on a TIMER, intervals and the latency of a software endpoint. */
+static void test_timer(void)
+{
+    nrfx_timer_t              timer  = { .p_reg = TIMER_REG };
+    nrfx_evt_capture_config_t config = {
+        .source    = NRFX_EVT_CAPTURE_SOURCE_TIMER,
+        .p_timer   = &timer,
+        .cc_count  = TIMER_CC_COUNT,
+        .p_ring    = m_ring,
+        .ring_size = RING_SIZE,
+    };
+    nrfx_evt_capture_endpoint_config_t hw  = { .eep = egu_eep(0), .channel = 1, .ref = 0 };
+    nrfx_evt_capture_endpoint_config_t sw  = { .eep = 0, .channel = 2, .ref = 0 };
+    nrfx_evt_capture_endpoint_config_t bad = { .eep = 0, .channel = TIMER_CC_COUNT, .ref = 0 };
+    nrfx_evt_capture_t                 capture;
+    nrfx_evt_capture_sample_t          samples[RING_SIZE];
+    uint32_t                           tep;
+
+    gppi_reset(NRFX_BIT_MASK(8));
+    nrfx_host_reg_reset(TIMER_REG, sizeof(*TIMER_REG));
+    nrf_timer_bit_width_set(TIMER_REG, NRF_TIMER_BIT_WIDTH_32);
+    tep = nrf_timer_task_address_get(TIMER_REG, nrf_timer_capture_task_get(1));
+
+    config.cc_count = 0;
+    CHECK(nrfx_evt_capture_init(&capture, &config) == -EINVAL);
+    config.cc_count = TIMER_CC_COUNT;
+    CHECK(nrfx_evt_capture_init(&capture, &config) == 0);
+
+    /* Channel beyond the channels of the instance is rejected. */
+    CHECK(nrfx_evt_capture_endpoint_add(&capture, &bad) == -EINVAL);
+    CHECK(nrfx_evt_capture_endpoint_add(&capture, &hw) == 0);
+    CHECK(nrfx_evt_capture_endpoint_add(&capture, &sw) == 1);
+    CHECK(nrfx_gppi_ep_channel_get(tep) >= 0);
+    nrfx_evt_capture_enable(&capture);
+
+    /* Unchanged channel value is not a new capture. */
+    nrfx_evt_capture_process(&capture);
+    CHECK(nrfx_evt_capture_read(&capture, samples, RING_SIZE) == 0);
+
+    TIMER_REG->CC[1] = 1000;
+    nrfx_evt_capture_process(&capture);
+    nrfx_evt_capture_process(&capture);
+    TIMER_REG->CC[1] = 1300;
+    nrfx_evt_capture_process(&capture);
+
+    /* Software capture latches the channel with the capture task. */
+    TIMER_REG->CC[2] = 1325;
+    CHECK(nrfx_evt_capture_trigger(&capture, 1) == 1325);
+    CHECK(TIMER_REG->TASKS_CAPTURE[2] == 1);
+
+    CHECK(nrfx_evt_capture_read(&capture, samples, RING_SIZE) == 3);
+    CHECK((samples[0].timestamp == 1000) && (samples[0].endpoint == 0));
+    CHECK((samples[1].timestamp == 1300) && (samples[1].endpoint == 0));
+    CHECK((samples[2].timestamp == 1325) && (samples[2].endpoint == 1));
+
+    nrfx_evt_capture_stats_t const * p_stats = nrfx_evt_capture_stats_get(&capture, 0);
+
+    CHECK((p_stats->count == 1) && (p_stats->min == 300) && (p_stats->max == 300));
+    p_stats = nrfx_evt_capture_stats_get(&capture, 1);
+    CHECK((p_stats->count == 1) && (p_stats->sum == 25) && (p_stats->hist[5] == 1));
+
+    nrfx_evt_capture_uninit(&capture);
+    CHECK(nrfx_gppi_ep_channel_get(tep) < 0);
+}
+
+#if NRFX_CHECK(NRFX_GRTC_ENABLED)
+/* GRTC channels are allocated by the layer or taken from the user. */
+static void test_grtc(void)
+{
+    nrfx_evt_capture_config_t config = {
+        .source    = NRFX_EVT_CAPTURE_SOURCE_GRTC,
+        .p_ring    = m_ring,
+        .ring_size = RING_SIZE,
+    };
+    nrfx_evt_capture_endpoint_config_t ep = { .eep = egu_eep(0), .ref = 0 };
+    nrfx_evt_capture_t                 capture;
+    nrfx_evt_capture_sample_t          samples[RING_SIZE];
+    uint8_t                            user_channel;
+    uint8_t                            channel;
+    uint32_t                           user_mask;
+
+    gppi_reset(NRFX_BIT_MASK(8));
+    nrfx_host_grtc_reset(5000);
+    CHECK(nrfx_grtc_channel_alloc(&user_channel) == 0);
+    user_mask = nrfx_host_grtc_alloc_mask_get();
+    CHECK(nrfx_evt_capture_init(&capture, &config) == 0);
+
+    /* Channel which is not allocated is rejected. */
+    ep.channel = (uint8_t)(user_channel + 1);
+    CHECK(nrfx_evt_capture_endpoint_add(&capture, &ep) == -EINVAL);
+    CHECK(nrfx_host_grtc_alloc_mask_get() == user_mask);
+
+    /* Hardware endpoint on a channel allocated by the layer. */
+    ep.channel = NRFX_EVT_CAPTURE_CHANNEL_ALLOC;
+    CHECK(nrfx_evt_capture_endpoint_add(&capture, &ep) == 0);
+    channel = capture.ep[0].channel;
+    CHECK(nrfx_host_grtc_alloc_mask_get() == (user_mask | NRFX_BIT(channel)));
+    CHECK(nrfx_gppi_ep_channel_get(nrfx_grtc_capture_task_address_get(channel)) >= 0);
+
+    /* Software endpoint on the channel allocated by the user. */
+    ep.eep     = 0;
+    ep.channel = user_channel;
+    CHECK(nrfx_evt_capture_endpoint_add(&capture, &ep) == 1);
+    nrfx_evt_capture_enable(&capture);
+
+    nrf_grtc_sys_counter_cc_set(NRF_GRTC, channel, 6000);
+    nrfx_evt_capture_process(&capture);
+    (void)nrfx_host_grtc_run(6040);
+    CHECK(nrfx_evt_capture_trigger(&capture, 1) == 6040);
+
+    CHECK(nrfx_evt_capture_read(&capture, samples, RING_SIZE) == 2);
+    CHECK((samples[0].timestamp == 6000) && (samples[0].endpoint == 0));
+    CHECK((samples[1].timestamp == 6040) && (samples[1].endpoint == 1));
+    CHECK(nrfx_evt_capture_stats_get(&capture, 1)->sum == 40);
+
+    /* Only the channel allocated by the layer is freed. */
+    nrfx_evt_capture_uninit(&capture);
+    CHECK(nrfx_host_grtc_alloc_mask_get() == user_mask);
+
+    /* Channel allocated by the layer is freed when the GPPI connection fails. */
+    gppi_reset(0);
+    CHECK(nrfx_evt_capture_init(&capture, &config) == 0);
+    ep.eep     = egu_eep(0);
+    ep.channel = NRFX_EVT_CAPTURE_CHANNEL_ALLOC;
+    CHECK(nrfx_evt_capture_endpoint_add(&capture, &ep) == -ENOMEM);
+    CHECK(nrfx_host_grtc_alloc_mask_get() == user_mask);
+
+    /* No free GRTC channel. */
+    while (nrfx_grtc_channel_alloc(&channel) == 0)
+    {
+    }
+    ep.eep = 0;
+    CHECK(nrfx_evt_capture_endpoint_add(&capture, &ep) == -ENOMEM);
+    nrfx_evt_capture_uninit(&capture);
+}
+#endif
+
+void nrfx_host_test_evt_capture(void)
+{
+    test_timer();
+#if NRFX_CHECK(NRFX_GRTC_ENABLED)
+    test_grtc();
+#endif
+}
+
+#else
+
+void nrfx_host_test_evt_capture(void)
+{
+}
+
+#endif
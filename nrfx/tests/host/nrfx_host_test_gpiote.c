@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Test of the GPIOTE PORT event handling on devices without GPIO LATCH.
+ *
+ * The driver is built for nRF52840 with the LATCH functionality hidden from the HAL, so that
+ * the sense mirror and the word-parallel matching of the PORT event handler are used as on
+ * the nRF51 Series. The test sets the input levels in the IN registers of the GPIO model,
+ * generates the PORT event and checks the handler calls and the sense written to PIN_CNF.
+ */
+
+#include <nrfx.h>
+
+#if defined(NRF52840_XXAA)
+#undef GPIO_LATCH_PIN0_Msk
+#include "../../drivers/src/nrfx_gpiote.c"
+#include "nrfx_host_test.h"
+
+#if defined(NRF_GPIO_LATCH_PRESENT)
+#error "LATCH must not be present in the GPIOTE test."
+#endif
+
+#define PIN_RISE   NRF_GPIO_PIN_MAP(0, 3)
+#define PIN_FALL   NRF_GPIO_PIN_MAP(0, 17)
+#define PIN_TOGGLE NRF_GPIO_PIN_MAP(1, 5)
+#define PIN_LEVEL  NRF_GPIO_PIN_MAP(1, 14)
+
+static nrfx_gpiote_t m_gpiote = NRFX_GPIOTE_INSTANCE(NRF_GPIOTE);
+
+static struct
+{
+    uint32_t calls[2][32];
+    uint32_t count;
+} m_log;
+
+static NRF_GPIO_Type * port_reg(nrfx_gpiote_pin_t pin)
+{
+    return (pin >= 32) ? NRF_P1 : NRF_P0;
+}
+
+static void pin_level_set(nrfx_gpiote_pin_t pin, bool high)
+{
+    uint32_t in = port_reg(pin)->IN;
+
+    NRFX_HOST_REG_SET(port_reg(pin)->IN,
+                      high ? (in | NRFX_BIT(pin & 0x1F)) : (in & ~NRFX_BIT(pin & 0x1F)));
+}
+
+static nrf_gpio_pin_sense_t pin_sense_read(nrfx_gpiote_pin_t pin)
+{
+    return (nrf_gpio_pin_sense_t)((port_reg(pin)->PIN_CNF[pin & 0x1F] & GPIO_PIN_CNF_SENSE_Msk) >>
+                                  GPIO_PIN_CNF_SENSE_Pos);
+}
+
+/* Sense mirror used by the PORT event handler must match PIN_CNF. */
+static bool sense_mirror_check(nrfx_gpiote_pin_t pin)
+{
+    uint32_t             mask  = NRFX_BIT(pin & 0x1F);
+    uint32_t             port  = pin >> 5;
+    nrf_gpio_pin_sense_t sense = pin_sense_read(pin);
+
+    return (((m_gpiote.cb.sense_high[port] & mask) != 0) == (sense == NRF_GPIO_PIN_SENSE_HIGH)) &&
+           (((m_gpiote.cb.sense_low[port] & mask) != 0) == (sense == NRF_GPIO_PIN_SENSE_LOW));
+}
+
+static void port_event(void)
+{
+    NRF_GPIOTE->EVENTS_PORT = 1;
+    nrfx_gpiote_irq_handler(&m_gpiote);
+}
+
+static void pin_handler(nrfx_gpiote_pin_t pin, nrfx_gpiote_trigger_t trigger, void * p_context)
+{
+    (void)p_context;
+
+    m_log.calls[pin >> 5][pin & 0x1F]++;
+    m_log.count++;
+    if (trigger == NRFX_GPIOTE_TRIGGER_HIGH)
+    {
+        /* Source of the level interrupt is serviced by the handler. */
+        pin_level_set(pin, false);
+    }
+}
+
+static void input_configure(nrfx_gpiote_pin_t pin, nrfx_gpiote_trigger_t trigger)
+{
+    static const nrfx_gpiote_handler_config_t handler_config = { .handler = pin_handler };
+    static const nrf_gpio_pin_pull_t          pull           = NRF_GPIO_PIN_NOPULL;
+    nrfx_gpiote_trigger_config_t              trigger_config = { .trigger = trigger };
+    nrfx_gpiote_input_pin_config_t            input_config   = {
+        .p_pull_config    = &pull,
+        .p_trigger_config = &trigger_config,
+        .p_handler_config = &handler_config,
+    };
+
+    CHECK(nrfx_gpiote_input_configure(&m_gpiote, pin, &input_config) == 0);
+    nrfx_gpiote_trigger_enable(&m_gpiote, pin, true);
+    CHECK(sense_mirror_check(pin));
+}
+
+static uint32_t calls_get(nrfx_gpiote_pin_t pin)
+{
+    return m_log.calls[pin >> 5][pin & 0x1F];
+}
+
+static void test_port_event(void)
+{
+    nrfx_host_reg_reset(NRF_GPIOTE, sizeof(*NRF_GPIOTE));
+    nrfx_host_reg_reset(NRF_P0, sizeof(*NRF_P0));
+    nrfx_host_reg_reset(NRF_P1, sizeof(*NRF_P1));
+    memset(&m_log, 0, sizeof(m_log));
+    CHECK(nrfx_gpiote_init(&m_gpiote, 0) == 0);
+
+    pin_level_set(PIN_FALL, true);
+    input_configure(PIN_RISE, NRFX_GPIOTE_TRIGGER_LOTOHI);
+    input_configure(PIN_FALL, NRFX_GPIOTE_TRIGGER_HITOLO);
+    input_configure(PIN_TOGGLE, NRFX_GPIOTE_TRIGGER_TOGGLE);
+    input_configure(PIN_LEVEL, NRFX_GPIOTE_TRIGGER_HIGH);
+    CHECK(pin_sense_read(PIN_RISE) == NRF_GPIO_PIN_SENSE_HIGH);
+    CHECK(pin_sense_read(PIN_FALL) == NRF_GPIO_PIN_SENSE_LOW);
+    CHECK(pin_sense_read(PIN_LEVEL) == NRF_GPIO_PIN_SENSE_HIGH);
+
+    /* Rising edge is reported and the sense flips to catch the falling edge. */
+    pin_level_set(PIN_RISE, true);
+    port_event();
+    CHECK(calls_get(PIN_RISE) == 1);
+    CHECK(pin_sense_read(PIN_RISE) == NRF_GPIO_PIN_SENSE_LOW);
+    CHECK(sense_mirror_check(PIN_RISE));
+
+    /* Falling edge of the rising-edge pin only re-arms its sense. */
+    pin_level_set(PIN_RISE, false);
+    pin_level_set(PIN_FALL, false);
+    port_event();
+    CHECK(calls_get(PIN_RISE) == 1);
+    CHECK(calls_get(PIN_FALL) == 1);
+    CHECK(pin_sense_read(PIN_RISE) == NRF_GPIO_PIN_SENSE_HIGH);
+    CHECK(pin_sense_read(PIN_FALL) == NRF_GPIO_PIN_SENSE_HIGH);
+
+    /* Toggle pin on the second port reports both edges. */
+    pin_level_set(PIN_TOGGLE, !(pin_sense_read(PIN_TOGGLE) == NRF_GPIO_PIN_SENSE_LOW));
+    port_event();
+    pin_level_set(PIN_TOGGLE, !(pin_sense_read(PIN_TOGGLE) == NRF_GPIO_PIN_SENSE_LOW));
+    port_event();
+    CHECK(calls_get(PIN_TOGGLE) == 2);
+    CHECK(sense_mirror_check(PIN_TOGGLE));
+
+    /* Level pin keeps its sense and is reported again while the level is held. */
+    pin_level_set(PIN_LEVEL, true);
+    port_event();
+    CHECK(calls_get(PIN_LEVEL) == 1);
+    CHECK(pin_sense_read(PIN_LEVEL) == NRF_GPIO_PIN_SENSE_HIGH);
+
+    /* Event without a matching level calls no handler. */
+    port_event();
+    CHECK(m_log.count == 5);
+
+    /* Disabled trigger leaves no sense in PIN_CNF and in the mirror. */
+    nrfx_gpiote_trigger_disable(&m_gpiote, PIN_RISE);
+    CHECK(pin_sense_read(PIN_RISE) == NRF_GPIO_PIN_NOSENSE);
+    CHECK(sense_mirror_check(PIN_RISE));
+    pin_level_set(PIN_RISE, true);
+    port_event();
+    CHECK(calls_get(PIN_RISE) == 1);
+
+    nrfx_gpiote_uninit(&m_gpiote);
+    CHECK((m_gpiote.cb.sense_high[0] | m_gpiote.cb.sense_low[0] |
+           m_gpiote.cb.sense_high[1] | m_gpiote.cb.sense_low[1]) == 0);
+}
+
+void nrfx_host_test_gpiote(void)
+{
+    test_port_event();
+}
+
+#else
+
+#include "nrfx_host_test.h"
+
+void nrfx_host_test_gpiote(void)
+{
+}
+
+#endif
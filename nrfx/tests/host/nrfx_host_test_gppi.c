@@ -0,0 +1,602 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Test of the channel allocation of the GPPI fan-out.
+ *
+ * The allocator works on the route tables of the device and writes the publish and subscribe
+ * registers of the endpoints, the PPIB bridges and the (D)PPI channel configuration, which are
+ * read back through the register model. The test checks the number of channels taken from each
+ * node, that the event is published to a single channel in the producer domain, and that all
+ * resources are returned when the task endpoints are removed.
+ *
+ * With fixed connections between DPPI and PPIB, a connection needs the same channel in all
+ * nodes of its route. This is tested on synthetic route graphs, with the allocator built for
+ * nRF54LC10A with NRFX_GPPI_FIXED_CONNECTIONS set to 1: the connection planner is checked
+ * against an exhaustive search on random connection sets and channel masks.
+ */
+
+#include <helpers/nrfx_gppi.h>
+#include <hal/nrf_egu.h>
+#include <hal/nrf_timer.h>
+#include "nrfx_host_test.h"
+
+#if defined(DPPIC_PRESENT) && NRFX_CHECK(NRFX_GPPI_MULTI_DOMAIN) && defined(NRF_PPIB00)
+#include <interconnect/nrfx_gppi_d2ppi.h>
+
+static nrfx_gppi_t m_gppi;
+
+#if NRFX_CHECK(NRFX_GPPI_FIXED_CONNECTIONS)
+
+/* Synthetic system of fully connected domains. Each pair of domains is connected by its own
+ * PPIB node, so connections conflict only when they share a DPPI node. */
+#define SYN_DOMAINS    4
+#define SYN_PAIRS      (SYN_DOMAINS * (SYN_DOMAINS - 1) / 2)
+#define SYN_NODES      (SYN_DOMAINS + SYN_PAIRS)
+#define SYN_CHANNELS   4
+#define SYN_CONNS_MAX  6
+#define SYN_RUNS       2000
+
+static nrfx_atomic_t             m_syn_channels[SYN_NODES];
+static nrfx_gppi_node_t          m_syn_nodes[SYN_NODES];
+static nrfx_gppi_route_t         m_syn_routes[SYN_DOMAINS + SYN_PAIRS];
+static const nrfx_gppi_node_t *  m_syn_route_nodes[SYN_DOMAINS + SYN_PAIRS][3];
+static const nrfx_gppi_route_t * m_syn_map_rows[SYN_DOMAINS][SYN_DOMAINS];
+static const nrfx_gppi_route_t ** m_syn_map[SYN_DOMAINS];
+static uint32_t                  m_seed = 1;
+
+static uint32_t rand_get(void)
+{
+    m_seed = m_seed * 1103515245UL + 12345UL;
+    return m_seed >> 16;
+}
+
+static void syn_init(void)
+{
+    static NRF_DPPIC_Type * const dppics[SYN_DOMAINS] = { NRF_DPPIC00, NRF_DPPIC10, NRF_DPPIC20,
+                                                          NRF_DPPIC30 };
+    size_t route = SYN_DOMAINS;
+    size_t node  = SYN_DOMAINS;
+
+    for (size_t d = 0; d < SYN_DOMAINS; d++)
+    {
+        nrfx_host_reg_reset(dppics[d], sizeof(*dppics[d]));
+        m_syn_nodes[d].type                 = NRFX_GPPI_NODE_DPPI;
+        m_syn_nodes[d].domain_id            = (uint8_t)d;
+        m_syn_nodes[d].dppi.p_channels      = &m_syn_channels[d];
+        m_syn_nodes[d].dppi.p_reg           = dppics[d];
+        m_syn_route_nodes[d][0]             = &m_syn_nodes[d];
+        m_syn_routes[d].p_nodes             = m_syn_route_nodes[d];
+        m_syn_routes[d].len                 = 1;
+        m_syn_map_rows[d][0]                = &m_syn_routes[d];
+        m_syn_map[d]                        = m_syn_map_rows[d];
+    }
+
+    nrfx_host_reg_reset(NRF_PPIB00, sizeof(*NRF_PPIB00));
+    nrfx_host_reg_reset(NRF_PPIB10, sizeof(*NRF_PPIB10));
+    for (size_t a = 0; a < SYN_DOMAINS; a++)
+    {
+        for (size_t b = a + 1; b < SYN_DOMAINS; b++)
+        {
+            m_syn_nodes[node].type            = NRFX_GPPI_NODE_PPIB;
+            m_syn_nodes[node].domain_id       = (uint8_t)node;
+            m_syn_nodes[node].ppib.p_channels = &m_syn_channels[node];
+            m_syn_nodes[node].ppib.p_reg[0]   = NRF_PPIB00;
+            m_syn_nodes[node].ppib.p_reg[1]   = NRF_PPIB10;
+
+            m_syn_route_nodes[route][0] = &m_syn_nodes[a];
+            m_syn_route_nodes[route][1] = &m_syn_nodes[node];
+            m_syn_route_nodes[route][2] = &m_syn_nodes[b];
+            m_syn_routes[route].p_nodes = m_syn_route_nodes[route];
+            m_syn_routes[route].len     = 3;
+            m_syn_map_rows[a][b - a]    = &m_syn_routes[route];
+            route++;
+            node++;
+        }
+    }
+
+    m_gppi.routes    = m_syn_routes;
+    m_gppi.route_map = m_syn_map;
+    m_gppi.nodes     = m_syn_nodes;
+    nrfx_gppi_init(&m_gppi);
+}
+
+static void syn_route_nodes_get(nrfx_gppi_conn_plan_t const * p_conn,
+                                nrfx_atomic_t **              pp_masks,
+                                size_t *                      p_len)
+{
+    uint32_t a = NRFX_MIN(p_conn->producer, p_conn->consumer);
+    uint32_t b = NRFX_MAX(p_conn->producer, p_conn->consumer);
+    const nrfx_gppi_route_t * p_route = m_syn_map[a][b - a];
+
+    for (size_t i = 0; i < p_route->len; i++)
+    {
+        pp_masks[i] = p_route->p_nodes[i]->generic.p_channels;
+    }
+    *p_len = p_route->len;
+}
+
+/* Exhaustive search of a channel assignment, as the reference for the planner. */
+static bool syn_assignment_exists(nrfx_gppi_conn_plan_t const * p_conns, size_t count)
+{
+    uint32_t combos = 1;
+
+    for (size_t k = 0; k < count; k++)
+    {
+        combos *= SYN_CHANNELS;
+    }
+
+    for (uint32_t combo = 0; combo < combos; combo++)
+    {
+        uint32_t used[SYN_NODES] = { 0 };
+        uint32_t c               = combo;
+        bool     valid           = true;
+
+        for (size_t k = 0; (k < count) && valid; k++)
+        {
+            nrfx_atomic_t * masks[3];
+            size_t          len;
+            uint32_t        ch = c % SYN_CHANNELS;
+
+            c /= SYN_CHANNELS;
+            syn_route_nodes_get(&p_conns[k], masks, &len);
+            for (size_t i = 0; i < len; i++)
+            {
+                size_t node = (size_t)(masks[i] - m_syn_channels);
+
+                if (!(*masks[i] & NRFX_BIT(ch)) || (used[node] & NRFX_BIT(ch)))
+                {
+                    valid = false;
+                }
+                used[node] |= NRFX_BIT(ch);
+            }
+        }
+
+        if (valid)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* Greedy allocation wastes the only channel of the second connection, the planner does not. */
+static void test_plan_greedy_trap(void)
+{
+    nrfx_gppi_conn_plan_t conns[2] = {
+        { .producer = 0, .consumer = 1 },
+        { .producer = 0, .consumer = 2 },
+    };
+
+    syn_init();
+    for (size_t i = 0; i < SYN_NODES; i++)
+    {
+        m_syn_channels[i] = NRFX_BIT_MASK(SYN_CHANNELS);
+    }
+    m_syn_channels[0] = 0x3;
+    m_syn_channels[2] = 0x2;
+
+    CHECK(nrfx_gppi_conn_plan_apply(conns, 2) == 0);
+    CHECK(nrfx_gppi_domain_channel_get(conns[0].handle, 0) == 0);
+    CHECK(nrfx_gppi_domain_channel_get(conns[1].handle, 0) == 1);
+    CHECK(nrfx_gppi_domain_channel_get(conns[1].handle, 2) == 1);
+    CHECK(m_syn_channels[0] == 0);
+
+    nrfx_gppi_domain_conn_free(conns[0].handle);
+    nrfx_gppi_domain_conn_free(conns[1].handle);
+    CHECK((m_syn_channels[0] == 0x3) && (m_syn_channels[2] == 0x2));
+}
+
+/* Random connection sets and channel masks, checked against the exhaustive search. */
+static void test_plan_random(void)
+{
+    uint32_t solved = 0;
+    uint64_t start;
+    uint64_t elapsed;
+
+    syn_init();
+    start = nrfx_host_time_ns();
+
+    for (uint32_t run = 0; run < SYN_RUNS; run++)
+    {
+        nrfx_gppi_conn_plan_t conns[SYN_CONNS_MAX];
+        nrfx_atomic_t         initial[SYN_NODES];
+        size_t                count = 1 + rand_get() % SYN_CONNS_MAX;
+        bool                  expected;
+        int                   rv;
+
+        for (size_t i = 0; i < SYN_NODES; i++)
+        {
+            /* Each DPPI node misses about one channel, PPIB nodes rarely. */
+            uint32_t mask = NRFX_BIT_MASK(SYN_CHANNELS);
+
+            mask &= ~NRFX_BIT(rand_get() % (i < SYN_DOMAINS ? SYN_CHANNELS : 4 * SYN_CHANNELS));
+            m_syn_channels[i] = mask;
+            initial[i]        = mask;
+        }
+        for (size_t k = 0; k < count; k++)
+        {
+            conns[k].producer = rand_get() % SYN_DOMAINS;
+            do
+            {
+                conns[k].consumer = rand_get() % SYN_DOMAINS;
+            } while (conns[k].consumer == conns[k].producer);
+            conns[k].handle = 0;
+        }
+
+        expected = syn_assignment_exists(conns, count);
+        rv       = nrfx_gppi_conn_plan_apply(conns, count);
+        CHECK(rv == (expected ? 0 : -ENOMEM));
+
+        if (rv != 0)
+        {
+            CHECK(memcmp(initial, m_syn_channels, sizeof(initial)) == 0);
+            continue;
+        }
+        solved++;
+
+        /* Each connection takes its channel in all nodes of its route and nowhere else. */
+        for (size_t k = 0; k < count; k++)
+        {
+            nrfx_atomic_t * masks[3];
+            size_t          len;
+            int             ch = nrfx_gppi_domain_channel_get(conns[k].handle,
+                                                              conns[k].producer);
+
+            CHECK(ch == nrfx_gppi_domain_channel_get(conns[k].handle, conns[k].consumer));
+            syn_route_nodes_get(&conns[k], masks, &len);
+            for (size_t i = 0; i < len; i++)
+            {
+                size_t node = (size_t)(masks[i] - m_syn_channels);
+
+                CHECK(initial[node] & NRFX_BIT(ch));
+                CHECK(!(*masks[i] & NRFX_BIT(ch)));
+                initial[node] &= ~NRFX_BIT(ch);
+            }
+        }
+        CHECK(memcmp(initial, m_syn_channels, sizeof(initial)) == 0);
+
+        for (size_t k = 0; k < count; k++)
+        {
+            nrfx_gppi_domain_conn_free(conns[k].handle);
+        }
+    }
+
+    elapsed = nrfx_host_time_ns() - start;
+    printf("GPPI planner: %u random plans, %u solvable, %.1f us per plan with the reference\n",
+           SYN_RUNS, (unsigned)solved, (double)elapsed / 1000.0 / SYN_RUNS);
+}
+
+void nrfx_host_test_gppi(void)
+{
+    test_plan_greedy_trap();
+    test_plan_random();
+}
+
+#else
+
+#define NODE_CHANNELS 0xFFUL
+
+static uint32_t free_count(nrfx_gppi_node_id_t node_id)
+{
+    return (uint32_t)__builtin_popcount(*nrfx_gppi_nodes_get()[node_id].generic.p_channels);
+}
+
+static void gppi_reset(void)
+{
+    static NRF_DPPIC_Type * const dppics[] = { NRF_DPPIC00, NRF_DPPIC10, NRF_DPPIC20,
+                                               NRF_DPPIC30 };
+    static NRF_PPIB_Type * const  ppibs[]  = { NRF_PPIB00, NRF_PPIB01, NRF_PPIB10, NRF_PPIB11,
+                                               NRF_PPIB20, NRF_PPIB21, NRF_PPIB22, NRF_PPIB30 };
+
+    for (size_t i = 0; i < NRFX_ARRAY_SIZE(dppics); i++)
+    {
+        nrfx_host_reg_reset(dppics[i], sizeof(*dppics[i]));
+    }
+    for (size_t i = 0; i < NRFX_ARRAY_SIZE(ppibs); i++)
+    {
+        nrfx_host_reg_reset(ppibs[i], sizeof(*ppibs[i]));
+    }
+    nrfx_host_reg_reset(NRF_TIMER00, sizeof(*NRF_TIMER00));
+    nrfx_host_reg_reset(NRF_TIMER20, sizeof(*NRF_TIMER20));
+    nrfx_host_reg_reset(NRF_EGU00, sizeof(*NRF_EGU00));
+    nrfx_host_reg_reset(NRF_EGU10, sizeof(*NRF_EGU10));
+    nrfx_host_reg_reset(NRF_EGU20, sizeof(*NRF_EGU20));
+
+    m_gppi.routes    = nrfx_gppi_routes_get();
+    m_gppi.route_map = nrfx_gppi_route_map_get();
+    m_gppi.nodes     = nrfx_gppi_nodes_get();
+    nrfx_gppi_init(&m_gppi);
+
+    for (uint32_t i = 0; i < NRFX_GPPI_NODE_COUNT; i++)
+    {
+        nrfx_gppi_channel_init((nrfx_gppi_node_id_t)i, NODE_CHANNELS);
+    }
+}
+
+static bool all_channels_free(void)
+{
+    for (uint32_t i = 0; i < NRFX_GPPI_NODE_COUNT; i++)
+    {
+        if (free_count((nrfx_gppi_node_id_t)i) != 8)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static uint32_t egu_tep(NRF_EGU_Type * p_reg, uint8_t idx)
+{
+    return nrf_egu_task_address_get(p_reg, nrf_egu_trigger_task_get(idx));
+}
+
+/* Event fanned out to tasks in three domains. */
+static void test_fanout_domains(void)
+{
+    nrfx_gppi_fanout_t fanout;
+    uint32_t           eep       = nrf_timer_event_address_get(NRF_TIMER00,
+                                                               NRF_TIMER_EVENT_COMPARE0);
+    uint32_t           tep_mcu0  = egu_tep(NRF_EGU00, 0);
+    uint32_t           tep_mcu1  = egu_tep(NRF_EGU00, 1);
+    uint32_t           tep_rad   = egu_tep(NRF_EGU10, 0);
+    uint32_t           tep_peri0 = egu_tep(NRF_EGU20, 0);
+    uint32_t           tep_peri1 = nrf_timer_task_address_get(NRF_TIMER20, NRF_TIMER_TASK_START);
+    int                ch;
+
+    gppi_reset();
+    CHECK(nrfx_gppi_domain_id_get(eep) == NRFX_GPPI_DOMAIN_MCU);
+    CHECK(nrfx_gppi_domain_id_get(tep_rad) == NRFX_GPPI_DOMAIN_RAD);
+    CHECK(nrfx_gppi_domain_id_get(tep_peri1) == NRFX_GPPI_DOMAIN_PERI);
+
+    nrfx_gppi_fanout_init(&fanout, eep);
+    CHECK(nrfx_gppi_fanout_tep_add(&fanout, tep_peri0) == 0);
+    CHECK(nrfx_gppi_fanout_tep_add(&fanout, tep_mcu0) == 0);
+    CHECK(nrfx_gppi_fanout_tep_add(&fanout, tep_rad) == 0);
+    CHECK(nrfx_gppi_fanout_tep_add(&fanout, tep_peri1) == 0);
+    CHECK(nrfx_gppi_fanout_tep_add(&fanout, tep_mcu1) == 0);
+    CHECK(nrfx_gppi_fanout_tep_add(&fanout, tep_mcu1) == -EINVAL);
+
+    /* One connection per domain, the event published once in the producer domain. */
+    ch = nrfx_gppi_ep_channel_get(eep);
+    CHECK(ch >= 0);
+    CHECK(fanout.branch_cnt == 3);
+    CHECK((nrfx_gppi_ep_channel_get(tep_mcu0) == ch) && (nrfx_gppi_ep_channel_get(tep_mcu1) == ch));
+    CHECK(nrfx_gppi_ep_channel_get(tep_peri0) == nrfx_gppi_ep_channel_get(tep_peri1));
+    CHECK(nrfx_gppi_ep_channel_get(tep_rad) >= 0);
+    CHECK(free_count(NRFX_GPPI_NODE_DPPIC00) == 7);
+    CHECK(free_count(NRFX_GPPI_NODE_DPPIC10) == 7);
+    CHECK(free_count(NRFX_GPPI_NODE_DPPIC20) == 7);
+    CHECK(free_count(NRFX_GPPI_NODE_DPPIC30) == 8);
+    CHECK(free_count(NRFX_GPPI_NODE_PPIB00_10) == 7);
+    CHECK(free_count(NRFX_GPPI_NODE_PPIB01_20) == 7);
+
+    nrfx_gppi_fanout_enable(&fanout);
+    CHECK(NRF_DPPIC00->CHENSET == NRFX_BIT(ch));
+    nrfx_gppi_fanout_disable(&fanout);
+    CHECK(NRF_DPPIC00->CHENCLR == NRFX_BIT(ch));
+
+    /* Root connection stays while other domains use its channel. */
+    CHECK(nrfx_gppi_fanout_tep_remove(&fanout, tep_mcu0) == 0);
+    CHECK(nrfx_gppi_fanout_tep_remove(&fanout, tep_mcu1) == 0);
+    CHECK(nrfx_gppi_fanout_tep_remove(&fanout, tep_mcu1) == -EINVAL);
+    CHECK(nrfx_gppi_ep_channel_get(eep) == ch);
+    CHECK(free_count(NRFX_GPPI_NODE_DPPIC00) == 7);
+
+    CHECK(nrfx_gppi_fanout_tep_remove(&fanout, tep_peri0) == 0);
+    CHECK(free_count(NRFX_GPPI_NODE_DPPIC20) == 7);
+    CHECK(nrfx_gppi_fanout_tep_remove(&fanout, tep_peri1) == 0);
+    CHECK(free_count(NRFX_GPPI_NODE_DPPIC20) == 8);
+    CHECK(nrfx_gppi_fanout_tep_remove(&fanout, tep_rad) == 0);
+
+    CHECK(fanout.branch_cnt == 0);
+    CHECK(nrfx_gppi_ep_channel_get(eep) < 0);
+    CHECK(all_channels_free());
+}
+
+/* Event already published by another connection is shared with the fan-out. */
+static void test_fanout_shared_eep(void)
+{
+    nrfx_gppi_fanout_t fanout;
+    nrfx_gppi_handle_t handle;
+    uint32_t           eep      = nrf_timer_event_address_get(NRF_TIMER00,
+                                                              NRF_TIMER_EVENT_COMPARE0);
+    uint32_t           tep_own  = egu_tep(NRF_EGU00, 2);
+    uint32_t           tep_mcu  = egu_tep(NRF_EGU00, 0);
+    uint32_t           tep_peri = egu_tep(NRF_EGU20, 0);
+    int                ch;
+
+    gppi_reset();
+    CHECK(nrfx_gppi_conn_alloc(eep, tep_own, &handle) == 0);
+    ch = nrfx_gppi_ep_channel_get(eep);
+    CHECK(ch >= 0);
+
+    nrfx_gppi_fanout_init(&fanout, eep);
+    CHECK(nrfx_gppi_fanout_tep_add(&fanout, tep_mcu) == 0);
+    CHECK(nrfx_gppi_fanout_tep_add(&fanout, tep_peri) == 0);
+    CHECK(fanout.eep_shared && (fanout.eep_channel == ch));
+    CHECK(nrfx_gppi_ep_channel_get(tep_mcu) == ch);
+    CHECK(nrfx_gppi_ep_channel_get(tep_peri) >= 0);
+    CHECK(free_count(NRFX_GPPI_NODE_DPPIC00) == 7);
+    CHECK(free_count(NRFX_GPPI_NODE_PPIB01_20) == 7);
+    CHECK(free_count(NRFX_GPPI_NODE_DPPIC20) == 7);
+
+    /* Channel of the other connection is not switched by the fan-out. */
+    NRF_DPPIC00->CHENSET = 0;
+    NRF_DPPIC00->CHENCLR = 0;
+    nrfx_gppi_fanout_enable(&fanout);
+    nrfx_gppi_fanout_disable(&fanout);
+    CHECK((NRF_DPPIC00->CHENSET == 0) && (NRF_DPPIC00->CHENCLR == 0));
+    CHECK(NRF_DPPIC20->CHENCLR != 0);
+
+    CHECK(nrfx_gppi_fanout_tep_remove(&fanout, tep_mcu) == 0);
+    CHECK(nrfx_gppi_fanout_tep_remove(&fanout, tep_peri) == 0);
+    CHECK(fanout.branch_cnt == 0);
+    CHECK(nrfx_gppi_ep_channel_get(eep) == ch);
+    CHECK(nrfx_gppi_ep_channel_get(tep_own) == ch);
+    CHECK(free_count(NRFX_GPPI_NODE_DPPIC00) == 7);
+
+    nrfx_gppi_conn_free(eep, tep_own, handle);
+    CHECK(all_channels_free());
+}
+
+/* Failed allocation releases the root connection allocated for it. */
+static void test_fanout_no_resources(void)
+{
+    nrfx_gppi_fanout_t fanout;
+    uint32_t           eep = nrf_timer_event_address_get(NRF_TIMER00, NRF_TIMER_EVENT_COMPARE0);
+
+    gppi_reset();
+    nrfx_gppi_channel_init(NRFX_GPPI_NODE_DPPIC20, 0);
+
+    nrfx_gppi_fanout_init(&fanout, eep);
+    CHECK(nrfx_gppi_fanout_tep_add(&fanout, egu_tep(NRF_EGU20, 0)) == -ENOMEM);
+    CHECK(fanout.branch_cnt == 0);
+    CHECK(nrfx_gppi_ep_channel_get(eep) < 0);
+    CHECK(free_count(NRFX_GPPI_NODE_DPPIC00) == 8);
+    CHECK(free_count(NRFX_GPPI_NODE_PPIB01_20) == 8);
+}
+
+/* Plan is allocated completely or not at all. */
+static void test_plan_rollback(void)
+{
+    nrfx_gppi_conn_plan_t conns[3] = {
+        { .producer = NRFX_GPPI_DOMAIN_MCU, .consumer = NRFX_GPPI_DOMAIN_RAD },
+        { .producer = NRFX_GPPI_DOMAIN_MCU, .consumer = NRFX_GPPI_DOMAIN_PERI },
+        { .producer = NRFX_GPPI_DOMAIN_RAD, .consumer = NRFX_GPPI_DOMAIN_LP },
+    };
+
+    gppi_reset();
+    nrfx_gppi_channel_init(NRFX_GPPI_NODE_PPIB22_30, 0);
+    CHECK(nrfx_gppi_conn_plan_apply(conns, 3) == -ENOMEM);
+    nrfx_gppi_channel_init(NRFX_GPPI_NODE_PPIB22_30, NODE_CHANNELS);
+    CHECK(all_channels_free());
+
+    CHECK(nrfx_gppi_conn_plan_apply(conns, 3) == 0);
+    CHECK(free_count(NRFX_GPPI_NODE_DPPIC00) == 6);
+    CHECK(free_count(NRFX_GPPI_NODE_DPPIC10) == 6);
+    CHECK(free_count(NRFX_GPPI_NODE_DPPIC20) == 6);
+    CHECK(free_count(NRFX_GPPI_NODE_DPPIC30) == 7);
+    for (size_t k = 0; k < 3; k++)
+    {
+        CHECK(nrfx_gppi_domain_channel_get(conns[k].handle, conns[k].producer) >= 0);
+        CHECK(nrfx_gppi_domain_channel_get(conns[k].handle, conns[k].consumer) >= 0);
+        nrfx_gppi_domain_conn_free(conns[k].handle);
+    }
+    CHECK(all_channels_free());
+}
+
+void nrfx_host_test_gppi(void)
+{
+    test_fanout_domains();
+    test_fanout_shared_eep();
+    test_fanout_no_resources();
+    test_plan_rollback();
+}
+
+#endif // NRFX_CHECK(NRFX_GPPI_FIXED_CONNECTIONS)
+
+#elif defined(PPI_PRESENT)
+
+static nrfx_gppi_t m_gppi;
+
+static uint32_t egu_tep(NRF_EGU_Type * p_reg, uint8_t idx)
+{
+    return nrf_egu_task_address_get(p_reg, nrf_egu_trigger_task_get(idx));
+}
+
+static void gppi_reset(void)
+{
+    nrfx_host_reg_reset(NRF_PPI, sizeof(*NRF_PPI));
+    nrfx_host_reg_reset(NRF_EGU0, sizeof(*NRF_EGU0));
+    m_gppi.ch_mask    = NRFX_BIT_MASK(8);
+    m_gppi.group_mask = NRFX_BIT_MASK(4);
+    nrfx_gppi_init(&m_gppi);
+}
+
+/* On PPI, each channel of the fan-out carries the event and up to two tasks. */
+static void test_fanout_ppi(void)
+{
+    nrfx_gppi_fanout_t fanout;
+    nrfx_gppi_handle_t handle;
+    uint32_t           eep = nrf_timer_event_address_get(NRF_TIMER0, NRF_TIMER_EVENT_COMPARE0);
+    uint32_t           teps[3];
+
+    gppi_reset();
+    for (uint8_t i = 0; i < NRFX_ARRAY_SIZE(teps); i++)
+    {
+        teps[i] = egu_tep(NRF_EGU0, i);
+    }
+
+    /* Event used by another connection can be attached to the channels of the fan-out too. */
+    CHECK(nrfx_gppi_conn_alloc(eep, egu_tep(NRF_EGU0, 3), &handle) == 0);
+
+    nrfx_gppi_fanout_init(&fanout, eep);
+    for (size_t i = 0; i < NRFX_ARRAY_SIZE(teps); i++)
+    {
+        CHECK(nrfx_gppi_fanout_tep_add(&fanout, teps[i]) == 0);
+    }
+    CHECK(fanout.branch_cnt == 2);
+    CHECK(__builtin_popcount(m_gppi.ch_mask) == 8 - 3);
+    for (size_t i = 0; i < fanout.branch_cnt; i++)
+    {
+        CHECK(NRF_PPI->CH[fanout.branches[i].handle].EEP == eep);
+    }
+    CHECK(NRF_PPI->CH[handle].EEP == eep);
+
+    for (size_t i = 0; i < NRFX_ARRAY_SIZE(teps); i++)
+    {
+        CHECK(nrfx_gppi_fanout_tep_remove(&fanout, teps[i]) == 0);
+    }
+    CHECK(fanout.branch_cnt == 0);
+    CHECK(__builtin_popcount(m_gppi.ch_mask) == 8 - 1);
+    CHECK(NRF_PPI->CH[handle].EEP == eep);
+
+    nrfx_gppi_conn_free(eep, egu_tep(NRF_EGU0, 3), handle);
+    CHECK(m_gppi.ch_mask == NRFX_BIT_MASK(8));
+}
+
+void nrfx_host_test_gppi(void)
+{
+    test_fanout_ppi();
+}
+
+#else
+
+void nrfx_host_test_gppi(void)
+{
+}
+
+#endif
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Test of the GRTC timer layer on a simulated SYSCOUNTER.
+ *
+ * Random timers with deadlines up to 200 seconds are started, some of them stopped and some
+ * started again from their handlers. The SYSCOUNTER model expires the compare channel at
+ * the armed value, so the test checks the expiry time of each timer against the tolerance
+ * and counts the wakeups of the channel.
+ */
+
+#include <nrfx.h>
+#include "nrfx_host_test.h"
+
+#if NRFX_CHECK(NRFX_GRTC_ENABLED)
+#include <nrfx_grtc.h>
+#include <helpers/nrfx_grtc_timer.h>
+
+#define WHEEL_TIMERS 2000
+#define RESTARTS     2
+#define START_TIME   1000ULL
+#define DEADLINE_MAX (200ULL * 1000000ULL) /* 200 seconds of the 1 MHz SYSCOUNTER. */
+#define TOLERANCE    50
+
+typedef struct
+{
+    nrfx_grtc_timer_t timer;
+    uint64_t          expiry;
+    uint32_t          fired;
+    uint32_t          restarts;
+    bool              stopped;
+} test_timer_t;
+
+static test_timer_t m_timers[WHEEL_TIMERS];
+static uint32_t     m_tolerance;
+static uint32_t     m_early;
+static uint32_t     m_seed = 1;
+
+static uint32_t rand_get(void)
+{
+    m_seed = m_seed * 1103515245UL + 12345UL;
+    return m_seed >> 16;
+}
+
+static uint64_t deadline_get(void)
+{
+    return 1 + ((((uint64_t)rand_get() << 16) | rand_get()) % DEADLINE_MAX);
+}
+
+static void timer_handler(nrfx_grtc_timer_t * p_timer, void * p_context)
+{
+    test_timer_t * p_test = (test_timer_t *)p_context;
+    uint64_t       now    = nrfx_grtc_syscounter_get();
+
+    CHECK(p_timer == &p_test->timer);
+    CHECK(!p_test->stopped);
+    CHECK(!nrfx_grtc_timer_running_check(p_timer));
+    CHECK(now <= p_test->expiry);
+    CHECK(now + m_tolerance >= p_test->expiry);
+    if (now < p_test->expiry)
+    {
+        m_early++;
+    }
+    p_test->fired++;
+
+    if ((p_test->restarts < RESTARTS) && ((p_test - m_timers) % 7 == 0))
+    {
+        p_test->restarts++;
+        p_test->expiry = now + deadline_get();
+        nrfx_grtc_timer_start(p_timer, p_test->expiry);
+    }
+}
+
+static void timers_start(void)
+{
+    for (size_t i = 0; i < WHEEL_TIMERS; i++)
+    {
+        memset(&m_timers[i], 0, sizeof(m_timers[i]));
+        nrfx_grtc_timer_setup(&m_timers[i].timer, timer_handler, &m_timers[i]);
+        m_timers[i].expiry = START_TIME + deadline_get();
+        nrfx_grtc_timer_start(&m_timers[i].timer, m_timers[i].expiry);
+    }
+}
+
+static uint32_t wheel_run(uint32_t tolerance)
+{
+    nrfx_grtc_timer_config_t config = NRFX_GRTC_TIMER_DEFAULT_CONFIG;
+    uint32_t                 wakeups;
+
+    config.tolerance = tolerance;
+    m_tolerance      = tolerance;
+    m_early          = 0;
+    nrfx_host_grtc_reset(START_TIME);
+    CHECK(nrfx_grtc_timer_init(&config) == 0);
+    timers_start();
+
+    /* Stop every 5th timer which did not expire during the first 10 seconds. */
+    wakeups = nrfx_host_grtc_run(START_TIME + DEADLINE_MAX / 20);
+    for (size_t i = 0; i < WHEEL_TIMERS; i += 5)
+    {
+        if (nrfx_grtc_timer_running_check(&m_timers[i].timer))
+        {
+            nrfx_grtc_timer_stop(&m_timers[i].timer);
+            m_timers[i].stopped = true;
+        }
+    }
+    wakeups += nrfx_host_grtc_run(START_TIME + (RESTARTS + 1) * DEADLINE_MAX);
+
+    for (size_t i = 0; i < WHEEL_TIMERS; i++)
+    {
+        /* Handler checks that a stopped timer does not expire. */
+        CHECK(!nrfx_grtc_timer_running_check(&m_timers[i].timer));
+        if (!m_timers[i].stopped)
+        {
+            CHECK(m_timers[i].fired == m_timers[i].restarts + 1);
+            CHECK(m_timers[i].restarts == ((i % 7 == 0) ? RESTARTS : 0));
+        }
+    }
+
+    nrfx_grtc_timer_uninit();
+    CHECK(nrfx_host_grtc_alloc_mask_get() == 0);
+    return wakeups;
+}
+
+static void test_wheel(void)
+{
+    uint32_t wakeups = wheel_run(0);
+
+    CHECK(m_early == 0);
+    printf("GRTC timer: %u timers, tolerance 0: %u wakeups\n", WHEEL_TIMERS, wakeups);
+
+    wakeups = wheel_run(TOLERANCE);
+    CHECK(m_early > 0);
+    printf("GRTC timer: %u timers, tolerance %u: %u wakeups, %u early expiries\n",
+           WHEEL_TIMERS, TOLERANCE, wakeups, m_early);
+}
+
+/* Uninit stops the running timers, which can be started again after the next init. */
+static void test_uninit_running(void)
+{
+    nrfx_grtc_timer_config_t config = NRFX_GRTC_TIMER_DEFAULT_CONFIG;
+    uint64_t                 next;
+
+    m_tolerance = 0;
+    nrfx_host_grtc_reset(START_TIME);
+    CHECK(nrfx_grtc_timer_init(&config) == 0);
+    for (size_t i = 0; i < 3; i++)
+    {
+        memset(&m_timers[i], 0, sizeof(m_timers[i]));
+        nrfx_grtc_timer_setup(&m_timers[i].timer, timer_handler, &m_timers[i]);
+        m_timers[i].expiry = START_TIME + 100 * (i + 1);
+        nrfx_grtc_timer_start(&m_timers[i].timer, m_timers[i].expiry);
+    }
+
+    nrfx_grtc_timer_uninit();
+    CHECK(nrfx_host_grtc_alloc_mask_get() == 0);
+    CHECK(!nrfx_host_grtc_next_get(&next));
+    for (size_t i = 0; i < 3; i++)
+    {
+        CHECK(!nrfx_grtc_timer_running_check(&m_timers[i].timer));
+    }
+
+    /* Only the timer started after the next init expires. */
+    CHECK(nrfx_grtc_timer_init(&config) == 0);
+    m_timers[2].expiry = START_TIME + 1000;
+    nrfx_grtc_timer_start(&m_timers[2].timer, m_timers[2].expiry);
+    CHECK(nrfx_host_grtc_run(START_TIME + 10000) >= 1);
+    CHECK(m_timers[0].fired == 0);
+    CHECK(m_timers[1].fired == 0);
+    CHECK(m_timers[2].fired == 1);
+    nrfx_grtc_timer_uninit();
+}
+
+void nrfx_host_test_grtc_timer(void)
+{
+    test_wheel();
+    test_uninit_running();
+}
+
+#else
+
+void nrfx_host_test_grtc_timer(void)
+{
+}
+
+#endif // NRFX_CHECK(NRFX_GRTC_ENABLED)
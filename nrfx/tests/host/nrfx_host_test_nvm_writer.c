@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Test of the NVM writer layer on the model of the NVM controller driver.
+ *
+ * Erase and write jobs are processed step by step. The test checks the content of
+ * the simulated memory and the results and the order of the jobs, and measures the longest
+ * time for which a single step blocks the CPU, with and without the partial erase.
+ */
+
+#include <nrfx.h>
+#include "nrfx_host_test.h"
+
+#if defined(NVMC_PRESENT) || defined(RRAMC_PRESENT)
+#include <helpers/nrfx_nvm_writer.h>
+
+#define ERASE_SIZE     0x2000UL
+#define WRITE_SIZE     1000UL
+#define UNALIGNED_ADDR (NRFX_HOST_NVM_BASE + 0x1403UL)
+#define UNALIGNED_SIZE 13UL
+#define JOB_COUNT      3
+
+static struct
+{
+    nrfx_nvm_writer_job_t * p_done[JOB_COUNT + 1];
+    int                     results[JOB_COUNT + 1];
+    uint32_t                count;
+} m_log;
+
+static void job_handler(nrfx_nvm_writer_job_t * p_job, void * p_context)
+{
+    (void)p_context;
+
+    CHECK(m_log.count < NRFX_ARRAY_SIZE(m_log.p_done));
+    m_log.p_done[m_log.count]  = p_job;
+    m_log.results[m_log.count] = p_job->result;
+    m_log.count++;
+}
+
+/* Process all the jobs and return the longest step. */
+static uint32_t jobs_run(uint32_t * p_steps)
+{
+    uint32_t max_us = 0;
+    uint32_t steps  = 0;
+    bool     pending;
+
+    do
+    {
+        uint64_t start = nrfx_host_nvm_busy_us_get();
+
+        pending = nrfx_nvm_writer_process();
+        max_us  = NRFX_MAX(max_us, (uint32_t)(nrfx_host_nvm_busy_us_get() - start));
+        CHECK(nrfx_host_nvm_uncommitted_get() == 0);
+        steps++;
+    } while (pending && (steps < 10000));
+
+    CHECK(!nrfx_nvm_writer_pending_check());
+    *p_steps = steps;
+    return max_us;
+}
+
+/* Erase, aligned write and unaligned write of the memory which is not erased. */
+static uint32_t test_jobs(char const * p_name, bool page_erase)
+{
+    static uint32_t data[WRITE_SIZE / sizeof(uint32_t)];
+    static uint8_t  bytes[UNALIGNED_SIZE + 1];
+    nrfx_nvm_writer_config_t config = NRFX_NVM_WRITER_DEFAULT_CONFIG;
+    nrfx_nvm_writer_job_t    jobs[JOB_COUNT] = {
+        { .type = NRFX_NVM_WRITER_JOB_ERASE, .address = NRFX_HOST_NVM_BASE, .size = ERASE_SIZE },
+        { .type = NRFX_NVM_WRITER_JOB_WRITE, .address = NRFX_HOST_NVM_BASE, .p_data = data,
+          .size = WRITE_SIZE },
+        { .type = NRFX_NVM_WRITER_JOB_WRITE, .address = UNALIGNED_ADDR, .p_data = &bytes[1],
+          .size = UNALIGNED_SIZE },
+    };
+    uint32_t steps;
+    uint32_t max_us;
+
+    for (uint32_t i = 0; i < NRFX_ARRAY_SIZE(data); i++)
+    {
+        data[i] = 0x5A000000UL | i;
+    }
+    for (uint32_t i = 0; i < sizeof(bytes); i++)
+    {
+        bytes[i] = (uint8_t)(0xC0 + i);
+    }
+
+    memset(&m_log, 0, sizeof(m_log));
+    nrfx_host_nvm_reset(0x00);
+    if (page_erase)
+    {
+        config.erase_slice_ms = 0;
+    }
+    CHECK(nrfx_nvm_writer_init(&config, job_handler, NULL) == 0);
+
+    for (uint32_t i = 0; i < JOB_COUNT; i++)
+    {
+        CHECK(nrfx_nvm_writer_submit(&jobs[i]) == 0);
+    }
+    CHECK(nrfx_nvm_writer_uninit() == -EBUSY);
+
+    max_us = jobs_run(&steps);
+
+    CHECK(m_log.count == JOB_COUNT);
+    for (uint32_t i = 0; i < JOB_COUNT; i++)
+    {
+        CHECK((m_log.p_done[i] == &jobs[i]) && (m_log.results[i] == 0));
+    }
+
+    CHECK(memcmp(nrfx_host_nvm_content_get(NRFX_HOST_NVM_BASE), data, WRITE_SIZE) == 0);
+    CHECK(memcmp(nrfx_host_nvm_content_get(UNALIGNED_ADDR), &bytes[1], UNALIGNED_SIZE) == 0);
+    CHECK(*nrfx_host_nvm_content_get(NRFX_HOST_NVM_BASE + WRITE_SIZE) == 0xFF);
+    CHECK(*nrfx_host_nvm_content_get(UNALIGNED_ADDR - 1) == 0xFF);
+    CHECK(*nrfx_host_nvm_content_get(NRFX_HOST_NVM_BASE + ERASE_SIZE - 1) == 0xFF);
+    CHECK(*nrfx_host_nvm_content_get(NRFX_HOST_NVM_BASE + ERASE_SIZE) == 0x00);
+
+    CHECK(nrfx_nvm_writer_uninit() == 0);
+    printf("  %-20s %4u steps %6u us max step %7u us total\n", p_name, steps, max_us,
+           (uint32_t)nrfx_host_nvm_busy_us_get());
+    return max_us;
+}
+
+#if defined(NVMC_PRESENT)
+/* Failed start of the erase completes the job with the error and does not stop the queue. */
+static void test_erase_error(void)
+{
+    static const uint32_t data = 0x12345678UL;
+    nrfx_nvm_writer_config_t config = NRFX_NVM_WRITER_DEFAULT_CONFIG;
+    nrfx_nvm_writer_job_t    jobs[JOB_COUNT] = {
+        { .type = NRFX_NVM_WRITER_JOB_ERASE, .address = NRFX_HOST_NVM_BASE, .size = 0x1000UL },
+        { .type = NRFX_NVM_WRITER_JOB_ERASE, .address = NRFX_HOST_NVM_BASE, .size = 0x1000UL },
+        { .type = NRFX_NVM_WRITER_JOB_WRITE, .address = NRFX_HOST_NVM_BASE, .p_data = &data,
+          .size = sizeof(data) },
+    };
+    uint32_t steps;
+
+    memset(&m_log, 0, sizeof(m_log));
+    nrfx_host_nvm_reset(0x00);
+    CHECK(nrfx_nvm_writer_init(&config, job_handler, NULL) == 0);
+
+    nrfx_host_nvm_erase_error_set(-EACCES);
+    for (uint32_t i = 0; i < JOB_COUNT; i++)
+    {
+        CHECK(nrfx_nvm_writer_submit(&jobs[i]) == 0);
+    }
+    (void)jobs_run(&steps);
+
+    CHECK(m_log.count == JOB_COUNT);
+    CHECK((m_log.p_done[0] == &jobs[0]) && (m_log.results[0] == -EACCES));
+    CHECK((m_log.p_done[1] == &jobs[1]) && (m_log.results[1] == 0));
+    CHECK((m_log.p_done[2] == &jobs[2]) && (m_log.results[2] == 0));
+    CHECK(memcmp(nrfx_host_nvm_content_get(NRFX_HOST_NVM_BASE), &data, sizeof(data)) == 0);
+    CHECK(nrfx_nvm_writer_uninit() == 0);
+}
+#endif
+
+void nrfx_host_test_nvm_writer(void)
+{
+    uint32_t max_us;
+
+    printf("NVM writer:\n");
+    max_us = test_jobs("default", false);
+
+#if defined(NVMC_PRESENT)
+    uint32_t page_max_us = test_jobs("whole page erase", true);
+
+    /* Partial erase shortens the longest step. */
+    CHECK(max_us < page_max_us);
+    test_erase_error();
+#else
+    (void)max_us;
+#endif
+}
+
+#else
+
+void nrfx_host_test_nvm_writer(void)
+{
+}
+
+#endif
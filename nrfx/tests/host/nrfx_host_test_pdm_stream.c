@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Test of the PDM stream helper.
+ *
+ * The PDM driver is replaced by the test, which fills the released buffers with synthetic
+ * signals and can make the buffer supply fail. The buffer handling is checked together with
+ * each processing step: mixdown, DC removal, gain and decimation with the FIR filters.
+ */
+
+#include "nrfx_host_test.h"
+
+#if defined(PDM_PRESENT)
+
+#include <math.h>
+#include <stdlib.h>
+#include <helpers/nrfx_pdm_stream.h>
+
+#define BUFFER_LENGTH 256
+#define BUFFER_COUNT  3
+
+static int16_t           m_pool[BUFFER_COUNT * BUFFER_LENGTH];
+static nrfx_pdm_stream_t m_stream;
+static nrfx_pdm_t        m_pdm;
+
+static struct
+{
+    int16_t * p_buffer;
+    uint16_t  length;
+    uint32_t  count;
+    int       result;
+} m_set;
+
+static struct
+{
+    int16_t * p_block;
+    size_t    length;
+    uint32_t  count;
+} m_block;
+
+int nrfx_pdm_buffer_set(nrfx_pdm_t * p_instance, int16_t * buffer, uint16_t buffer_length)
+{
+    CHECK(p_instance == &m_pdm);
+    m_set.p_buffer = buffer;
+    m_set.length   = buffer_length;
+    m_set.count++;
+    return m_set.result;
+}
+
+static void block_handler(int16_t * p_block, size_t length, void * p_context)
+{
+    CHECK(p_context == &m_block);
+    m_block.p_block = p_block;
+    m_block.length  = length;
+    m_block.count++;
+}
+
+static int stream_init(nrfx_pdm_stream_config_t const * p_config)
+{
+    memset(&m_set, 0, sizeof(m_set));
+    memset(&m_block, 0, sizeof(m_block));
+    return nrfx_pdm_stream_init(&m_stream, &m_pdm, p_config, block_handler, &m_block);
+}
+
+static void buffer_request(void)
+{
+    nrfx_pdm_evt_t evt = { .buffer_requested = true };
+
+    nrfx_pdm_stream_evt_handle(&m_stream, &evt);
+}
+
+/* Gets a buffer supplied to the driver, to be filled with samples. */
+static int16_t * buffer_get(void)
+{
+    buffer_request();
+    return m_set.p_buffer;
+}
+
+/* Releases the filled buffer and gives the processed block back. */
+static void buffer_release(int16_t * p_buffer)
+{
+    nrfx_pdm_evt_t evt = { .buffer_released = p_buffer };
+
+    nrfx_pdm_stream_evt_handle(&m_stream, &evt);
+    CHECK(m_block.p_block == p_buffer);
+    CHECK(nrfx_pdm_stream_block_free(&m_stream, p_buffer) == 0);
+}
+
+static nrfx_pdm_stream_config_t config_get(void)
+{
+    nrfx_pdm_stream_config_t config =
+        NRFX_PDM_STREAM_DEFAULT_CONFIG(m_pool, BUFFER_LENGTH, BUFFER_COUNT);
+
+    config.dc_alpha = 0;
+    return config;
+}
+
+static void test_config(void)
+{
+    nrfx_pdm_stream_config_t config = config_get();
+    static const int16_t     fir_big[] = { 32767, 32767, 32767 };
+
+    CHECK(stream_init(&config) == 0);
+
+    config.buffer_length = BUFFER_LENGTH - 1;
+    CHECK(stream_init(&config) == -EINVAL);
+
+    config               = config_get();
+    config.buffer_length = NRFX_PDM_MAX_BUFFER_SIZE + 1;
+    CHECK(stream_init(&config) == -EINVAL);
+
+    config              = config_get();
+    config.buffer_count = 2;
+    CHECK(stream_init(&config) == -EINVAL);
+
+    config            = config_get();
+    config.decimation = 3;
+    CHECK(stream_init(&config) == -EINVAL);
+
+    /* Length must hold whole frames of decimated stereo samples. */
+    config               = config_get();
+    config.stereo        = true;
+    config.decimation    = 4;
+    config.buffer_length = 4 * 2 * 10 + 2;
+    CHECK(stream_init(&config) == -EINVAL);
+
+    config            = config_get();
+    config.decimation = 2;
+    config.p_fir      = fir_big;
+    config.fir_taps   = NRFX_ARRAY_SIZE(fir_big);
+    CHECK(stream_init(&config) == -EINVAL);
+}
+
+static void test_buffers(void)
+{
+    nrfx_pdm_stream_config_t config = config_get();
+    nrfx_pdm_stream_stats_t  stats;
+
+    int16_t *                p_bufs[BUFFER_COUNT];
+
+    CHECK(stream_init(&config) == 0);
+
+    /* Different buffers are supplied from the pool until it is empty. */
+    for (uint32_t i = 0; i < BUFFER_COUNT; i++)
+    {
+        p_bufs[i] = buffer_get();
+        CHECK((m_set.count == i + 1) && (m_set.length == BUFFER_LENGTH));
+        CHECK((p_bufs[i] >= m_pool) && (p_bufs[i] < &m_pool[NRFX_ARRAY_SIZE(m_pool)]));
+        CHECK(((p_bufs[i] - m_pool) % BUFFER_LENGTH) == 0);
+        for (uint32_t j = 0; j < i; j++)
+        {
+            CHECK(p_bufs[i] != p_bufs[j]);
+        }
+    }
+    buffer_request();
+    CHECK(m_set.count == BUFFER_COUNT);
+
+    /* Block given back while the driver waits goes to the driver directly. */
+    nrfx_pdm_evt_t evt = { .buffer_released = p_bufs[0] };
+
+    nrfx_pdm_stream_evt_handle(&m_stream, &evt);
+    CHECK((m_block.count == 1) && (m_block.length == BUFFER_LENGTH));
+    CHECK(nrfx_pdm_stream_block_free(&m_stream, p_bufs[0]) == 0);
+    CHECK((m_set.count == BUFFER_COUNT + 1) && (m_set.p_buffer == p_bufs[0]));
+
+    /* Blocks outside of the pool or already free are refused. */
+    CHECK(nrfx_pdm_stream_block_free(&m_stream, &p_bufs[1][1]) == -EINVAL);
+    CHECK(nrfx_pdm_stream_block_free(&m_stream, p_bufs[1]) == 0);
+    CHECK(nrfx_pdm_stream_block_free(&m_stream, p_bufs[1]) == -EINVAL);
+
+    /* Buffer not taken by the driver goes back to the pool. */
+    m_set.result = -EBUSY;
+    buffer_request();
+    CHECK(m_set.p_buffer == p_bufs[1]);
+    m_set.result = 0;
+    buffer_request();
+    CHECK(m_set.p_buffer == p_bufs[1]);
+
+    /* The same for the block handed over to a waiting driver. */
+    buffer_request();
+    m_set.result = -EBUSY;
+    CHECK(nrfx_pdm_stream_block_free(&m_stream, p_bufs[2]) == 0);
+    m_set.result = 0;
+    buffer_request();
+    CHECK(m_set.p_buffer == p_bufs[2]);
+
+    nrfx_pdm_stream_stats_get(&m_stream, &stats);
+    CHECK((stats.starved_count == 2) && (stats.buffer_set_error_count == 2));
+    CHECK(stats.overflow_count == 0);
+}
+
+static void test_mixdown_gain(void)
+{
+    nrfx_pdm_stream_config_t config = config_get();
+    int16_t *                p_buf;
+
+    config.stereo  = true;
+    config.mixdown = true;
+    CHECK(stream_init(&config) == 0);
+    p_buf = buffer_get();
+
+    for (uint32_t i = 0; i < BUFFER_LENGTH; i += 2)
+    {
+        p_buf[i]     = (int16_t)(1000 + i);
+        p_buf[i + 1] = -201;
+    }
+    buffer_release(p_buf);
+    CHECK(m_block.length == BUFFER_LENGTH / 2);
+    for (uint32_t i = 0; i < BUFFER_LENGTH / 2; i++)
+    {
+        CHECK(p_buf[i] == (int16_t)(((int32_t)(1000 + 2 * i) - 201) / 2));
+    }
+
+    /* Gain saturates at the limits of the sample range. */
+    config       = config_get();
+    config.gain  = 2 * NRFX_PDM_STREAM_GAIN_UNITY;
+    CHECK(stream_init(&config) == 0);
+    p_buf    = buffer_get();
+    p_buf[0] = 10000;
+    p_buf[1] = -10000;
+    p_buf[2] = 20000;
+    p_buf[3] = -20000;
+    buffer_release(p_buf);
+    CHECK((p_buf[0] == 20000) && (p_buf[1] == -20000));
+    CHECK((p_buf[2] == INT16_MAX) && (p_buf[3] == INT16_MIN));
+}
+
+static void test_dc(void)
+{
+    nrfx_pdm_stream_config_t config = NRFX_PDM_STREAM_DEFAULT_CONFIG(m_pool, BUFFER_LENGTH,
+                                                                     BUFFER_COUNT);
+    int16_t *                p_buf  = NULL;
+
+    config.stereo = true;
+    CHECK(stream_init(&config) == 0);
+
+    /* Constant offsets of both channels decay independently, the tone passes. */
+    for (uint32_t block = 0; block < 200; block++)
+    {
+        p_buf = buffer_get();
+        for (uint32_t i = 0; i < BUFFER_LENGTH; i += 2)
+        {
+            p_buf[i]     = 5000;
+            p_buf[i + 1] = (int16_t)(-3000 + 2000 * sin(0.2 * M_PI * (block * BUFFER_LENGTH + i)));
+        }
+        buffer_release(p_buf);
+        if (block == 0)
+        {
+            CHECK((p_buf[0] == 5000) && (p_buf[1] == -3000));
+        }
+    }
+
+    double sum = 0;
+
+    for (uint32_t i = 0; i < BUFFER_LENGTH; i += 2)
+    {
+        CHECK(abs(p_buf[i]) < 10);
+        sum += p_buf[i + 1];
+    }
+    CHECK(fabs(sum / (BUFFER_LENGTH / 2)) < 50);
+}
+
+/* RMS of the decimated output of a tone with the amplitude of 10000. */
+static double tone_rms(nrfx_pdm_stream_config_t const * p_config, double freq)
+{
+    int16_t * p_buf  = NULL;
+    double    energy = 0;
+
+    CHECK(stream_init(p_config) == 0);
+
+    /* First blocks fill the delay line of the filter. */
+    for (uint32_t block = 0; block < 4; block++)
+    {
+        p_buf = buffer_get();
+        for (uint32_t i = 0; i < BUFFER_LENGTH; i++)
+        {
+            p_buf[i] = (int16_t)(10000 * sin(2 * M_PI * freq * (block * BUFFER_LENGTH + i)));
+        }
+        buffer_release(p_buf);
+    }
+
+    CHECK(m_block.length == BUFFER_LENGTH / p_config->decimation);
+    for (size_t i = 0; i < m_block.length; i++)
+    {
+        energy += (double)p_buf[i] * p_buf[i];
+    }
+    return sqrt(energy / m_block.length);
+}
+
+static void test_fir(void)
+{
+    nrfx_pdm_stream_config_t config = config_get();
+    static const int16_t     fir_avg[] = { 8192, 16384, 8192 };
+    double                   pass;
+    double                   stop;
+
+    /* Built-in filters pass the band below their cut-off and attenuate the aliases. */
+    config.decimation = 2;
+    pass = tone_rms(&config, 0.05);
+    stop = tone_rms(&config, 0.4);
+    CHECK((pass > 6500) && (pass < 7500) && (stop < 100));
+    printf("  decimation 2: %5.0f RMS at 0.05 fs, %4.0f RMS at 0.4 fs\n", pass, stop);
+
+    config.decimation = 4;
+    pass = tone_rms(&config, 0.02);
+    stop = tone_rms(&config, 0.2);
+    CHECK((pass > 6500) && (pass < 7500) && (stop < 100));
+    printf("  decimation 4: %5.0f RMS at 0.02 fs, %4.0f RMS at 0.2 fs\n", pass, stop);
+
+    /* User filter with an odd number of taps keeps the DC gain of its coefficients. */
+    int16_t * p_buf;
+
+    config.decimation = 2;
+    config.p_fir      = fir_avg;
+    config.fir_taps   = NRFX_ARRAY_SIZE(fir_avg);
+    CHECK(stream_init(&config) == 0);
+    p_buf = buffer_get();
+    for (uint32_t i = 0; i < BUFFER_LENGTH; i++)
+    {
+        p_buf[i] = 1000;
+    }
+    buffer_release(p_buf);
+    CHECK((m_block.length == BUFFER_LENGTH / 2) && (p_buf[1] == 1000) &&
+          (p_buf[BUFFER_LENGTH / 2 - 1] == 1000));
+
+    /* Impulse response comes out in the order of the coefficients. */
+    CHECK(stream_init(&config) == 0);
+    p_buf = buffer_get();
+    memset(p_buf, 0, BUFFER_LENGTH * sizeof(int16_t));
+    p_buf[1] = 16384;
+    buffer_release(p_buf);
+    CHECK((p_buf[0] == 4096) && (p_buf[1] == 4096) && (p_buf[2] == 0));
+}
+
+void nrfx_host_test_pdm_stream(void)
+{
+    printf("PDM stream:\n");
+    test_config();
+    test_buffers();
+    test_mixdown_gain();
+    test_dc();
+    test_fir();
+}
+
+#else
+
+void nrfx_host_test_pdm_stream(void)
+{
+}
+
+#endif // defined(PDM_PRESENT)
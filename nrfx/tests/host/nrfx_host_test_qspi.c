@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Test of the QSPI driver request queue against the register model.
+ *
+ * The test takes the role of the peripheral: it checks the task triggered by the driver,
+ * generates the READY event and calls the interrupt handler, which runs the queue.
+ */
+
+#include <nrfx.h>
+#include "nrfx_host_test.h"
+
+#if defined(NRF52840_XXAA)
+#include <nrfx_qspi.h>
+#include <hal/nrf_gpio.h>
+
+#define REQ_COUNT 3
+
+static struct
+{
+    nrfx_qspi_req_t * p_done[REQ_COUNT + 1];
+    int               results[REQ_COUNT + 1];
+    uint32_t          count;
+} m_log;
+
+static void qspi_handler(nrfx_qspi_evt_t event, void * p_context)
+{
+    (void)event;
+    (void)p_context;
+    CHECK(false);
+}
+
+static void req_handler(nrfx_qspi_req_t * p_req, void * p_context)
+{
+    (void)p_context;
+
+    CHECK(m_log.count < NRFX_ARRAY_SIZE(m_log.p_done));
+    m_log.p_done[m_log.count]  = p_req;
+    m_log.results[m_log.count] = p_req->result;
+    m_log.count++;
+}
+
+/* Interrupt with the pending state set by the driver. */
+static void irq_run(void)
+{
+    while (nrfx_host_irq_pending_check(QSPI_IRQn))
+    {
+        nrfx_host_irq_pending_clear(QSPI_IRQn);
+        nrfx_qspi_irq_handler();
+    }
+}
+
+/* Ends the operation started with the given task. */
+static void task_complete(uint32_t volatile * p_task)
+{
+    CHECK(*p_task == 1);
+    *p_task = 0;
+    NRF_QSPI->EVENTS_READY = 1;
+    nrfx_qspi_irq_handler();
+}
+
+static void driver_init(nrfx_qspi_queue_config_t const * p_queue_config)
+{
+    nrfx_qspi_config_t config = NRFX_QSPI_DEFAULT_CONFIG(NRF_GPIO_PIN_MAP(0, 19),
+                                                         NRF_GPIO_PIN_MAP(0, 17),
+                                                         NRF_GPIO_PIN_MAP(0, 20),
+                                                         NRF_GPIO_PIN_MAP(0, 21),
+                                                         NRF_GPIO_PIN_MAP(0, 22),
+                                                         NRF_GPIO_PIN_MAP(0, 23));
+
+    nrfx_host_reg_reset(NRF_QSPI, sizeof(*NRF_QSPI));
+    nrfx_host_irq_pending_clear(QSPI_IRQn);
+    memset(&m_log, 0, sizeof(m_log));
+    CHECK(nrfx_qspi_init(&config, qspi_handler, NULL) == 0);
+    CHECK(nrfx_qspi_queue_init(p_queue_config, req_handler, NULL) == 0);
+}
+
+static void req_read_init(nrfx_qspi_req_t * p_req, void * p_buffer, size_t size, uint32_t addr)
+{
+    memset(p_req, 0, sizeof(*p_req));
+    p_req->type     = NRFX_QSPI_REQ_READ;
+    p_req->p_buffer = p_buffer;
+    p_req->size     = size;
+    p_req->addr     = addr;
+}
+
+/* Operations outside of the queue are rejected while the queue mode is enabled. */
+static void test_raw_rejected(void)
+{
+    nrfx_qspi_queue_config_t queue_config = NRFX_QSPI_QUEUE_DEFAULT_CONFIG;
+    uint8_t *                p_buf        = nrfx_host_ram_alloc(64);
+
+    driver_init(&queue_config);
+    CHECK(nrfx_qspi_read(p_buf, 64, 0) == -EBUSY);
+    CHECK(nrfx_qspi_write(p_buf, 64, 0) == -EBUSY);
+    CHECK(nrfx_qspi_erase(NRF_QSPI_ERASE_LEN_4KB, 0) == -EBUSY);
+    CHECK(nrfx_qspi_chip_erase() == -EBUSY);
+    CHECK(NRF_QSPI->TASKS_READSTART == 0);
+    CHECK(NRF_QSPI->TASKS_WRITESTART == 0);
+    CHECK(NRF_QSPI->TASKS_ERASESTART == 0);
+
+    CHECK(nrfx_qspi_queue_uninit() == 0);
+    nrfx_qspi_uninit();
+}
+
+/* Timeout fails the request in progress and the queue goes on with the next one. */
+static void test_timeout(void)
+{
+    nrfx_qspi_queue_config_t queue_config = NRFX_QSPI_QUEUE_DEFAULT_CONFIG;
+    nrfx_qspi_req_t          reqs[2];
+    uint8_t *                p_buf = nrfx_host_ram_alloc(128);
+
+    driver_init(&queue_config);
+    req_read_init(&reqs[0], p_buf, 64, 0);
+    req_read_init(&reqs[1], p_buf + 64, 64, 64);
+    CHECK(nrfx_qspi_queue_submit(&reqs[0]) == 0);
+    CHECK(nrfx_qspi_queue_submit(&reqs[1]) == 0);
+    irq_run();
+    task_complete(&NRF_QSPI->TASKS_ACTIVATE);
+
+    nrfx_qspi_timeout_signal();
+    task_complete(&NRF_QSPI->TASKS_READSTART);
+    CHECK((m_log.count == 1) && (m_log.p_done[0] == &reqs[0]));
+    CHECK(m_log.results[0] == -ETIMEDOUT);
+
+    task_complete(&NRF_QSPI->TASKS_READSTART);
+    CHECK((m_log.count == 2) && (m_log.p_done[1] == &reqs[1]) && (m_log.results[1] == 0));
+    CHECK(NRF_QSPI->READ.SRC == 64);
+
+    CHECK(nrfx_qspi_queue_uninit() == 0);
+    nrfx_qspi_uninit();
+}
+
+/* READY event of an operation not started by the queue does not validate the read-ahead buffer. */
+static void test_stray_ready(void)
+{
+    nrfx_qspi_queue_config_t queue_config = NRFX_QSPI_QUEUE_DEFAULT_CONFIG;
+    nrfx_qspi_req_t          req;
+    uint8_t                  buf[16];
+
+    queue_config.p_cache    = nrfx_host_ram_alloc(64);
+    queue_config.cache_size = 64;
+    driver_init(&queue_config);
+
+    NRF_QSPI->EVENTS_READY = 1;
+    nrfx_qspi_irq_handler();
+    NRF_QSPI->EVENTS_READY = 1;
+    nrfx_qspi_irq_handler();
+    CHECK(m_log.count == 0);
+
+    req_read_init(&req, buf, sizeof(buf), 0);
+    CHECK(nrfx_qspi_queue_submit(&req) == 0);
+    irq_run();
+    CHECK(m_log.count == 0);
+    CHECK(NRF_QSPI->TASKS_READSTART == 1);
+    task_complete(&NRF_QSPI->TASKS_READSTART);
+    CHECK((m_log.count == 1) && (m_log.results[0] == 0));
+
+    CHECK(nrfx_qspi_queue_uninit() == 0);
+    nrfx_qspi_uninit();
+}
+
+/* Uninit cancels the pending requests and leaves the queue mode disabled. */
+static void test_uninit_cancel(void)
+{
+    nrfx_qspi_queue_config_t queue_config = NRFX_QSPI_QUEUE_DEFAULT_CONFIG;
+    nrfx_qspi_req_t          reqs[REQ_COUNT];
+    uint8_t *                p_buf = nrfx_host_ram_alloc(64 * REQ_COUNT);
+
+    driver_init(&queue_config);
+    for (size_t i = 0; i < REQ_COUNT; i++)
+    {
+        req_read_init(&reqs[i], p_buf + 64 * i, 64, 64 * i);
+        CHECK(nrfx_qspi_queue_submit(&reqs[i]) == 0);
+    }
+    irq_run();
+    task_complete(&NRF_QSPI->TASKS_ACTIVATE);
+    CHECK(NRF_QSPI->TASKS_READSTART == 1);
+
+    nrfx_qspi_uninit();
+    CHECK(m_log.count == REQ_COUNT);
+    for (size_t i = 0; i < REQ_COUNT; i++)
+    {
+        CHECK((m_log.p_done[i] == &reqs[i]) && (m_log.results[i] == -ECANCELED));
+    }
+
+    /* Driver initialized again is not in the queue mode. */
+    nrfx_qspi_config_t config = NRFX_QSPI_DEFAULT_CONFIG(NRF_GPIO_PIN_MAP(0, 19),
+                                                         NRF_GPIO_PIN_MAP(0, 17),
+                                                         NRF_GPIO_PIN_MAP(0, 20),
+                                                         NRF_GPIO_PIN_MAP(0, 21),
+                                                         NRF_GPIO_PIN_MAP(0, 22),
+                                                         NRF_GPIO_PIN_MAP(0, 23));
+
+    CHECK(nrfx_qspi_init(&config, qspi_handler, NULL) == 0);
+    CHECK(nrfx_qspi_queue_submit(&reqs[0]) == -EPERM);
+    CHECK(nrfx_qspi_queue_pending_check() == false);
+    nrfx_qspi_uninit();
+}
+
+void nrfx_host_test_qspi(void)
+{
+    test_raw_rejected();
+    test_timeout();
+    test_stray_ready();
+    test_uninit_cancel();
+    nrfx_host_ram_free_all();
+}
+
+#else
+
+void nrfx_host_test_qspi(void)
+{
+}
+
+#endif
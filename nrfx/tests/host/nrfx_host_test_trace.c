@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Test of the trace RAM backend and of the decoder.
+ *
+ * A simulated workload emits the events of an interrupt with a varying latency, of nested
+ * processing and of points, while the DWT cycle counter of the model gives the timestamps.
+ * The ring is read in chunks and fed to the decoder, and the decoded statistics are compared
+ * with the ones computed by the workload. The latency histogram is printed at the end.
+ */
+
+#include <helpers/nrfx_trace.h>
+#include <helpers/nrfx_trace_decode.h>
+#include "nrfx_host_test.h"
+
+#define RING_SIZE   64
+#define CHUNK_SIZE  16
+#define ID_IRQ      1
+#define ID_PROCESS  2
+#define ID_POINT    3
+#define ID_COUNT    4
+#define EVENTS      5000
+
+static nrfx_trace_record_t      m_ring[RING_SIZE];
+static nrfx_trace_decode_stat_t m_stats[ID_COUNT];
+static nrfx_trace_decode_t      m_decode;
+static uint32_t                 m_seed = 1;
+
+static uint32_t rand_get(void)
+{
+    m_seed = m_seed * 1103515245UL + 12345UL;
+    return m_seed >> 16;
+}
+
+static void time_advance(uint32_t cycles)
+{
+    DWT->CYCCNT += cycles;
+}
+
+/* Reads all the records stored so far and feeds them to the decoder. */
+static uint32_t ring_drain(uint32_t * p_dropped)
+{
+    nrfx_trace_record_t chunk[CHUNK_SIZE];
+    uint32_t            total   = 0;
+    uint32_t            dropped = 0;
+    uint32_t            count;
+
+    do
+    {
+        uint32_t chunk_dropped;
+
+        count = nrfx_trace_ring_read(chunk, CHUNK_SIZE, &chunk_dropped);
+        nrfx_trace_decode_feed(&m_decode, chunk, count);
+        dropped += chunk_dropped;
+        total   += count;
+    } while (count == CHUNK_SIZE);
+
+    if (p_dropped)
+    {
+        *p_dropped = dropped;
+    }
+    return total;
+}
+
+static void test_ring(void)
+{
+    nrfx_trace_record_t records[RING_SIZE];
+    uint32_t            dropped;
+    uint32_t            count;
+
+    CHECK(nrfx_trace_ring_init(m_ring, 6) == -EINVAL);
+    CHECK(nrfx_trace_ring_init(m_ring, 8) == 0);
+    CHECK(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk);
+
+    /* Records are read in order, with the sequence numbers starting from 1. */
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        NRFX_TRACE_BEGIN(ID_IRQ, i);
+        time_advance(10);
+        NRFX_TRACE_END(ID_IRQ, i);
+    }
+    count = nrfx_trace_ring_read(records, RING_SIZE, &dropped);
+    CHECK((count == 6) && (dropped == 0));
+    for (uint32_t i = 0; i < count; i++)
+    {
+        CHECK(records[i].seq == i + 1);
+        CHECK(records[i].type == ((i % 2) ? NRFX_TRACE_TYPE_END : NRFX_TRACE_TYPE_BEGIN));
+        CHECK(records[i].data == i / 2);
+    }
+    CHECK(records[1].timestamp - records[0].timestamp == 10);
+
+    /* Oldest records are overwritten and reported as dropped. */
+    for (uint32_t i = 0; i < 20; i++)
+    {
+        NRFX_TRACE_POINT(ID_POINT);
+    }
+    count = nrfx_trace_ring_read(records, RING_SIZE, &dropped);
+    CHECK((count == 8) && (dropped == 12) && (records[0].seq == 6 + 12 + 1));
+
+    /* Reading stops at a record that is being written. */
+    NRFX_TRACE_POINT(ID_POINT);
+    NRFX_TRACE_POINT(ID_POINT);
+    m_ring[(6 + 20) & 7].seq = 0;
+    CHECK(nrfx_trace_ring_read(records, RING_SIZE, &dropped) == 0);
+    m_ring[(6 + 20) & 7].seq = 6 + 20 + 1;
+    CHECK(nrfx_trace_ring_read(records, RING_SIZE, &dropped) == 2);
+    CHECK(nrfx_trace_ring_read(records, RING_SIZE, &dropped) == 0);
+}
+
+static void histogram_print(char const * p_name, nrfx_trace_decode_stat_t const * p_stat)
+{
+    printf("  %s: %u intervals, min %u, mean %u, max %u, p50 <= %u, p99 <= %u cycles\n",
+           p_name, p_stat->count, p_stat->min, nrfx_trace_decode_mean_get(p_stat), p_stat->max,
+           nrfx_trace_decode_percentile_get(p_stat, 50),
+           nrfx_trace_decode_percentile_get(p_stat, 99));
+
+    for (uint32_t i = 0; i < NRFX_TRACE_DECODE_BUCKETS; i++)
+    {
+        if (p_stat->buckets[i])
+        {
+            uint32_t low  = i ? (1UL << (i - 1)) : 0;
+            uint32_t high = i ? (uint32_t)((1ULL << i) - 1) : 0;
+            uint32_t bar  = (uint32_t)(((uint64_t)p_stat->buckets[i] * 50 + p_stat->count - 1) /
+                                       p_stat->count);
+
+            printf("    %6u - %6u %6u ", low, high, p_stat->buckets[i]);
+            for (uint32_t j = 0; j < bar; j++)
+            {
+                putchar('#');
+            }
+            putchar('\n');
+        }
+    }
+}
+
+static void test_decode(void)
+{
+    nrfx_trace_decode_stat_t expected = { 0 };
+    uint32_t                 points   = 0;
+    uint32_t                 dropped;
+
+    CHECK(nrfx_trace_ring_init(m_ring, RING_SIZE) == 0);
+    nrfx_trace_decode_init(&m_decode, m_stats, ID_COUNT);
+
+    /* Interrupt latency of 40 to 103 cycles, delayed by 2000 cycles for every 50th event,
+     * with the processing nested in the interrupt. The ring is read every 8 events. */
+    for (uint32_t i = 0; i < EVENTS; i++)
+    {
+        uint32_t latency = 40 + (rand_get() % 64) + (((i % 50) == 49) ? 2000 : 0);
+
+        time_advance(rand_get() % 1000);
+        NRFX_TRACE_BEGIN(ID_IRQ, i);
+        time_advance(latency - 30);
+        NRFX_TRACE_BEGIN(ID_PROCESS, i);
+        time_advance(20);
+        NRFX_TRACE_END(ID_PROCESS, i);
+        time_advance(10);
+        NRFX_TRACE_END(ID_IRQ, i);
+        if ((i % 3) == 0)
+        {
+            NRFX_TRACE_POINT(ID_POINT);
+            points++;
+        }
+
+        if ((expected.count == 0) || (latency < expected.min))
+        {
+            expected.min = latency;
+        }
+        expected.max  = NRFX_MAX(expected.max, latency);
+        expected.sum += latency;
+        expected.count++;
+
+        if ((i % 8) == 7)
+        {
+            (void)ring_drain(&dropped);
+            CHECK(dropped == 0);
+        }
+    }
+    (void)ring_drain(&dropped);
+
+    nrfx_trace_decode_stat_t const * p_irq = &m_stats[ID_IRQ];
+
+    CHECK((m_decode.dropped == 0) && (m_decode.ignored == 0));
+    CHECK((p_irq->count == expected.count) && (p_irq->sum == expected.sum));
+    CHECK((p_irq->min == expected.min) && (p_irq->max == expected.max));
+    CHECK((m_stats[ID_PROCESS].count == EVENTS) && (m_stats[ID_PROCESS].min == 20) &&
+          (m_stats[ID_PROCESS].max == 20));
+    CHECK(m_stats[ID_POINT].points == points);
+    CHECK((p_irq->unmatched == 0) && (m_stats[ID_PROCESS].unmatched == 0));
+
+    /* Only the delayed events are above the 90th percentile. */
+    CHECK(nrfx_trace_decode_percentile_get(p_irq, 90) < 128);
+    CHECK(nrfx_trace_decode_percentile_get(p_irq, 100) == expected.max);
+
+    printf("Trace decoder:\n");
+    histogram_print("IRQ latency", p_irq);
+
+    /* Interval which lost records between its begin and end is discarded. */
+    NRFX_TRACE_BEGIN(ID_IRQ, 0);
+    CHECK(ring_drain(NULL) == 1);
+    for (uint32_t i = 0; i < 2 * RING_SIZE; i++)
+    {
+        NRFX_TRACE_POINT(ID_POINT);
+    }
+    time_advance(1000000);
+    NRFX_TRACE_END(ID_IRQ, 0);
+    (void)ring_drain(&dropped);
+    CHECK((dropped == RING_SIZE + 1) && (m_decode.dropped == dropped));
+    CHECK((p_irq->count == expected.count) && (p_irq->max == expected.max));
+    CHECK(p_irq->unmatched == 1);
+
+    /* Interval across the wrap of the timestamp. */
+    DWT->CYCCNT = 0xFFFFFFF0UL;
+    NRFX_TRACE_BEGIN(ID_PROCESS, 0);
+    time_advance(0x30);
+    NRFX_TRACE_END(ID_PROCESS, 0);
+    (void)ring_drain(NULL);
+    CHECK((m_stats[ID_PROCESS].count == EVENTS + 1) && (m_stats[ID_PROCESS].max == 0x30));
+
+    /* Records with an ID out of the range of the decoder are counted, not decoded. */
+    NRFX_TRACE_POINT(ID_COUNT);
+    (void)ring_drain(NULL);
+    CHECK(m_decode.ignored == 1);
+}
+
+void nrfx_host_test_trace(void)
+{
+    test_ring();
+    test_decode();
+}